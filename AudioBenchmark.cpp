@@ -0,0 +1,542 @@
+// AudioBenchmark.cpp - ESP32 Audio OS v2.0
+// Render-loop microbenchmarks (per-stage ns/sample, voices-per-core headroom)
+
+#include "AudioBenchmark.h"
+
+#if ENABLE_BENCHMARK
+
+#include "AudioEngine.h"
+#include "AudioEffects.h"
+#include "AudioResampler.h"
+
+// Defeats dead-code elimination of the measured loops
+static volatile int32_t benchSink;
+
+static const uint32_t benchRates[] = { 11025, 22050, 44100 };
+static const uint32_t benchBlocks[] = { 32, 64, 128, 256 };
+static const uint8_t benchVoices[] = { 0, 1, 4, 8, 16, 32 };
+
+#define BENCH_NUM_RATES   (sizeof(benchRates) / sizeof(benchRates[0]))
+#define BENCH_NUM_BLOCKS  (sizeof(benchBlocks) / sizeof(benchBlocks[0]))
+#define BENCH_NUM_VOICES  (sizeof(benchVoices) / sizeof(benchVoices[0]))
+#define BENCH_MAX_BLOCK   256
+#define BENCH_REF_RATE    22050
+
+AudioBenchmark::AudioBenchmark() : benchFrames(BENCH_DEFAULT_FRAMES) {
+  fillInput();
+}
+
+void AudioBenchmark::fillInput() {
+  uint32_t lfsr = 0xACE1u;
+  for (int i = 0; i < BENCH_INPUT_SIZE; i++) {
+    lfsr = lfsr * 1664525u + 1013904223u;
+    input16[i] = (int16_t)(lfsr >> 16) / 4;
+  }
+}
+
+float AudioBenchmark::nsPerSample(uint32_t cycles, uint32_t samples) {
+  return ((float)cycles * 1.0e9f / (float)platformCycleFrequency()) / (float)samples;
+}
+
+void AudioBenchmark::printHeader(const char* title) {
+  Serial.println();
+  Serial.printf("── %s ", title);
+  for (int i = strlen(title); i < 52; i++) Serial.print("─");
+  Serial.println();
+}
+
+void AudioBenchmark::printStage(const char* name, uint32_t cycles, uint32_t samples) {
+  float ns = nsPerSample(cycles, samples);
+  float budgetNs = 1.0e9f / BENCH_REF_RATE;
+  Serial.printf("  %-28s %9.1f ns/sample   %7.0f /core @%u\n",
+                name, ns, ns > 0.0f ? budgetNs / ns : 0.0f, BENCH_REF_RATE);
+}
+
+void AudioBenchmark::runAll() {
+  runStages();
+  runOscillators();
+  runResampler();
+  runEffectChain();
+  runEngine();
+}
+
+// ============================================================================
+// OSCILLATOR MODES
+// ============================================================================
+
+// Hann-windowed DFT of BENCH_ALIAS_SIZE samples. Bins within two of a
+// harmonic of f0 below Nyquist count as signal, everything else (folded
+// harmonics) as aliasing. Returns alias / signal energy in dB.
+float AudioBenchmark::aliasRatioDb(const float* signal, float* cosTable, float f0) {
+  const uint32_t n = BENCH_ALIAS_SIZE;
+  const float binHz = (float)BENCH_REF_RATE / n;
+  
+  for (uint32_t i = 0; i < n; i++) {
+    cosTable[i] = cosf(2.0f * PI * i / n);
+  }
+  
+  double signalEnergy = 0.0, aliasEnergy = 0.0;
+  for (uint32_t k = 3; k < n / 2; k++) {
+    float re = 0.0f, im = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+      float w = signal[i] * (0.5f - 0.5f * cosTable[i]);
+      uint32_t idx = (k * i) & (n - 1);
+      re += w * cosTable[idx];
+      im -= w * cosTable[(idx + n * 3 / 4) & (n - 1)];
+    }
+    float energy = re * re + im * im;
+    
+    float harmonic = (k * binHz) / f0;
+    float nearest = floorf(harmonic + 0.5f);
+    bool isHarmonic = nearest >= 1.0f && fabsf(harmonic - nearest) * f0 <= 2.0f * binHz;
+    if (isHarmonic) signalEnergy += energy;
+    else aliasEnergy += energy;
+  }
+  
+  if (signalEnergy <= 0.0 || aliasEnergy <= 0.0) return 0.0f;
+  return (float)(10.0 * log10(aliasEnergy / signalEnergy));
+}
+
+void AudioBenchmark::runOscillators() {
+  printHeader("Oscillator modes (note 96 @ 22050)");
+  
+  static const OscillatorMode modes[] = { OSC_NAIVE, OSC_WAVETABLE, OSC_POLYBLEP };
+  static const char* modeNames[] = { "naive", "wavetable", "polyblep" };
+  static const WaveformType waves[] = { WAVE_SAWTOOTH, WAVE_SQUARE };
+  static const char* waveNames[] = { "sawtooth", "square" };
+  
+  const uint32_t block = 128;
+  int32_t mix[block * 2];        // Interleaved L/R
+  
+  VoiceBank bank;
+  float* signal = (float*)malloc(BENCH_ALIAS_SIZE * sizeof(float));
+  float* cosTable = (float*)malloc(BENCH_ALIAS_SIZE * sizeof(float));
+  if (!bank.allocate(block) || !signal || !cosTable) {
+    Serial.println(F("  Oscillators                   (allocation failed)"));
+    free(signal);
+    free(cosTable);
+    return;
+  }
+  
+  bank.setSampleRate(BENCH_REF_RATE);
+  const float f0 = 440.0f * powf(2.0f, (BENCH_ALIAS_NOTE - 69) / 12.0f);
+  
+  for (int w = 0; w < 2; w++) {
+    for (int m = 0; m < 3; m++) {
+      bank.reset(1, waves[w]);
+      bank.setOscillatorMode(modes[m]);
+      bank.noteOn(0, BENCH_ALIAS_NOTE, 127);
+      
+      // Cost per voice-sample, one held note
+      uint32_t start = platformCycleCount();
+      for (uint32_t done = 0; done < benchFrames; done += block) {
+        bank.render(mix, block, nullptr);
+      }
+      uint32_t cycles = platformCycleCount() - start;
+      benchSink = mix[0];
+      
+      // Aliasing on the sustained note (envelope settled by now)
+      for (uint32_t done = 0; done < BENCH_ALIAS_SIZE; done += block) {
+        memset(mix, 0, sizeof(mix));
+        bank.render(mix, block, nullptr);
+        for (uint32_t i = 0; i < block; i++) signal[done + i] = (float)mix[i * 2];
+      }
+      float aliasDb = aliasRatioDb(signal, cosTable, f0);
+      
+      char name[32];
+      snprintf(name, sizeof(name), "%s %s%s", waveNames[w], modeNames[m],
+               bank.getOscillatorMode() != modes[m] ? " (n/a)" : "");
+      float ns = nsPerSample(cycles, benchFrames);
+      Serial.printf("  %-28s %9.1f ns/sample %8.1f cycles  %6.1f dB alias\n",
+                    name, ns, (float)cycles / benchFrames, aliasDb);
+    }
+  }
+  
+  free(signal);
+  free(cosTable);
+}
+
+// ============================================================================
+// ISOLATED DSP STAGES
+// ============================================================================
+
+void AudioBenchmark::runStages() {
+  printHeader("DSP stages (isolated)");
+  
+  AudioEngine::initWavetable();
+  
+  static const WaveformType waves[] = { WAVE_SINE, WAVE_SQUARE, WAVE_SAWTOOTH, WAVE_TRIANGLE, WAVE_NOISE };
+  static const char* waveNames[] = { "VoiceBank sine", "VoiceBank square",
+                                     "VoiceBank sawtooth", "VoiceBank triangle",
+                                     "VoiceBank noise" };
+  
+  const uint32_t block = 128;
+  int32_t mix[block * 2];        // Interleaved L/R
+  int32_t vibrato[block / LFO_CONTROL_FRAMES];
+  for (uint32_t i = 0; i < block / LFO_CONTROL_FRAMES; i++) vibrato[i] = 328;   // +1% pitch
+  
+  VoiceBank bank;
+  bank.setSampleRate(BENCH_REF_RATE);
+  if (!bank.allocate(block)) {
+    Serial.println(F("  VoiceBank                     (allocation failed)"));
+    return;
+  }
+  
+  // Per voice-sample, one voice held in sustain (envelope segments included)
+  for (int w = 0; w < 6; w++) {
+    bank.reset(1, waves[w < 5 ? w : 0]);
+    bank.noteOn(0, NOTE_A4, 127);
+    
+    uint32_t start = platformCycleCount();
+    for (uint32_t done = 0; done < benchFrames; done += block) {
+      bank.render(mix, block, w < 5 ? nullptr : vibrato);
+    }
+    uint32_t cycles = platformCycleCount() - start;
+    benchSink = mix[0];
+    printStage(w < 5 ? waveNames[w] : "VoiceBank sine+vibrato", cycles, benchFrames);
+  }
+  
+  // Envelope shapes, per voice-sample: 8 sines held in a 60 s attack
+  static const char* curveNames[] = { "VoiceBank 8 linear env", "VoiceBank 8 exp env" };
+  for (int c = 0; c < 2; c++) {
+    bank.setEnvelope(60000, DEFAULT_ENV_DECAY_MS, DEFAULT_ENV_SUSTAIN, DEFAULT_ENV_RELEASE_MS,
+                     c ? ENV_CURVE_EXPONENTIAL : ENV_CURVE_LINEAR);
+    bank.reset(8, WAVE_SINE);
+    for (uint8_t v = 0; v < 8; v++) {
+      bank.noteOn(v, NOTE_C3 + v * 5, 127);
+    }
+    
+    uint32_t start = platformCycleCount();
+    for (uint32_t done = 0; done < benchFrames; done += block) {
+      bank.render(mix, block, nullptr);
+    }
+    uint32_t cycles = platformCycleCount() - start;
+    benchSink = mix[0];
+    printStage(curveNames[c], cycles, benchFrames * 8);
+  }
+  bank.setEnvelope(DEFAULT_ENV_ATTACK_MS, DEFAULT_ENV_DECAY_MS, DEFAULT_ENV_SUSTAIN,
+                   DEFAULT_ENV_RELEASE_MS, ENV_CURVE_LINEAR);
+  
+  {
+    // Full bank, per voice-sample
+    bank.reset(MAX_VOICES, WAVE_SAWTOOTH);
+    for (uint8_t v = 0; v < MAX_VOICES; v++) {
+      bank.noteOn(v, NOTE_C3 + v, 127);
+    }
+    
+    uint32_t start = platformCycleCount();
+    for (uint32_t done = 0; done < benchFrames; done += block) {
+      memset(mix, 0, sizeof(mix));
+      bank.render(mix, block, nullptr);
+    }
+    uint32_t cycles = platformCycleCount() - start;
+    benchSink = mix[0];
+    char name[32];
+    snprintf(name, sizeof(name), "VoiceBank %u saws (per voice)", MAX_VOICES);
+    printStage(name, cycles, benchFrames * MAX_VOICES);
+    
+    // Same, each through its own filter: 1 kHz lowpass, 3 octaves of
+    // envelope, so every voice gets a coefficient set per segment
+    SvfControl filter;
+    filter.type = FILTER_LOWPASS;
+    filter.pitch = filter.pitchEnd = SvfCoefficients::pitch(1000.0f, BENCH_REF_RATE);
+    filter.damping = filter.dampingEnd = SvfCoefficients::damping(0.5f);
+    filter.envDepth = 3 << SVF_PITCH_BITS;
+    
+    start = platformCycleCount();
+    for (uint32_t done = 0; done < benchFrames; done += block) {
+      memset(mix, 0, sizeof(mix));
+      bank.render(mix, block, nullptr, &filter);
+    }
+    cycles = platformCycleCount() - start;
+    benchSink = mix[0];
+    snprintf(name, sizeof(name), "VoiceBank %u saws + voice SVF", MAX_VOICES);
+    printStage(name, cycles, benchFrames * MAX_VOICES);
+  }
+  
+  {
+    // 1 kHz lowpass, one channel at the bus guard, held coefficients
+    StateVariableFilter svf;
+    SvfCoefficients c = SvfCoefficients::fromPitch(SvfCoefficients::pitch(1000.0f, BENCH_REF_RATE),
+                                                   SvfCoefficients::damping(0.5f));
+    int32_t block[BENCH_MAX_BLOCK];
+    uint32_t cycles = 0;
+    int32_t acc = 0;
+    
+    // Per sample, in blocks; the refill is not timed
+    for (uint32_t done = 0; done < benchFrames; done += BENCH_MAX_BLOCK) {
+      for (uint32_t i = 0; i < BENCH_MAX_BLOCK; i++) {
+        block[i] = input16[(done + i) & (BENCH_INPUT_SIZE - 1)];
+      }
+      uint32_t start = platformCycleCount();
+      svf.process(FILTER_LOWPASS, c, block, BENCH_MAX_BLOCK, 1, SVF_BUS_GUARD_BITS);
+      cycles += platformCycleCount() - start;
+      acc += block[0];
+    }
+    benchSink = acc;
+    printStage("StateVariableFilter::process", cycles, benchFrames);
+  }
+  
+  {
+    // Coefficient set from a pitch (table read + one 64-bit divide), as
+    // per SVF_CONTROL_FRAMES while sweeping
+    int32_t damping = SvfCoefficients::damping(0.5f);
+    int32_t acc = 0;
+    const uint32_t sets = benchFrames / SVF_CONTROL_FRAMES;
+    
+    uint32_t start = platformCycleCount();
+    for (uint32_t i = 0; i < sets; i++) {
+      int32_t pitch = SVF_PITCH_MIN + (int32_t)((i * 40503u) % (uint32_t)(SVF_PITCH_MAX - SVF_PITCH_MIN));
+      acc += SvfCoefficients::fromPitch(pitch, damping).a1;
+    }
+    uint32_t cycles = platformCycleCount() - start;
+    benchSink = acc;
+    printStage("SvfCoefficients::fromPitch", cycles, sets);
+  }
+  
+  {
+    // +6 dB peak at 1 kHz, one section, guarded input as in the cascade
+    BiquadSection bq;
+    bq.setTarget(BiquadCoefficients::design(BIQUAD_PEAK, 1000.0f, 6.0f, 1.0f, BENCH_REF_RATE), 1);
+    int32_t block[BENCH_MAX_BLOCK * 2];
+    uint32_t cycles = 0;
+    int32_t acc = 0;
+    
+    // Per stereo frame, in blocks; the refill is not timed
+    for (uint32_t done = 0; done < benchFrames; done += BENCH_MAX_BLOCK) {
+      for (uint32_t i = 0; i < BENCH_MAX_BLOCK * 2; i++) {
+        block[i] = input16[(done * 2 + i) & (BENCH_INPUT_SIZE - 1)] * (1 << EQ_GUARD_BITS);
+      }
+      uint32_t start = platformCycleCount();
+      bq.process(block, BENCH_MAX_BLOCK);
+      cycles += platformCycleCount() - start;
+      acc += block[0];
+    }
+    benchSink = acc;
+    printStage("BiquadSection::process", cycles, benchFrames);
+  }
+  
+  {
+    FdnReverb rev;
+    if (rev.init(BENCH_REF_RATE)) {
+      rev.setParams(FdnReverb::design(0.5f, 0.5f, BENCH_REF_RATE));
+      int32_t block[BENCH_MAX_BLOCK * 2];
+      uint32_t cycles = 0;
+      int32_t acc = 0;
+      
+      // Per stereo frame, in blocks; the refill is not timed
+      for (uint32_t done = 0; done < benchFrames; done += BENCH_MAX_BLOCK) {
+        for (uint32_t i = 0; i < BENCH_MAX_BLOCK * 2; i++) {
+          block[i] = input16[(done * 2 + i) & (BENCH_INPUT_SIZE - 1)];
+        }
+        uint32_t start = platformCycleCount();
+        rev.process(block, BENCH_MAX_BLOCK, 1365, 1365);
+        cycles += platformCycleCount() - start;
+        acc += block[0];
+      }
+      benchSink = acc;
+      printStage("FdnReverb::process", cycles, benchFrames);
+      rev.deinit();
+    } else {
+      Serial.println(F("  FdnReverb::process            (allocation failed)"));
+    }
+  }
+}
+
+// ============================================================================
+// RESAMPLER
+// ============================================================================
+
+void AudioBenchmark::runResampler() {
+  printHeader("AudioResampler 44100 -> 22050 (per output sample)");
+  
+  static const ResampleQuality qualities[] = { RESAMPLE_NONE, RESAMPLE_FAST, RESAMPLE_MEDIUM,
+                                               RESAMPLE_HIGH, RESAMPLE_BEST };
+  static const char* names[] = { "resample none", "resample fast (linear)",
+                                 "resample medium (cubic)", "resample high (cubic)",
+                                 "resample best (lanczos)" };
+  
+  int16_t output[BENCH_INPUT_SIZE / 2];
+  
+  for (int q = 0; q < 5; q++) {
+    AudioResampler resampler;
+    resampler.init(44100, 22050, qualities[q]);
+    
+    uint32_t produced = 0;
+    uint32_t start = platformCycleCount();
+    while (produced < benchFrames) {
+      produced += resampler.resampleBuffer(input16, BENCH_INPUT_SIZE, output, BENCH_INPUT_SIZE / 2);
+    }
+    uint32_t cycles = platformCycleCount() - start;
+    benchSink = output[0];
+    printStage(names[q], cycles, produced);
+  }
+}
+
+// ============================================================================
+// ENGINE HELPERS
+// ============================================================================
+
+// Lets every voice finish its release so the next run starts from silence
+static void benchSilence(AudioEngine& engine, int16_t* out) {
+  engine.allNotesOff();
+  for (int guard = 0; engine.getActiveVoices() > 0 && guard < 10000; guard++) {
+    engine.renderBlock(out, BENCH_MAX_BLOCK);
+  }
+}
+
+// Starts 'voices' notes and renders past attack/decay into sustain
+static void benchStartVoices(AudioEngine& engine, uint8_t voices, int16_t* out) {
+  benchSilence(engine, out);
+  for (uint8_t v = 0; v < voices; v++) {
+    engine.noteOn(NOTE_C3 + (v * 5) % 48, 127);
+  }
+  const EnvelopeConfig& env = engine.getEnvelope();
+  uint32_t settle = (uint32_t)(env.attackMs + env.decayMs) * engine.getSettings()->sampleRate / 1000;
+  for (uint32_t i = 0; i < settle + BENCH_MAX_BLOCK; i += BENCH_MAX_BLOCK) {
+    engine.renderBlock(out, BENCH_MAX_BLOCK);
+  }
+}
+
+static uint32_t benchRender(AudioEngine& engine, uint32_t block, uint32_t frames, int16_t* out) {
+  uint32_t start = platformCycleCount();
+  for (uint32_t done = 0; done < frames; done += block) {
+    engine.renderBlock(out, block);
+  }
+  return platformCycleCount() - start;
+}
+
+static void benchSetEffects(AudioEngine& engine, bool on) {
+  engine.setFilterEnabled(on);
+  engine.setFilterPerVoice(false);
+  engine.setEQ(on ? 6 : 0, on ? -3 : 0, on ? 4 : 0);
+  engine.setEQEnabled(on);
+  engine.setReverbEnabled(on);
+  engine.setDelayEnabled(on);
+  engine.setChorusEnabled(on);
+  engine.setFlangerEnabled(on);
+  engine.setLFOEnabled(on);
+  engine.setLFOVibratoEnabled(on);
+  engine.setConvolverEnabled(on);
+  engine.setCompressorEnabled(on);
+  engine.setLimiterEnabled(on);
+}
+
+// ============================================================================
+// EFFECT CHAIN (per-stage cost inside renderBlock)
+// ============================================================================
+
+void AudioBenchmark::runEffectChain() {
+  printHeader("Effect stages in renderBlock (4 voices, 128 frames)");
+  
+  AudioSettings settings;
+  settings.sampleRate = BENCH_REF_RATE;
+  settings.voices = MAX_VOICES;
+  settings.performance.i2sBufferSize = BENCH_MAX_BLOCK;
+  
+  AudioEngine engine;
+  if (!engine.init(&settings, false)) return;
+  
+  static int16_t out[BENCH_MAX_BLOCK * 2];
+  const uint32_t block = 128;
+  
+  // Full-length IR: the bench noise under a 60 dB decay
+  static int16_t ir[CONV_MAX_IR_LENGTH];
+  for (uint32_t i = 0; i < CONV_MAX_IR_LENGTH; i++) {
+    float decay = expf(-6.9f * i / CONV_MAX_IR_LENGTH);
+    ir[i] = (int16_t)(input16[i % BENCH_INPUT_SIZE] * decay);
+  }
+  engine.loadImpulseResponse(ir, CONV_MAX_IR_LENGTH, "bench");
+  
+  benchSetEffects(engine, false);
+  benchStartVoices(engine, 4, out);
+  uint32_t dry = benchRender(engine, block, benchFrames, out);
+  printStage("dry (voices + mix)", dry, benchFrames);
+  
+  struct { const char* name; int id; } stages[] = {
+    { "+ LFO vibrato", 0 }, { "+ SVF filter (bus)", 1 }, { "+ SVF filter (per voice)", 10 },
+    { "+ EQ (3 bands)", 2 }, { "+ reverb", 3 }, { "+ delay line", 4 },
+    { "+ chorus (3 voices)", 6 }, { "+ flanger", 7 }, { "+ convolver (2048 taps)", 9 },
+    { "+ compressor", 8 }, { "+ limiter", 5 }
+  };
+  
+  for (int s = 0; s < 11; s++) {
+    benchSetEffects(engine, false);
+    switch (stages[s].id) {
+      case 0: engine.setLFOEnabled(true); engine.setLFOVibratoEnabled(true); break;
+      case 1: engine.setFilterEnabled(true); break;
+      case 10: engine.setFilterPerVoice(true); engine.setFilterEnabled(true); break;
+      case 2: engine.setEQ(6, -3, 4); engine.setEQEnabled(true); break;
+      case 3: engine.setReverbEnabled(true); break;
+      case 4: engine.setDelayEnabled(true); break;
+      case 5: engine.setLimiterEnabled(true); break;
+      case 6: engine.setChorusEnabled(true); break;
+      case 7: engine.setFlangerEnabled(true); break;
+      case 8: engine.setCompressorEnabled(true); break;
+      case 9: engine.setConvolverEnabled(true); break;
+    }
+    
+    benchStartVoices(engine, 4, out);
+    uint32_t cycles = benchRender(engine, block, benchFrames, out);
+    uint32_t delta = (cycles > dry) ? cycles - dry : 0;
+    printStage(stages[s].name, delta, benchFrames);
+  }
+  
+  engine.deinit();
+}
+
+// ============================================================================
+// FULL ENGINE SWEEP
+// ============================================================================
+
+void AudioBenchmark::runEngine() {
+  static int16_t out[BENCH_MAX_BLOCK * 2];
+  
+  for (int fx = 0; fx < 2; fx++) {
+    for (uint32_t r = 0; r < BENCH_NUM_RATES; r++) {
+      AudioSettings settings;
+      settings.sampleRate = benchRates[r];
+      settings.voices = MAX_VOICES;
+      settings.performance.i2sBufferSize = BENCH_MAX_BLOCK;
+      
+      AudioEngine engine;
+      if (!engine.init(&settings, false)) continue;
+      benchSetEffects(engine, fx == 1);
+      
+      float ns[BENCH_NUM_BLOCKS][BENCH_NUM_VOICES];
+      for (uint32_t v = 0; v < BENCH_NUM_VOICES; v++) {
+        for (uint32_t b = 0; b < BENCH_NUM_BLOCKS; b++) {
+          benchStartVoices(engine, benchVoices[v], out);
+          uint32_t cycles = benchRender(engine, benchBlocks[b], benchFrames, out);
+          ns[b][v] = nsPerSample(cycles, benchFrames);
+        }
+      }
+      engine.deinit();
+      
+      char title[64];
+      snprintf(title, sizeof(title), "renderBlock %s @ %u Hz (ns/sample)",
+               fx ? "all effects" : "dry", benchRates[r]);
+      printHeader(title);
+      
+      Serial.print("  block  ");
+      for (uint32_t v = 0; v < BENCH_NUM_VOICES; v++) Serial.printf("  %2u voices", benchVoices[v]);
+      Serial.printf("  load@%-3u voices/core\n", benchVoices[BENCH_NUM_VOICES - 1]);
+      
+      float budgetNs = 1.0e9f / benchRates[r];
+      for (uint32_t b = 0; b < BENCH_NUM_BLOCKS; b++) {
+        Serial.printf("  %5u  ", benchBlocks[b]);
+        for (uint32_t v = 0; v < BENCH_NUM_VOICES; v++) Serial.printf(" %9.1f", ns[b][v]);
+        
+        // Linear fit: base cost (no voices) + per-voice slope
+        float base = ns[b][0];
+        float perVoice = (ns[b][BENCH_NUM_VOICES - 1] - ns[b][1]) /
+                         (benchVoices[BENCH_NUM_VOICES - 1] - benchVoices[1]);
+        float maxVoices = perVoice > 0.0f ? (budgetNs - base) / perVoice : 0.0f;
+        Serial.printf("  %5.1f%%   %8.0f\n",
+                      ns[b][BENCH_NUM_VOICES - 1] / budgetNs * 100.0f, maxVoices);
+      }
+    }
+  }
+}
+
+#endif // ENABLE_BENCHMARK
@@ -0,0 +1,47 @@
+// AudioBenchmark.h - ESP32 Audio OS v2.0
+// Render-loop microbenchmarks (per-stage ns/sample, voices-per-core headroom)
+//
+// Runs on target ('audio bench') and on the host (host/build/audio_bench).
+// Timing uses platformCycleCount(), so target figures are real CPU cycles.
+
+#ifndef AUDIO_BENCHMARK_H
+#define AUDIO_BENCHMARK_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+
+#if ENABLE_BENCHMARK
+
+#define BENCH_DEFAULT_FRAMES    8192
+#define BENCH_INPUT_SIZE        1024
+#define BENCH_ALIAS_SIZE        1024    // DFT length for the aliasing figure
+#define BENCH_ALIAS_NOTE        96      // C7, 2093 Hz: well into aliasing at 22 kHz
+
+class AudioBenchmark {
+public:
+  AudioBenchmark();
+  
+  // Frames rendered per measurement (more = steadier figures, longer run)
+  void setFrames(uint32_t frames) { benchFrames = frames; }
+  
+  void runAll();
+  void runStages();       // VoiceBank, SVF, Biquad, Reverb
+  void runOscillators();  // Naive vs wavetable vs PolyBLEP: cost and aliasing
+  void runResampler();    // Every AudioResampler quality mode
+  void runEngine();       // Full renderBlock: voices x block sizes x sample rates
+  void runEffectChain();  // Per-effect cost inside the engine (incl. delay line)
+  
+private:
+  uint32_t benchFrames;
+  int16_t input16[BENCH_INPUT_SIZE];
+  
+  void fillInput();
+  float nsPerSample(uint32_t cycles, uint32_t samples);
+  void printHeader(const char* title);
+  void printStage(const char* name, uint32_t cycles, uint32_t samples);
+  float aliasRatioDb(const float* signal, float* cosTable, float f0);
+};
+
+#endif // ENABLE_BENCHMARK
+
+#endif // AUDIO_BENCHMARK_H
@@ -0,0 +1,162 @@
+// AudioCommandQueue.h - ESP32 Audio OS v2.0
+// Lock-free single-producer/single-consumer queue of control events
+//
+// The control side (console, melody player, loop) posts commands; the audio
+// task drains them at the start of every block and is the only code that
+// touches voice and DSP state. head is written only by the producer and tail
+// only by the consumer, so a release store paired with an acquire load is
+// all the synchronization needed: no locks in the render path.
+//
+// Parameter sets too large for a command (filter coefficients) go through a
+// SnapshotBuffer instead: computed off the audio task, published whole.
+
+#ifndef AUDIO_COMMAND_QUEUE_H
+#define AUDIO_COMMAND_QUEUE_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+#include <atomic>
+
+static_assert((AUDIO_COMMAND_QUEUE_SIZE & (AUDIO_COMMAND_QUEUE_SIZE - 1)) == 0,
+              "AUDIO_COMMAND_QUEUE_SIZE must be a power of two");
+
+// ============================================================================
+// COMMANDS (each carries the complete state of its parameter group)
+// ============================================================================
+enum AudioCommandType : uint8_t {
+  CMD_NOTE_ON,          // a = note, b = velocity, c = pan
+  CMD_NOTE_OFF,         // a = note
+  CMD_ALL_NOTES_OFF,
+  CMD_VOLUME,           // a = volume
+  CMD_WAVEFORM,         // a = WaveformType
+  CMD_OSCILLATOR,       // a = OscillatorMode
+  CMD_VOICE_STEAL,      // a = VoiceStealPolicy
+  CMD_ENVELOPE,         // u16[0..2] = attack/decay/release ms, a = sustain, b = curve
+  CMD_EQ,               // a = enabled (bands arrive as coefficients)
+  CMD_FILTER,           // a = enabled, b = FilterType, c = per voice, f[0] = cutoff,
+                        // f[1] = resonance, f[2] = envelope depth (octaves)
+  CMD_CONVOLVER,        // a = enabled, b = mix (the IR arrives by pointer handoff)
+  CMD_REVERB,           // a = enabled, f[0] = room size, f[1] = damping, f[2] = wet
+  CMD_LFO,              // a = enabled, b = vibrato, c = tremolo, f[0] = rate, f[1] = depth
+  CMD_DELAY,            // a = enabled, b = feedback, c = mix, u16[0] = time ms,
+                        // f[1] = mod rate, f[2] = mod depth ms
+  CMD_CHORUS,           // a = enabled, b = voices, c = mix,
+                        // f[0] = rate, f[1] = delay ms, f[2] = depth ms
+  CMD_FLANGER,          // a = enabled, b = feedback (int8_t), c = mix,
+                        // f[0] = rate, f[1] = delay ms, f[2] = depth ms
+  CMD_COMPRESSOR,       // a = enabled (parameters arrive as a snapshot)
+  CMD_LIMITER           // a = enabled, f[0] = ceiling dB, f[1] = release ms
+};
+
+struct AudioCommand {
+  uint32_t frame;       // Engine sample clock when posted
+  AudioCommandType type;
+  uint8_t a, b, c;
+  union {
+    float f[3];
+    uint16_t u16[6];
+    int8_t s8[12];
+  };
+
+  explicit AudioCommand(AudioCommandType t = CMD_ALL_NOTES_OFF)
+    : frame(0), type(t), a(0), b(0), c(0) {
+    f[0] = f[1] = f[2] = 0.0f;
+  }
+};
+
+// ============================================================================
+// SPSC RING
+// ============================================================================
+class AudioCommandQueue {
+public:
+  AudioCommandQueue() : head(0), tail(0), dropped(0) {}
+
+  // Producer side. Returns false (and counts a drop) when the ring is full.
+  bool push(const AudioCommand& cmd) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= AUDIO_COMMAND_QUEUE_SIZE) {
+      dropped++;
+      return false;
+    }
+    slots[h & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = cmd;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Producer side: the consumer can only make room, never take it
+  bool full() const {
+    return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) >=
+           AUDIO_COMMAND_QUEUE_SIZE;
+  }
+
+  // Consumer side
+  bool pop(AudioCommand& cmd) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    cmd = slots[t & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Only while neither side is running (init/deinit)
+  void clear() {
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    dropped = 0;
+  }
+
+  uint32_t getDropped() const { return dropped; }
+
+private:
+  AudioCommand slots[AUDIO_COMMAND_QUEUE_SIZE];
+  std::atomic<uint32_t> head;     // Next slot to write (producer)
+  std::atomic<uint32_t> tail;     // Next slot to read (consumer)
+  uint32_t dropped;               // Producer only
+};
+
+// ============================================================================
+// DOUBLE-BUFFERED SNAPSHOT
+// ============================================================================
+// Two copies of T. The producer fills the one the consumer is not reading and
+// publishes it with a single pointer exchange; the consumer takes it at its
+// next block. A snapshot the consumer never took is reclaimed and refilled,
+// so the consumer only ever sees complete sets and never waits.
+template <class T>
+class SnapshotBuffer {
+public:
+  SnapshotBuffer() : pending(nullptr), published(&slots[0]), editing(&slots[1]) {}
+
+  // Producer side: the free copy. Fill it completely, then publish().
+  T& edit() {
+    T* slot = pending.exchange(nullptr, std::memory_order_acq_rel);
+    if (!slot) slot = (published == &slots[0]) ? &slots[1] : &slots[0];
+    editing = slot;
+    return *slot;
+  }
+
+  void publish() {
+    published = editing;
+    pending.store(editing, std::memory_order_release);
+  }
+
+  // Consumer side: the newest published copy, or nullptr if none since the
+  // last call. Valid until the next call.
+  const T* acquire() {
+    return pending.exchange(nullptr, std::memory_order_acq_rel);
+  }
+
+  // Only while neither side is running (init/deinit)
+  void clear() {
+    pending.store(nullptr, std::memory_order_relaxed);
+    published = &slots[0];
+    editing = &slots[1];
+  }
+
+private:
+  T slots[2];
+  std::atomic<T*> pending;        // Published, not yet taken by the consumer
+  T* published;                   // Producer only: last copy handed over
+  T* editing;                     // Producer only
+};
+
+#endif // AUDIO_COMMAND_QUEUE_H
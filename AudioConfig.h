@@ -4,7 +4,7 @@
 #ifndef AUDIO_CONFIG_H
 #define AUDIO_CONFIG_H
 
-#include <Arduino.h>
+#include "AudioPlatform.h"
 
 // ============================================================================
 // VERSION INFORMATION
@@ -53,19 +53,24 @@
 // ============================================================================
 #define USE_FIXED_POINT_MATH    1
 #define USE_WAVETABLE_LOOKUP    1
-#define WAVETABLE_SIZE          512
+#define WAVETABLE_BITS          9
+#define WAVETABLE_SIZE          (1 << WAVETABLE_BITS)
+#define USE_BANDLIMITED_TABLES  1       // Compile in AudioWavetables (27 KB flash)
 
 // ============================================================================
 // DEFAULT VALUES (Used by AudioSettings.h constructors)
 // ============================================================================
 #define DEFAULT_SAMPLE_RATE         22050
 #define DEFAULT_MAX_VOICES          4
+#define DEFAULT_VOICE_STEAL         3       // 0 = oldest, 1 = quietest, 2 = releasing, 3 = same note
 #define DEFAULT_VOLUME              200
+#define DEFAULT_PAN_SPREAD          50      // Keyboard pan width, 0 = all voices centered
 
 #define DEFAULT_I2S_PIN             1
 #define DEFAULT_I2S_BUFFER          128
 #define DEFAULT_I2S_BUFFERS         4
 #define DEFAULT_I2S_AMPLITUDE       12000
+#define I2S_EVENT_QUEUE_SIZE        8
 
 #define DEFAULT_PWM_PIN             2
 #define DEFAULT_PWM_FREQUENCY       78125
@@ -82,29 +87,72 @@
 #define DEFAULT_FILTER_TYPE         0
 #define DEFAULT_FILTER_CUTOFF       1000.0f
 #define DEFAULT_FILTER_RESONANCE    0.1f
+#define DEFAULT_FILTER_PER_VOICE    false
+#define DEFAULT_FILTER_ENV_DEPTH    3.0f    // Octaves at full envelope (per-voice mode)
 
 #define DEFAULT_REVERB_ENABLED      false
 #define DEFAULT_REVERB_ROOM_SIZE    0.5f
 #define DEFAULT_REVERB_DAMPING      0.5f
 #define DEFAULT_REVERB_WET          0.33f
 
+#define DEFAULT_CONV_ENABLED        false
+#define DEFAULT_CONV_MIX            100     // %, wet share
+
 #define DEFAULT_LFO_ENABLED         false
 #define DEFAULT_LFO_VIBRATO_ENABLED false
 #define DEFAULT_LFO_TREMOLO_ENABLED false
 #define DEFAULT_LFO_RATE            5.0f
 #define DEFAULT_LFO_DEPTH           20.0f
 
+#define DEFAULT_ENV_ATTACK_MS       20
+#define DEFAULT_ENV_DECAY_MS        40
+#define DEFAULT_ENV_SUSTAIN         200     // 0-255
+#define DEFAULT_ENV_RELEASE_MS      80
+#define DEFAULT_ENV_CURVE           0       // 0 = linear, 1 = exponential
+
 #define DEFAULT_DELAY_ENABLED       false
 #define DEFAULT_DELAY_TIME          250
 #define DEFAULT_DELAY_FEEDBACK      50
 #define DEFAULT_DELAY_MIX           30
+#define DEFAULT_DELAY_MOD_RATE      0.8f    // Hz
+#define DEFAULT_DELAY_MOD_DEPTH     0.0f    // ms, 0 = no wow
+
+#define DEFAULT_CHORUS_ENABLED      false
+#define DEFAULT_CHORUS_VOICES       3
+#define DEFAULT_CHORUS_RATE         0.6f    // Hz
+#define DEFAULT_CHORUS_DELAY_MS     12.0f   // Center of the sweep
+#define DEFAULT_CHORUS_DEPTH_MS     3.0f    // Sweep either side of the center
+#define DEFAULT_CHORUS_MIX          50
+
+#define DEFAULT_FLANGER_ENABLED     false
+#define DEFAULT_FLANGER_RATE        0.25f   // Hz
+#define DEFAULT_FLANGER_DELAY_MS    2.5f
+#define DEFAULT_FLANGER_DEPTH_MS    2.0f
+#define DEFAULT_FLANGER_FEEDBACK    50      // %, negative inverts the feedback
+#define DEFAULT_FLANGER_MIX         50
+
+#define DEFAULT_COMP_ENABLED        false
+#define DEFAULT_COMP_THRESHOLD_DB   -12.0f
+#define DEFAULT_COMP_RATIO          4.0f
+#define DEFAULT_COMP_ATTACK_MS      5.0f
+#define DEFAULT_COMP_RELEASE_MS     120
+#define DEFAULT_COMP_MAKEUP_DB      0.0f
+
+#define DEFAULT_LIMITER_ENABLED     true
+#define DEFAULT_LIMITER_CEILING_DB  -1.0f
+#define DEFAULT_LIMITER_RELEASE_MS  100
 
 // ============================================================================
 // SYSTEM LIMITS
 // ============================================================================
 #define MAX_CODEC_PLUGINS       16
 #define MAX_AUDIO_FILES         128
-#define MAX_VOICES              8
+#define MAX_VOICES              32      // Voice bank size (fits the 32-bit voice mask)
+#define VOICE_STEAL_FADE_MS     2       // Fade-out of a stolen voice before its new note
+#define PARAM_SMOOTH_MS         20      // Volume, cutoff, reverb wet and EQ ramps
+#define PARAM_SMOOTH_FRAMES     16      // EQ coefficients step this often while ramping
+#define AUDIO_COMMAND_QUEUE_SIZE 64     // Control -> audio task events (power of two)
+#define AUDIO_COMMAND_RETRY_MS  20      // Note-offs wait this long for a full queue
 #define JSON_DOC_SIZE           4096
 #define SERIAL_BAUD_RATE        115200
 #define CONSOLE_BUFFER_SIZE     256
@@ -137,35 +185,115 @@
 // ============================================================================
 // ENVELOPE PARAMETERS
 // ============================================================================
-#define ENV_ATTACK_SAMPLES      441
-#define ENV_DECAY_SAMPLES       882
-#define ENV_RELEASE_SAMPLES     1764
-#define ENV_SUSTAIN_LEVEL       200
+#define ENV_TIME_MIN_MS         1
+#define ENV_TIME_MAX_MS         10000
+#define ENV_CONTROL_FRAMES      32      // Exponential curves: one rate per segment
+#define ENV_CONTROL_SHIFT       5       // log2(ENV_CONTROL_FRAMES)
+#define ENV_ATTACK_OVERSHOOT    0.3f    // Exponential attack aims 30% past full
+#define ENV_DECAY_OVERSHOOT     0.001f  // Decay/release aim 0.1% (-60 dB) past the end
 
 // ============================================================================
 // EFFECT BUFFER SIZES
 // ============================================================================
 #define MAX_DELAY_TIME          1000
-#define DELAY_BUFFER_SIZE       44100
+#define DELAY_MOD_DEPTH_MAX     10      // ms, on top of MAX_DELAY_TIME
+#define DELAY_MOD_RATE_MIN      0.1f
+#define DELAY_MOD_RATE_MAX      10.0f
+#define DELAY_FRAC_BITS         12      // Fractional read position
+#define DELAY_GLIDE_MS          150     // Time changes glide like a tape transport
+#define DELAY_TAP_COUNT         4       // Tap tempo averages the last intervals
+#define DELAY_TAP_TIMEOUT_MS    2000    // A longer gap starts a new tap sequence
+
+#define MOD_DELAY_MAX_TAPS      3       // Chorus voices
+#define CHORUS_VOICES_MIN       2
+#define CHORUS_VOICES_MAX       MOD_DELAY_MAX_TAPS
+#define CHORUS_DELAY_MIN_MS     5.0f
+#define CHORUS_DELAY_MAX_MS     30.0f
+#define CHORUS_DEPTH_MAX_MS     10.0f   // Limited to the delay itself
+#define CHORUS_RATE_MIN         0.05f
+#define CHORUS_RATE_MAX         5.0f
+#define FLANGER_DELAY_MIN_MS    0.5f
+#define FLANGER_DELAY_MAX_MS    10.0f
+#define FLANGER_DEPTH_MAX_MS    5.0f    // Limited to the delay itself
+#define FLANGER_RATE_MIN        0.05f
+#define FLANGER_RATE_MAX        5.0f
+#define FLANGER_FEEDBACK_MAX    90      // Either sign
+#define FLANGER_STEREO_PHASE    0x40000000u     // Right sweep a quarter cycle ahead
 
-#define REVERB_COMB1_DELAY      1116
-#define REVERB_COMB2_DELAY      1188
-#define REVERB_COMB3_DELAY      1277
-#define REVERB_COMB4_DELAY      1356
-#define REVERB_ALLPASS1_DELAY   556
-#define REVERB_ALLPASS2_DELAY   441
-#define REVERB_BUFFER_SIZE      (REVERB_COMB1_DELAY + REVERB_COMB2_DELAY + \
-                                 REVERB_COMB3_DELAY + REVERB_COMB4_DELAY + \
-                                 REVERB_ALLPASS1_DELAY + REVERB_ALLPASS2_DELAY)
+// FDN reverb: four feedback lines behind four input diffusers. Lengths are
+// samples at REVERB_REF_RATE and scale with the sample rate; all are prime.
+#define REVERB_REF_RATE         44100
+#define REVERB_LINE1_DELAY      1327
+#define REVERB_LINE2_DELAY      1559
+#define REVERB_LINE3_DELAY      1801
+#define REVERB_LINE4_DELAY      2053
+#define REVERB_DIFFUSER1_DELAY  211
+#define REVERB_DIFFUSER2_DELAY  157
+#define REVERB_DIFFUSER3_DELAY  563
+#define REVERB_DIFFUSER4_DELAY  409
+#define REVERB_REF_SIZE         (REVERB_LINE1_DELAY + REVERB_LINE2_DELAY + \
+                                 REVERB_LINE3_DELAY + REVERB_LINE4_DELAY + \
+                                 REVERB_DIFFUSER1_DELAY + REVERB_DIFFUSER2_DELAY + \
+                                 REVERB_DIFFUSER3_DELAY + REVERB_DIFFUSER4_DELAY)
+#define REVERB_RT60_MIN         0.4f    // Seconds at room size 0
+#define REVERB_RT60_MAX         8.0f    // Seconds at room size 1
+#define REVERB_DAMPING_MAX      0.8f    // Loop lowpass pole at damping 1
+#define REVERB_DIFFUSION        0.625f  // Input allpass coefficient
+#define REVERB_INPUT_SHIFT      3       // Channel sum / 8 into the lines
+#define REVERB_CHUNK_FRAMES     64      // Diffused input staged on the stack
+
+// ============================================================================
+// CONVOLVER PARAMETERS
+// ============================================================================
+#define CONV_MAX_IR_LENGTH      2048    // Taps at the engine rate; longer IRs are cut
+#define CONV_DIRECT_MAX_TAPS    32      // Up to here a direct FIR beats the FFT
+#define CONV_MIN_PARTITION      32      // FFT partition = I2S block, power of two,
+#define CONV_MAX_PARTITION      512     // within these bounds
+#define CONV_FILE_MAX           64      // IR path length, with the terminator
+
+// ============================================================================
+// COMPRESSOR PARAMETERS
+// ============================================================================
+#define COMP_THRESHOLD_MIN_DB   -48.0f
+#define COMP_THRESHOLD_MAX_DB   0.0f
+#define COMP_RATIO_MIN          1.0f
+#define COMP_RATIO_MAX          20.0f   // 20:1 behaves as a limiter
+#define COMP_ATTACK_MIN_MS      0.1f
+#define COMP_ATTACK_MAX_MS      200.0f
+#define COMP_RELEASE_MIN_MS     10
+#define COMP_RELEASE_MAX_MS     2000
+#define COMP_MAKEUP_MAX_DB      24.0f
+#define COMP_SEGMENT_FRAMES     16      // Detector and gain run once per segment
+#define COMP_SEGMENT_SHIFT      4       // log2(COMP_SEGMENT_FRAMES)
+#define COMP_LEVEL_BITS         10      // Levels are log2 in Q10
+#define COMP_TABLE_BITS         6       // log2/exp2 table entries per octave
+#define COMP_TABLE_SIZE         (1 << COMP_TABLE_BITS)
+
+// ============================================================================
+// LIMITER PARAMETERS
+// ============================================================================
+#define LIMITER_CEILING_MIN_DB  -24.0f
+#define LIMITER_CEILING_MAX_DB  0.0f
+#define LIMITER_RELEASE_MIN_MS  10
+#define LIMITER_RELEASE_MAX_MS  2000
+#define LIMITER_SEGMENT_FRAMES  16      // Gain planned once per segment
+#define LIMITER_SEGMENT_SHIFT   4       // log2(LIMITER_SEGMENT_FRAMES)
+#define LIMITER_LOOKAHEAD_FRAMES (2 * LIMITER_SEGMENT_FRAMES)
 
 // ============================================================================
 // EQ PARAMETERS
 // ============================================================================
-#define EQ_BASS_FREQ            120
-#define EQ_MID_FREQ             1000
-#define EQ_TREBLE_FREQ          8000
+#define EQ_MAX_BANDS            8       // Biquad sections in the cascade
+#define EQ_BASS_FREQ            120     // Band 0, low shelf
+#define EQ_MID_FREQ             1000    // Band 1, peak
+#define EQ_TREBLE_FREQ          8000    // Band 2, high shelf
 #define EQ_Q_FACTOR             0.707f
+#define EQ_MIN_Q                0.3f
+#define EQ_MAX_Q                10.0f
+#define EQ_MIN_FREQ             20
 #define EQ_MAX_GAIN_DB          12
+#define EQ_COEF_BITS            28      // Q28: every design within the limits above is under 8
+#define EQ_GUARD_BITS           4       // Bus headroom and extra resolution inside the cascade
 
 // ============================================================================
 // FILTER PARAMETERS
@@ -174,6 +302,24 @@
 #define FILTER_CUTOFF_MAX       20000.0f
 #define FILTER_RESONANCE_MIN    0.0f
 #define FILTER_RESONANCE_MAX    0.99f
+#define FILTER_ENV_DEPTH_MAX    8.0f    // Octaves, either direction
+
+// TPT state-variable filter: the cutoff travels as a pitch, log2(cutoff /
+// sample rate) in 1/4096 octave, and g = tan(pi * cutoff / rate) comes from
+// a table over that pitch (2^SVF_TAN_STEP_BITS steps per octave, linear
+// between)
+#define SVF_PITCH_BITS          12
+#define SVF_TAN_STEP_BITS       5
+#define SVF_TAN_MIN_OCTAVE      (-15)   // Table starts at rate / 32768
+#define SVF_TAN_TABLE_SIZE      ((-1 - SVF_TAN_MIN_OCTAVE) * (1 << SVF_TAN_STEP_BITS) + 2)
+#define SVF_PITCH_MIN           (SVF_TAN_MIN_OCTAVE * (1 << SVF_PITCH_BITS))
+#define SVF_PITCH_MAX           (-4719) // log2(SVF_MAX_RATIO) in pitch units
+#define SVF_MAX_RATIO           0.45f   // Highest cutoff / sample rate
+#define SVF_MIN_DAMPING         0.01f   // 1 / Q at full resonance
+#define SVF_INPUT_LIMIT         (1L << 22)  // After the guard shift: states fit 32 bits
+#define SVF_CONTROL_FRAMES      16      // Coefficients recomputed this often while sweeping
+#define SVF_VOICE_GUARD_BITS    6       // Extra resolution inside a voice filter (16-bit input)
+#define SVF_BUS_GUARD_BITS      4       // Same for the bus filter (18-bit input)
 
 // ============================================================================
 // LFO PARAMETERS
@@ -182,12 +328,15 @@
 #define LFO_RATE_MAX            20.0f
 #define LFO_DEPTH_MIN           0.0f
 #define LFO_DEPTH_MAX           100.0f
+#define LFO_CONTROL_FRAMES      32      // LFO evaluated once per this many samples
 
 // ============================================================================
 // PERFORMANCE MONITORING
 // ============================================================================
 #define ENABLE_CPU_MONITOR      1
 #define CPU_MONITOR_INTERVAL    1000
+#define ENABLE_BENCHMARK        1
+#define XRUN_LOG_SIZE           8       // Last N xrun events kept
 
 // ============================================================================
 // COMPATIBILITY ALIASES
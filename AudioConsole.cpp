@@ -9,6 +9,7 @@
 #include "AudioProfile.h"
 #include "AudioFilesystem.h"
 #include "AudioCodecManager.h"
+#include "AudioBenchmark.h"
 #include <ArduinoJson.h>
 
 
@@ -151,8 +152,14 @@ void AudioConsole::processCommand(String cmd) {
     cmdVolume(remaining);
   } else if (command == "note") {
     cmdNote(remaining);
+  } else if (command == "pan") {
+    cmdPan(remaining);
   } else if (command == "waveform" || command == "wave") {
     cmdWaveform(remaining);
+  } else if (command == "oscillator" || command == "osc") {
+    cmdOscillator(remaining);
+  } else if (command == "steal") {
+    cmdSteal(remaining);
   } else if (command == "eq") {
     cmdEQ(remaining);
   } else if (command == "filter") {
@@ -161,8 +168,20 @@ void AudioConsole::processCommand(String cmd) {
     cmdReverb(remaining);
   } else if (command == "lfo") {
     cmdLFO(remaining);  // NEW!
+  } else if (command == "envelope" || command == "env" || command == "adsr") {
+    cmdEnvelope(remaining);
   } else if (command == "delay") {
     cmdDelay(remaining);
+  } else if (command == "chorus") {
+    cmdChorus(remaining);
+  } else if (command == "flanger" || command == "flange") {
+    cmdFlanger(remaining);
+  } else if (command == "convolver" || command == "conv") {
+    cmdConvolver(remaining);
+  } else if (command == "compressor" || command == "comp") {
+    cmdCompressor(remaining);
+  } else if (command == "limiter" || command == "limit") {
+    cmdLimiter(remaining);
   } else if (command == "profile") {
     cmdProfile(remaining);
   } else if (command == "mode") {
@@ -177,6 +196,10 @@ void AudioConsole::processCommand(String cmd) {
     cmdList(remaining);
   } else if (command == "test") {
     cmdTest(remaining);
+  } else if (command == "bench") {
+    cmdBench(remaining);
+  } else if (command == "xruns") {
+    cmdXruns(remaining);
   } else if (command == "reset") {
     cmdReset(remaining);
   } else if (command == "reboot") {
@@ -238,7 +261,7 @@ void AudioConsole::cmdVolume(String args) {
 
 void AudioConsole::cmdNote(String args) {
   if (countArgs(args) < 1) {
-    Serial.println(F("[ERROR] Usage: audio note <0-127> [duration_ms]"));
+    Serial.println(F("[ERROR] Usage: audio note <0-127> [duration_ms] [pan 0-127]"));
     return;
   }
 
@@ -254,9 +277,34 @@ void AudioConsole::cmdNote(String args) {
     duration = constrain(duration, 10, 10000);
   }
 
-  Serial.printf("[NOTE] Playing MIDI note %d for %d ms\n", note, duration);
-  audio->noteOn(note, 127);
-  scheduleNoteOff(note, duration);
+  bool posted;
+  if (countArgs(args) >= 3) {
+    int pan = constrain(getArg(args, 2).toInt(), 0, 127);
+    Serial.printf("[NOTE] Playing MIDI note %d for %d ms (pan %d)\n", note, duration, pan);
+    posted = audio->noteOn(note, 127, pan);
+  } else {
+    Serial.printf("[NOTE] Playing MIDI note %d for %d ms\n", note, duration);
+    posted = audio->noteOn(note, 127);
+  }
+  if (posted) scheduleNoteOff(note, duration);
+}
+
+void AudioConsole::cmdPan(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.printf("Pan spread: %u%%\n", audio->getPanSpread());
+    return;
+  }
+
+  int spread = args.toInt();
+  if (spread < 0 || spread > 100) {
+    Serial.println(F("[ERROR] Pan spread must be 0-100"));
+    return;
+  }
+
+  audio->setPanSpread(spread);
+  Serial.printf("[OK] Pan spread: %u%%\n", audio->getPanSpread());
 }
 
 void AudioConsole::cmdWaveform(String args) {
@@ -298,6 +346,76 @@ void AudioConsole::cmdWaveform(String args) {
   Serial.printf("[OK] Waveform: %s\n", audio->getWaveformName());
 }
 
+void AudioConsole::cmdOscillator(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.printf("Current oscillator: %s\n", audio->getSettings()->getOscillatorName());
+    Serial.println();
+    Serial.println(F("Available oscillators (square/sawtooth/triangle):"));
+    Serial.println(F("  naive     - Direct waveform math (aliases)"));
+    Serial.println(F("  wavetable - Band-limited tables (27 KB flash)"));
+    Serial.println(F("  polyblep  - PolyBLEP square/saw, no tables"));
+    Serial.println();
+    return;
+  }
+
+  args.toLowerCase();
+
+  OscillatorMode mode;
+  if (args == "naive") {
+    mode = OSC_NAIVE;
+  } else if (args == "wavetable" || args == "table") {
+    mode = OSC_WAVETABLE;
+  } else if (args == "polyblep" || args == "blep") {
+    mode = OSC_POLYBLEP;
+  } else {
+    Serial.println(F("[ERROR] Unknown oscillator"));
+    Serial.println(F("Use: naive, wavetable, polyblep"));
+    return;
+  }
+
+  audio->setOscillatorMode(mode);
+  Serial.printf("[OK] Oscillator: %s\n", audio->getSettings()->getOscillatorName());
+}
+
+void AudioConsole::cmdSteal(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.printf("Current steal policy: %s (%u voices stolen)\n",
+                  audio->getSettings()->getVoiceStealName(), audio->getVoiceStealCount());
+    Serial.println();
+    Serial.println(F("Available policies (all voices busy):"));
+    Serial.println(F("  oldest    - Longest-sounding voice"));
+    Serial.println(F("  quietest  - Lowest envelope level"));
+    Serial.println(F("  releasing - Released voices first, then oldest"));
+    Serial.println(F("  samenote  - Retrigger the same note, else releasing"));
+    Serial.println();
+    return;
+  }
+
+  args.toLowerCase();
+
+  VoiceStealPolicy policy;
+  if (args == "oldest") {
+    policy = STEAL_OLDEST;
+  } else if (args == "quietest") {
+    policy = STEAL_QUIETEST;
+  } else if (args == "releasing") {
+    policy = STEAL_RELEASING;
+  } else if (args == "samenote" || args == "same") {
+    policy = STEAL_SAME_NOTE;
+  } else {
+    Serial.println(F("[ERROR] Unknown steal policy"));
+    Serial.println(F("Use: oldest, quietest, releasing, samenote"));
+    return;
+  }
+
+  audio->setVoiceStealPolicy(policy);
+  Serial.printf("[OK] Voice steal: %s\n", audio->getSettings()->getVoiceStealName());
+}
+
 // ============================================================================
 // STATE-VARIABLE FILTER COMMAND
 // ============================================================================
@@ -316,20 +434,27 @@ void AudioConsole::cmdFilter(String args) {
     Serial.printf("  Type:         %s\n", audio->getFilterTypeName());
     Serial.printf("  Cutoff:       %.1f Hz\n", audio->getFilterCutoff());
     Serial.printf("  Resonance:    %.2f\n", audio->getFilterResonance());
+    Serial.printf("  Mode:         %s\n", audio->getFilterPerVoice() ? "Per voice" : "Bus");
+    Serial.printf("  Env depth:    %+.1f octaves (per voice)\n", audio->getFilterEnvDepth());
     Serial.println();
     Serial.println(F("Usage:"));
     Serial.println(F("  audio filter on|off"));
     Serial.println(F("  audio filter <lowpass|highpass|bandpass>"));
     Serial.println(F("  audio filter cutoff <20-20000>"));
     Serial.println(F("  audio filter resonance <0.0-1.0>"));
+    Serial.println(F("  audio filter voice|bus"));
+    Serial.println(F("  audio filter env <-8 to 8>"));
     Serial.println();
     Serial.println(F("Examples:"));
     Serial.println(F("  audio filter on"));
     Serial.println(F("  audio filter lowpass"));
     Serial.println(F("  audio filter cutoff 800"));
     Serial.println(F("  audio filter resonance 0.7"));
+    Serial.println(F("  audio filter voice"));
+    Serial.println(F("  audio filter env 4"));
     Serial.println();
     Serial.println(F("TIP: Try lowpass + resonance with square wave!"));
+    Serial.println(F("TIP: Per voice, each note sweeps its own cutoff with its envelope"));
     Serial.println();
     return;
   }
@@ -406,37 +531,643 @@ void AudioConsole::cmdFilter(String args) {
     audio->setFilterResonance(resonance);
     Serial.printf("[OK] Filter resonance: %.2f\n", resonance);
 
-    if (!audio->getFilterEnabled()) {
-      Serial.println(F("[HINT] Filter is disabled - use 'audio filter on' to enable"));
+    if (!audio->getFilterEnabled()) {
+      Serial.println(F("[HINT] Filter is disabled - use 'audio filter on' to enable"));
+    }
+    return;
+
+  } else if (param == "voice" || param == "voices") {
+    audio->setFilterPerVoice(true);
+    Serial.println(F("[OK] Filter mode: per voice"));
+    if (!audio->getFilterEnabled()) {
+      Serial.println(F("[HINT] Filter is disabled - use 'audio filter on' to enable"));
+    }
+    return;
+
+  } else if (param == "bus" || param == "global") {
+    audio->setFilterPerVoice(false);
+    Serial.println(F("[OK] Filter mode: bus (one filter on the mix)"));
+    return;
+
+  } else if (param == "env" || param == "envdepth") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio filter env <-8 to 8>"));
+      return;
+    }
+
+    float depth = getArg(args, 1).toFloat();
+    if (depth < -FILTER_ENV_DEPTH_MAX || depth > FILTER_ENV_DEPTH_MAX) {
+      Serial.println(F("[ERROR] Envelope depth must be -8 to 8 octaves"));
+      return;
+    }
+
+    audio->setFilterEnvDepth(depth);
+    Serial.printf("[OK] Filter envelope depth: %+.1f octaves\n", depth);
+
+    if (!audio->getFilterPerVoice()) {
+      Serial.println(F("[HINT] Only used per voice - use 'audio filter voice'"));
+    }
+    return;
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: on, off, lowpass, highpass, bandpass, cutoff, resonance, voice, bus, env"));
+  }
+}
+
+// ============================================================================
+// DELAY COMMAND
+// ============================================================================
+
+void AudioConsole::cmdDelay(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.println();
+    Serial.println(F("Delay/Echo Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getDelayEnabled() ? "Yes" : "No");
+    Serial.printf("  Time:         %u ms\n", audio->getDelayTime());
+    Serial.printf("  Feedback:     %u%%\n", audio->getDelayFeedback());
+    Serial.printf("  Mix:          %u%% (wet)\n", audio->getDelayMix());
+    if (audio->getDelayModDepth() > 0.0f) {
+      Serial.printf("  Wow:          %.1f ms @ %.1f Hz\n",
+                    audio->getDelayModDepth(), audio->getDelayModRate());
+    } else {
+      Serial.println(F("  Wow:          Off"));
+    }
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio delay on|off"));
+    Serial.println(F("  audio delay time <10-1000>"));
+    Serial.println(F("  audio delay tap"));
+    Serial.println(F("  audio delay feedback <0-90>"));
+    Serial.println(F("  audio delay mix <0-100>"));
+    Serial.println(F("  audio delay mod <0-10 ms> [0.1-10 Hz]"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (param == "on") {
+    audio->setDelayEnabled(true);
+    Serial.println(F("[OK] Delay enabled"));
+
+  } else if (param == "off") {
+    audio->setDelayEnabled(false);
+    Serial.println(F("[OK] Delay disabled"));
+
+  } else if (param == "time") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio delay time <10-1000>"));
+      return;
+    }
+
+    int time = getArg(args, 1).toInt();
+    if (time < 10 || time > 1000) {
+      Serial.println(F("[ERROR] Delay time must be 10-1000 ms"));
+      return;
+    }
+
+    audio->setDelayTime(time);
+    Serial.printf("[OK] Delay time: %d ms\n", time);
+
+  } else if (param == "tap") {
+    uint16_t time = audio->tapDelay();
+    if (time == 0) {
+      Serial.println(F("[OK] Tap again to set the delay time"));
+    } else {
+      Serial.printf("[OK] Delay time: %u ms (tap tempo)\n", time);
+    }
+
+  } else if (param == "mod" || param == "wow") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio delay mod <0-10 ms> [0.1-10 Hz]"));
+      return;
+    }
+
+    float depth = getArg(args, 1).toFloat();
+    float rate = (countArgs(args) >= 3) ? getArg(args, 2).toFloat() : audio->getDelayModRate();
+    if (depth < 0.0f || depth > DELAY_MOD_DEPTH_MAX) {
+      Serial.println(F("[ERROR] Depth must be 0-10 ms"));
+      return;
+    }
+    if (rate < DELAY_MOD_RATE_MIN || rate > DELAY_MOD_RATE_MAX) {
+      Serial.println(F("[ERROR] Rate must be 0.1-10 Hz"));
+      return;
+    }
+
+    audio->setDelayModulation(rate, depth);
+    if (depth > 0.0f) {
+      Serial.printf("[OK] Delay wow: %.1f ms @ %.1f Hz\n", depth, rate);
+    } else {
+      Serial.println(F("[OK] Delay wow off"));
+    }
+
+  } else if (param == "feedback" || param == "fb") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio delay feedback <0-90>"));
+      return;
+    }
+
+    int feedback = getArg(args, 1).toInt();
+    if (feedback < 0 || feedback > 90) {
+      Serial.println(F("[ERROR] Feedback must be 0-90%"));
+      return;
+    }
+
+    audio->setDelayFeedback(feedback);
+    Serial.printf("[OK] Delay feedback: %d%%\n", feedback);
+
+  } else if (param == "mix") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio delay mix <0-100>"));
+      return;
+    }
+
+    int mix = getArg(args, 1).toInt();
+    if (mix < 0 || mix > 100) {
+      Serial.println(F("[ERROR] Mix must be 0-100%"));
+      return;
+    }
+
+    audio->setDelayMix(mix);
+    Serial.printf("[OK] Delay mix: %d%% wet\n", mix);
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: on, off, time, tap, feedback, mix, mod"));
+  }
+}
+
+// ============================================================================
+// CHORUS COMMAND
+// ============================================================================
+
+void AudioConsole::cmdChorus(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.println();
+    Serial.println(F("Chorus Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getChorusEnabled() ? "Yes" : "No");
+    Serial.printf("  Voices:       %u\n", audio->getChorusVoices());
+    Serial.printf("  Rate:         %.2f Hz\n", audio->getChorusRate());
+    Serial.printf("  Delay:        %.1f ms\n", audio->getChorusDelay());
+    Serial.printf("  Depth:        %.1f ms\n", audio->getChorusDepth());
+    Serial.printf("  Mix:          %u%% (wet)\n", audio->getChorusMix());
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio chorus on|off"));
+    Serial.println(F("  audio chorus voices <2-3>"));
+    Serial.println(F("  audio chorus rate <0.05-5.0>"));
+    Serial.println(F("  audio chorus delay <5-30>"));
+    Serial.println(F("  audio chorus depth <0-10>"));
+    Serial.println(F("  audio chorus mix <0-100>"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (param == "on") {
+    audio->setChorusEnabled(true);
+    Serial.println(F("[OK] Chorus enabled"));
+
+  } else if (param == "off") {
+    audio->setChorusEnabled(false);
+    Serial.println(F("[OK] Chorus disabled"));
+
+  } else if (param == "voices") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio chorus voices <2-3>"));
+      return;
+    }
+
+    int voices = getArg(args, 1).toInt();
+    if (voices < CHORUS_VOICES_MIN || voices > CHORUS_VOICES_MAX) {
+      Serial.println(F("[ERROR] Voices must be 2-3"));
+      return;
+    }
+
+    audio->setChorusVoices(voices);
+    Serial.printf("[OK] Chorus voices: %d\n", voices);
+
+  } else if (param == "rate") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio chorus rate <0.05-5.0>"));
+      return;
+    }
+
+    float rate = getArg(args, 1).toFloat();
+    if (rate < CHORUS_RATE_MIN || rate > CHORUS_RATE_MAX) {
+      Serial.println(F("[ERROR] Rate must be 0.05-5.0 Hz"));
+      return;
+    }
+
+    audio->setChorusRate(rate);
+    Serial.printf("[OK] Chorus rate: %.2f Hz\n", rate);
+
+  } else if (param == "delay") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio chorus delay <5-30>"));
+      return;
+    }
+
+    float ms = getArg(args, 1).toFloat();
+    if (ms < CHORUS_DELAY_MIN_MS || ms > CHORUS_DELAY_MAX_MS) {
+      Serial.println(F("[ERROR] Delay must be 5-30 ms"));
+      return;
+    }
+
+    audio->setChorusDelay(ms);
+    Serial.printf("[OK] Chorus delay: %.1f ms\n", ms);
+
+  } else if (param == "depth") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio chorus depth <0-10>"));
+      return;
+    }
+
+    float ms = getArg(args, 1).toFloat();
+    if (ms < 0.0f || ms > CHORUS_DEPTH_MAX_MS) {
+      Serial.println(F("[ERROR] Depth must be 0-10 ms"));
+      return;
+    }
+
+    audio->setChorusDepth(ms);
+    Serial.printf("[OK] Chorus depth: %.1f ms\n", ms);
+
+  } else if (param == "mix") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio chorus mix <0-100>"));
+      return;
+    }
+
+    int mix = getArg(args, 1).toInt();
+    if (mix < 0 || mix > 100) {
+      Serial.println(F("[ERROR] Mix must be 0-100%"));
+      return;
+    }
+
+    audio->setChorusMix(mix);
+    Serial.printf("[OK] Chorus mix: %d%% wet\n", mix);
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: on, off, voices, rate, delay, depth, mix"));
+  }
+}
+
+// ============================================================================
+// FLANGER COMMAND
+// ============================================================================
+
+void AudioConsole::cmdFlanger(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.println();
+    Serial.println(F("Flanger Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getFlangerEnabled() ? "Yes" : "No");
+    Serial.printf("  Rate:         %.2f Hz\n", audio->getFlangerRate());
+    Serial.printf("  Delay:        %.1f ms\n", audio->getFlangerDelay());
+    Serial.printf("  Depth:        %.1f ms\n", audio->getFlangerDepth());
+    Serial.printf("  Feedback:     %d%%\n", audio->getFlangerFeedback());
+    Serial.printf("  Mix:          %u%% (wet)\n", audio->getFlangerMix());
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio flanger on|off"));
+    Serial.println(F("  audio flanger rate <0.05-5.0>"));
+    Serial.println(F("  audio flanger delay <0.5-10>"));
+    Serial.println(F("  audio flanger depth <0-5>"));
+    Serial.println(F("  audio flanger feedback <-90-90>"));
+    Serial.println(F("  audio flanger mix <0-100>"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (param == "on") {
+    audio->setFlangerEnabled(true);
+    Serial.println(F("[OK] Flanger enabled"));
+
+  } else if (param == "off") {
+    audio->setFlangerEnabled(false);
+    Serial.println(F("[OK] Flanger disabled"));
+
+  } else if (param == "rate") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio flanger rate <0.05-5.0>"));
+      return;
+    }
+
+    float rate = getArg(args, 1).toFloat();
+    if (rate < FLANGER_RATE_MIN || rate > FLANGER_RATE_MAX) {
+      Serial.println(F("[ERROR] Rate must be 0.05-5.0 Hz"));
+      return;
+    }
+
+    audio->setFlangerRate(rate);
+    Serial.printf("[OK] Flanger rate: %.2f Hz\n", rate);
+
+  } else if (param == "delay") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio flanger delay <0.5-10>"));
+      return;
+    }
+
+    float ms = getArg(args, 1).toFloat();
+    if (ms < FLANGER_DELAY_MIN_MS || ms > FLANGER_DELAY_MAX_MS) {
+      Serial.println(F("[ERROR] Delay must be 0.5-10 ms"));
+      return;
+    }
+
+    audio->setFlangerDelay(ms);
+    Serial.printf("[OK] Flanger delay: %.1f ms\n", ms);
+
+  } else if (param == "depth") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio flanger depth <0-5>"));
+      return;
+    }
+
+    float ms = getArg(args, 1).toFloat();
+    if (ms < 0.0f || ms > FLANGER_DEPTH_MAX_MS) {
+      Serial.println(F("[ERROR] Depth must be 0-5 ms"));
+      return;
+    }
+
+    audio->setFlangerDepth(ms);
+    Serial.printf("[OK] Flanger depth: %.1f ms\n", ms);
+
+  } else if (param == "feedback" || param == "fb") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio flanger feedback <-90-90>"));
+      return;
+    }
+
+    int feedback = getArg(args, 1).toInt();
+    if (feedback < -FLANGER_FEEDBACK_MAX || feedback > FLANGER_FEEDBACK_MAX) {
+      Serial.println(F("[ERROR] Feedback must be -90 to 90%"));
+      return;
+    }
+
+    audio->setFlangerFeedback(feedback);
+    Serial.printf("[OK] Flanger feedback: %d%%\n", feedback);
+
+  } else if (param == "mix") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio flanger mix <0-100>"));
+      return;
+    }
+
+    int mix = getArg(args, 1).toInt();
+    if (mix < 0 || mix > 100) {
+      Serial.println(F("[ERROR] Mix must be 0-100%"));
+      return;
+    }
+
+    audio->setFlangerMix(mix);
+    Serial.printf("[OK] Flanger mix: %d%% wet\n", mix);
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: on, off, rate, delay, depth, feedback, mix"));
+  }
+}
+
+// ============================================================================
+// CONVOLVER COMMAND
+// ============================================================================
+
+void AudioConsole::cmdConvolver(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    const Convolver* conv = audio->getConvolver();
+    Serial.println();
+    Serial.println(F("Convolver Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getConvolverEnabled() ? "Yes" : "No");
+    Serial.printf("  Mix:          %u%% wet\n", audio->getConvolverMix());
+    if (!conv) {
+      Serial.println(F("  IR:           None loaded"));
+    } else if (conv->isDirect()) {
+      Serial.printf("  IR:           %s (%u taps, direct FIR)\n",
+                    audio->getConvolverFile(), conv->getTaps());
+    } else {
+      Serial.printf("  IR:           %s (%u taps, %u x %u partitions)\n",
+                    audio->getConvolverFile(), conv->getTaps(),
+                    conv->getPartitions(), conv->getPartitionSize());
+      Serial.printf("  Latency:      %u frames (%.1f ms)\n", conv->getLatency(),
+                    conv->getLatency() * 1000.0f / audio->getSampleRate());
+    }
+    if (conv) Serial.printf("  Memory:       %.1f KB\n", conv->getMemory() / 1024.0f);
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio conv on|off"));
+    Serial.println(F("  audio conv load <file.wav>"));
+    Serial.println(F("  audio conv mix <0-100>"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (param == "on") {
+    if (!audio->getConvolver()) {
+      Serial.println(F("[ERROR] No impulse response loaded (audio conv load <file>)"));
+      return;
+    }
+    audio->setConvolverEnabled(true);
+    Serial.println(F("[OK] Convolver enabled"));
+
+  } else if (param == "off") {
+    audio->setConvolverEnabled(false);
+    Serial.println(F("[OK] Convolver disabled"));
+
+  } else if (param == "load") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio conv load <file.wav>"));
+      return;
+    }
+
+    String file = getArg(args, 1);
+    if (!file.startsWith("/")) file = "/" + file;
+    if (loadImpulseResponse(file.c_str())) {
+      Serial.printf("[OK] Impulse response: %s\n", file.c_str());
+    }
+
+  } else if (param == "mix") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio conv mix <0-100>"));
+      return;
+    }
+
+    int mix = getArg(args, 1).toInt();
+    if (mix < 0 || mix > 100) {
+      Serial.println(F("[ERROR] Mix must be 0-100%"));
+      return;
+    }
+
+    audio->setConvolverMix(mix);
+    Serial.printf("[OK] Convolver mix: %d%% wet\n", mix);
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: on, off, load, mix"));
+  }
+}
+
+// ============================================================================
+// COMPRESSOR COMMAND
+// ============================================================================
+
+void AudioConsole::cmdCompressor(String args) {
+  args.trim();
+
+  if (args.length() == 0) {
+    Serial.println();
+    Serial.println(F("Compressor Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getCompressorEnabled() ? "Yes" : "No");
+    Serial.printf("  Threshold:    %.1f dBFS\n", audio->getCompressorThreshold());
+    Serial.printf("  Ratio:        %.1f:1\n", audio->getCompressorRatio());
+    Serial.printf("  Attack:       %.1f ms\n", audio->getCompressorAttack());
+    Serial.printf("  Release:      %u ms\n", audio->getCompressorRelease());
+    Serial.printf("  Makeup:       %+.1f dB\n", audio->getCompressorMakeup());
+    Serial.printf("  Reduction:    %.1f dB\n", audio->getCompressorReduction());
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio comp on|off"));
+    Serial.println(F("  audio comp threshold <-48.0-0.0>"));
+    Serial.println(F("  audio comp ratio <1.0-20.0>"));
+    Serial.println(F("  audio comp attack <0.1-200>"));
+    Serial.println(F("  audio comp release <10-2000>"));
+    Serial.println(F("  audio comp makeup <0.0-24.0>"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (param == "on") {
+    audio->setCompressorEnabled(true);
+    Serial.println(F("[OK] Compressor enabled"));
+
+  } else if (param == "off") {
+    audio->setCompressorEnabled(false);
+    Serial.println(F("[OK] Compressor disabled"));
+
+  } else if (param == "threshold" || param == "thresh") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio comp threshold <-48.0-0.0>"));
+      return;
+    }
+
+    float threshold = getArg(args, 1).toFloat();
+    if (threshold < COMP_THRESHOLD_MIN_DB || threshold > COMP_THRESHOLD_MAX_DB) {
+      Serial.println(F("[ERROR] Threshold must be -48.0 to 0.0 dBFS"));
+      return;
+    }
+
+    audio->setCompressorThreshold(threshold);
+    Serial.printf("[OK] Compressor threshold: %.1f dBFS\n", threshold);
+
+  } else if (param == "ratio") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio comp ratio <1.0-20.0>"));
+      return;
+    }
+
+    float ratio = getArg(args, 1).toFloat();
+    if (ratio < COMP_RATIO_MIN || ratio > COMP_RATIO_MAX) {
+      Serial.println(F("[ERROR] Ratio must be 1.0-20.0"));
+      return;
+    }
+
+    audio->setCompressorRatio(ratio);
+    Serial.printf("[OK] Compressor ratio: %.1f:1\n", ratio);
+
+  } else if (param == "attack") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio comp attack <0.1-200>"));
+      return;
+    }
+
+    float attack = getArg(args, 1).toFloat();
+    if (attack < COMP_ATTACK_MIN_MS || attack > COMP_ATTACK_MAX_MS) {
+      Serial.println(F("[ERROR] Attack must be 0.1-200 ms"));
+      return;
+    }
+
+    audio->setCompressorAttack(attack);
+    Serial.printf("[OK] Compressor attack: %.1f ms\n", attack);
+
+  } else if (param == "release") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio comp release <10-2000>"));
+      return;
+    }
+
+    int release = getArg(args, 1).toInt();
+    if (release < COMP_RELEASE_MIN_MS || release > COMP_RELEASE_MAX_MS) {
+      Serial.println(F("[ERROR] Release must be 10-2000 ms"));
+      return;
+    }
+
+    audio->setCompressorRelease(release);
+    Serial.printf("[OK] Compressor release: %d ms\n", release);
+
+  } else if (param == "makeup" || param == "gain") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio comp makeup <0.0-24.0>"));
+      return;
+    }
+
+    float makeup = getArg(args, 1).toFloat();
+    if (makeup < 0.0f || makeup > COMP_MAKEUP_MAX_DB) {
+      Serial.println(F("[ERROR] Makeup must be 0.0-24.0 dB"));
+      return;
     }
-    return;
+
+    audio->setCompressorMakeup(makeup);
+    Serial.printf("[OK] Compressor makeup: %+.1f dB\n", makeup);
 
   } else {
     Serial.println(F("[ERROR] Unknown parameter"));
-    Serial.println(F("Use: on, off, lowpass, highpass, bandpass, cutoff, resonance"));
+    Serial.println(F("Use: on, off, threshold, ratio, attack, release, makeup"));
   }
 }
 
 // ============================================================================
-// DELAY COMMAND
+// LIMITER COMMAND
 // ============================================================================
 
-void AudioConsole::cmdDelay(String args) {
+void AudioConsole::cmdLimiter(String args) {
   args.trim();
 
   if (args.length() == 0) {
     Serial.println();
-    Serial.println(F("Delay/Echo Settings:"));
-    Serial.printf("  Enabled:      %s\n", audio->getDelayEnabled() ? "Yes" : "No");
-    Serial.printf("  Time:         %u ms\n", audio->getDelayTime());
-    Serial.printf("  Feedback:     %u%%\n", audio->getDelayFeedback());
-    Serial.printf("  Mix:          %u%% (wet)\n", audio->getDelayMix());
+    Serial.println(F("Output Limiter Settings:"));
+    Serial.printf("  Enabled:      %s\n", audio->getLimiterEnabled() ? "Yes" : "No");
+    Serial.printf("  Ceiling:      %.1f dBFS\n", audio->getLimiterCeiling());
+    Serial.printf("  Release:      %u ms\n", audio->getLimiterRelease());
+    Serial.printf("  Lookahead:    %.1f ms\n",
+                  LIMITER_LOOKAHEAD_FRAMES * 1000.0f / audio->getSampleRate());
+    Serial.printf("  Reduction:    %.1f dB now, %.1f dB peak\n",
+                  audio->getLimiterReduction(), audio->getLimiterPeakReduction());
     Serial.println();
     Serial.println(F("Usage:"));
-    Serial.println(F("  audio delay on|off"));
-    Serial.println(F("  audio delay time <10-1000>"));
-    Serial.println(F("  audio delay feedback <0-90>"));
-    Serial.println(F("  audio delay mix <0-100>"));
+    Serial.println(F("  audio limiter on|off"));
+    Serial.println(F("  audio limiter ceiling <-24.0-0.0>"));
+    Serial.println(F("  audio limiter release <10-2000>"));
+    Serial.println(F("  audio limiter reset"));
     Serial.println();
     return;
   }
@@ -445,61 +1176,50 @@ void AudioConsole::cmdDelay(String args) {
   param.toLowerCase();
 
   if (param == "on") {
-    audio->setDelayEnabled(true);
-    Serial.println(F("[OK] Delay enabled"));
+    audio->setLimiterEnabled(true);
+    Serial.println(F("[OK] Limiter enabled"));
 
   } else if (param == "off") {
-    audio->setDelayEnabled(false);
-    Serial.println(F("[OK] Delay disabled"));
+    audio->setLimiterEnabled(false);
+    Serial.println(F("[OK] Limiter disabled (output clips at full scale)"));
 
-  } else if (param == "time") {
+  } else if (param == "ceiling") {
     if (countArgs(args) < 2) {
-      Serial.println(F("[ERROR] Usage: audio delay time <10-1000>"));
+      Serial.println(F("[ERROR] Usage: audio limiter ceiling <-24.0-0.0>"));
       return;
     }
 
-    int time = getArg(args, 1).toInt();
-    if (time < 10 || time > 1000) {
-      Serial.println(F("[ERROR] Delay time must be 10-1000 ms"));
+    float ceiling = getArg(args, 1).toFloat();
+    if (ceiling < LIMITER_CEILING_MIN_DB || ceiling > LIMITER_CEILING_MAX_DB) {
+      Serial.println(F("[ERROR] Ceiling must be -24.0 to 0.0 dBFS"));
       return;
     }
 
-    audio->setDelayTime(time);
-    Serial.printf("[OK] Delay time: %d ms\n", time);
+    audio->setLimiterCeiling(ceiling);
+    Serial.printf("[OK] Limiter ceiling: %.1f dBFS\n", ceiling);
 
-  } else if (param == "feedback" || param == "fb") {
+  } else if (param == "release") {
     if (countArgs(args) < 2) {
-      Serial.println(F("[ERROR] Usage: audio delay feedback <0-90>"));
-      return;
-    }
-
-    int feedback = getArg(args, 1).toInt();
-    if (feedback < 0 || feedback > 90) {
-      Serial.println(F("[ERROR] Feedback must be 0-90%"));
+      Serial.println(F("[ERROR] Usage: audio limiter release <10-2000>"));
       return;
     }
 
-    audio->setDelayFeedback(feedback);
-    Serial.printf("[OK] Delay feedback: %d%%\n", feedback);
-
-  } else if (param == "mix") {
-    if (countArgs(args) < 2) {
-      Serial.println(F("[ERROR] Usage: audio delay mix <0-100>"));
+    int release = getArg(args, 1).toInt();
+    if (release < LIMITER_RELEASE_MIN_MS || release > LIMITER_RELEASE_MAX_MS) {
+      Serial.println(F("[ERROR] Release must be 10-2000 ms"));
       return;
     }
 
-    int mix = getArg(args, 1).toInt();
-    if (mix < 0 || mix > 100) {
-      Serial.println(F("[ERROR] Mix must be 0-100%"));
-      return;
-    }
+    audio->setLimiterRelease(release);
+    Serial.printf("[OK] Limiter release: %d ms\n", release);
 
-    audio->setDelayMix(mix);
-    Serial.printf("[OK] Delay mix: %d%% wet\n", mix);
+  } else if (param == "reset") {
+    audio->resetLimiterMeter();
+    Serial.println(F("[OK] Limiter meter reset"));
 
   } else {
     Serial.println(F("[ERROR] Unknown parameter"));
-    Serial.println(F("Use: on, off, time, feedback, mix"));
+    Serial.println(F("Use: on, off, ceiling, release, reset"));
   }
 }
 
@@ -512,23 +1232,31 @@ void AudioConsole::cmdEQ(String args) {
   args.trim();
 
   if (args.length() == 0) {
-    int8_t bass, mid, treble;
-    audio->getEQ(bass, mid, treble);
     Serial.println();
     Serial.println(F("Biquad EQ Settings:"));
     Serial.printf("  Enabled:      %s\n", audio->getEQEnabled() ? "Yes" : "No");
-    Serial.printf("  Bass:         %+d dB (120 Hz)\n", bass);
-    Serial.printf("  Mid:          %+d dB (1000 Hz)\n", mid);
-    Serial.printf("  Treble:       %+d dB (8000 Hz)\n", treble);
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      const EQBand* band = audio->getEQBand(b);
+      if (band->type == BIQUAD_OFF) {
+        Serial.printf("  Band %d:       Off\n", b);
+      } else {
+        Serial.printf("  Band %d:       %-9s %5.0f Hz  %+5.1f dB  Q %.2f\n",
+                      b, band->getTypeName(), band->freq, band->gain, band->q);
+      }
+    }
     Serial.println();
     Serial.println(F("Usage:"));
     Serial.println(F("  audio eq on|off"));
-    Serial.println(F("  audio eq <bass|mid|treble> <-12..+12>"));
+    Serial.println(F("  audio eq <bass|mid|treble> <-12..+12>   (gain of band 0/1/2)"));
+    Serial.println(F("  audio eq band <0-7> <type> [freq] [gain] [q]"));
+    Serial.println(F("  audio eq band <0-7> off"));
+    Serial.println(F("  Types: peak, lowshelf, highshelf, notch, lowpass, highpass"));
     Serial.println();
     Serial.println(F("Examples:"));
     Serial.println(F("  audio eq on"));
     Serial.println(F("  audio eq bass +6"));
-    Serial.println(F("  audio eq treble -3"));
+    Serial.println(F("  audio eq band 3 peak 3000 -4 2.0"));
+    Serial.println(F("  audio eq band 4 highpass 40"));
     Serial.println();
     return;
   }
@@ -545,6 +1273,44 @@ void AudioConsole::cmdEQ(String args) {
     audio->setEQEnabled(false);
     Serial.println(F("[OK] Biquad EQ disabled"));
     return;
+
+  } else if (param == "band") {
+    if (countArgs(args) < 3) {
+      Serial.println(F("[ERROR] Usage: audio eq band <0-7> <type|off> [freq] [gain] [q]"));
+      return;
+    }
+    int index = getArg(args, 1).toInt();
+    const EQBand* current = audio->getEQBand(index < 0 ? EQ_MAX_BANDS : index);
+    if (!current) {
+      Serial.printf("[ERROR] Band must be 0-%d\n", EQ_MAX_BANDS - 1);
+      return;
+    }
+
+    // Omitted values keep the band's own
+    EQBand band = *current;
+    String typeName = getArg(args, 2);
+    typeName.toLowerCase();
+    if (!band.setType(typeName.c_str())) {
+      Serial.println(F("[ERROR] Type: peak|lowshelf|highshelf|notch|lowpass|highpass|off"));
+      return;
+    }
+    if (countArgs(args) > 3) band.freq = getArg(args, 3).toFloat();
+    if (countArgs(args) > 4) band.gain = getArg(args, 4).toFloat();
+    if (countArgs(args) > 5) band.q = getArg(args, 5).toFloat();
+
+    audio->setEQBand(index, band.type, band.freq, band.gain, band.q);
+    current = audio->getEQBand(index);
+    if (current->type == BIQUAD_OFF) {
+      Serial.printf("[OK] EQ band %d: Off\n", index);
+    } else {
+      Serial.printf("[OK] EQ band %d: %s %.0f Hz %+.1f dB Q %.2f\n", index,
+                    current->getTypeName(), current->freq, current->gain, current->q);
+    }
+
+    if (!audio->getEQEnabled()) {
+      Serial.println(F("[HINT] EQ is disabled - use 'audio eq on' to enable"));
+    }
+    return;
   }
 
   if (countArgs(args) < 2) {
@@ -566,7 +1332,7 @@ void AudioConsole::cmdEQ(String args) {
   } else if (band == "treble" || band == "t") {
     treble = value;
   } else {
-    Serial.println(F("[ERROR] Invalid band: bass|mid|treble"));
+    Serial.println(F("[ERROR] Invalid band: bass|mid|treble|band"));
     return;
   }
 
@@ -587,7 +1353,7 @@ void AudioConsole::cmdReverb(String args) {
 
   if (args.length() == 0) {
     Serial.println();
-    Serial.println(F("Schroeder Reverb Settings:"));
+    Serial.println(F("FDN Reverb Settings:"));
     Serial.printf("  Enabled:      %s\n", audio->getReverbEnabled() ? "Yes" : "No");
     Serial.printf("  Room Size:    %.2f (0.0-1.0)\n", audio->getReverbRoomSize());
     Serial.printf("  Damping:      %.2f (0.0-1.0)\n", audio->getReverbDamping());
@@ -825,6 +1591,106 @@ void AudioConsole::cmdLFO(String args) {
     Serial.println(F("Use: on, off, vibrato, tremolo, rate, depth"));
   }
 }
+
+// ============================================================================
+// ENVELOPE COMMAND
+// ============================================================================
+
+void AudioConsole::cmdEnvelope(String args) {
+  args.trim();
+  EnvelopeConfig env = audio->getEnvelope();
+
+  if (args.length() == 0) {
+    Serial.println();
+    Serial.println(F("Envelope (ADSR) Settings:"));
+    Serial.printf("  Attack:       %u ms\n", env.attackMs);
+    Serial.printf("  Decay:        %u ms\n", env.decayMs);
+    Serial.printf("  Sustain:      %u/255\n", env.sustain);
+    Serial.printf("  Release:      %u ms\n", env.releaseMs);
+    Serial.printf("  Curve:        %s\n", env.getCurveName());
+    Serial.println();
+    Serial.println(F("Usage:"));
+    Serial.println(F("  audio envelope <a> <d> <s> <r>"));
+    Serial.println(F("  audio envelope attack|decay|release <1-10000 ms>"));
+    Serial.println(F("  audio envelope sustain <0-255>"));
+    Serial.println(F("  audio envelope curve linear|exp"));
+    Serial.println();
+    Serial.println(F("Examples:"));
+    Serial.println(F("  audio envelope 2 150 0 100      # Percussive pluck"));
+    Serial.println(F("  audio envelope 800 500 200 1500 # Slow pad"));
+    Serial.println();
+    return;
+  }
+
+  String param = getArg(args, 0);
+  param.toLowerCase();
+
+  if (countArgs(args) == 4 && isDigit(param.charAt(0))) {
+    long attack = getArg(args, 0).toInt();
+    long decay = getArg(args, 1).toInt();
+    long sustain = getArg(args, 2).toInt();
+    long release = getArg(args, 3).toInt();
+    if (attack < ENV_TIME_MIN_MS || attack > ENV_TIME_MAX_MS ||
+        decay < ENV_TIME_MIN_MS || decay > ENV_TIME_MAX_MS ||
+        release < ENV_TIME_MIN_MS || release > ENV_TIME_MAX_MS) {
+      Serial.println(F("[ERROR] Times must be 1-10000 ms"));
+      return;
+    }
+    if (sustain < 0 || sustain > 255) {
+      Serial.println(F("[ERROR] Sustain must be 0-255"));
+      return;
+    }
+    env.attackMs = attack;
+    env.decayMs = decay;
+    env.sustain = sustain;
+    env.releaseMs = release;
+
+  } else if (param == "curve") {
+    String value = getArg(args, 1);
+    value.toLowerCase();
+    if (value != "linear" && value != "lin" && value != "exponential" && value != "exp") {
+      Serial.println(F("[ERROR] Usage: audio envelope curve linear|exp"));
+      return;
+    }
+    env.setCurve(value.c_str());
+
+  } else if (param == "sustain" || param == "s") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio envelope sustain <0-255>"));
+      return;
+    }
+    long sustain = getArg(args, 1).toInt();
+    if (sustain < 0 || sustain > 255) {
+      Serial.println(F("[ERROR] Sustain must be 0-255"));
+      return;
+    }
+    env.sustain = sustain;
+
+  } else if (param == "attack" || param == "a" || param == "decay" || param == "d" ||
+             param == "release" || param == "r") {
+    if (countArgs(args) < 2) {
+      Serial.println(F("[ERROR] Usage: audio envelope attack|decay|release <1-10000 ms>"));
+      return;
+    }
+    long ms = getArg(args, 1).toInt();
+    if (ms < ENV_TIME_MIN_MS || ms > ENV_TIME_MAX_MS) {
+      Serial.println(F("[ERROR] Time must be 1-10000 ms"));
+      return;
+    }
+    if (param.charAt(0) == 'a') env.attackMs = ms;
+    else if (param.charAt(0) == 'd') env.decayMs = ms;
+    else env.releaseMs = ms;
+
+  } else {
+    Serial.println(F("[ERROR] Unknown parameter"));
+    Serial.println(F("Use: attack, decay, sustain, release, curve"));
+    return;
+  }
+
+  audio->setEnvelope(env);
+  Serial.printf("[OK] Envelope: A:%ums D:%ums S:%u R:%ums (%s)\n",
+                env.attackMs, env.decayMs, env.sustain, env.releaseMs, env.getCurveName());
+}
 // ============================================================================
 // PROFILE COMMANDS
 // ============================================================================
@@ -1097,9 +1963,14 @@ void AudioConsole::cmdInfo(String args) {
   Serial.printf("Profile:        %s\n", settings->name);
   Serial.printf("Audio Mode:     %s\n", settings->getModeName());
   Serial.printf("Sample Rate:    %u Hz\n", settings->sampleRate);
-  Serial.printf("Voices:         %d\n", settings->voices);
-  Serial.printf("Volume:         %d/255\n", settings->volume);
+  Serial.printf("Voices:         %d (steal: %s)\n", settings->voices, settings->getVoiceStealName());
+  Serial.printf("Volume:         %d/255 (pan spread %u%%)\n", settings->volume, settings->panSpread);
   Serial.printf("Waveform:       %s\n", settings->getWaveformName());
+  Serial.printf("Oscillator:     %s\n", settings->getOscillatorName());
+  Serial.printf("Envelope:       A:%ums D:%ums S:%u R:%ums (%s)\n",
+                settings->envelope.attackMs, settings->envelope.decayMs,
+                settings->envelope.sustain, settings->envelope.releaseMs,
+                settings->envelope.getCurveName());
 
   if (settings->mode == AUDIO_MODE_I2S) {
     Serial.printf("Pin:            GPIO %d (I2S)\n", settings->i2s.pin);
@@ -1112,20 +1983,25 @@ void AudioConsole::cmdInfo(String args) {
   Serial.println();
   Serial.println(F("Effects:"));
 
-  int8_t bass, mid, treble;
-  audio->getEQ(bass, mid, treble);
   Serial.printf("  Biquad EQ:    %s", settings->eq.enabled ? "On" : "Off");
   if (settings->eq.enabled) {
-    Serial.printf(" (B:%+d M:%+d T:%+d dB)", bass, mid, treble);
+    uint8_t sections = 0;
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      if (settings->eq.bands[b].type != BIQUAD_OFF) sections++;
+    }
+    int8_t bass, mid, treble;
+    audio->getEQ(bass, mid, treble);
+    Serial.printf(" (%d bands, B:%+d M:%+d T:%+d dB)", sections, bass, mid, treble);
   }
   Serial.println();
 
   Serial.printf("  SVF Filter:   %s", settings->filter.enabled ? "On" : "Off");
   if (settings->filter.enabled) {
-    Serial.printf(" (%s, %.0fHz, Q:%.2f)",
+    Serial.printf(" (%s, %.0fHz, Q:%.2f, %s)",
                   settings->filter.getTypeName(),
                   settings->filter.cutoff,
-                  settings->filter.resonance);
+                  settings->filter.resonance,
+                  settings->filter.perVoice ? "per voice" : "bus");
   }
   Serial.println();
 
@@ -1155,6 +2031,56 @@ void AudioConsole::cmdInfo(String args) {
                   settings->delay.timeMs,
                   settings->delay.feedback,
                   settings->delay.mix);
+    if (settings->delay.modDepth > 0.0f) {
+      Serial.printf(" Wow:%.1fms@%.1fHz", settings->delay.modDepth, settings->delay.modRate);
+    }
+  }
+  Serial.println();
+
+  Serial.printf("  Chorus:       %s", settings->chorus.enabled ? "On" : "Off");
+  if (settings->chorus.enabled) {
+    Serial.printf(" (%u voices, %.1fms+-%.1fms@%.2fHz, Mix:%u%%)",
+                  settings->chorus.voices,
+                  settings->chorus.delayMs,
+                  settings->chorus.depthMs,
+                  settings->chorus.rate,
+                  settings->chorus.mix);
+  }
+  Serial.println();
+
+  Serial.printf("  Flanger:      %s", settings->flanger.enabled ? "On" : "Off");
+  if (settings->flanger.enabled) {
+    Serial.printf(" (%.1fms+-%.1fms@%.2fHz, FB:%d%%, Mix:%u%%)",
+                  settings->flanger.delayMs,
+                  settings->flanger.depthMs,
+                  settings->flanger.rate,
+                  settings->flanger.feedback,
+                  settings->flanger.mix);
+  }
+  Serial.println();
+
+  Serial.printf("  Convolver:    %s", settings->convolver.enabled ? "On" : "Off");
+  if (settings->convolver.file[0]) {
+    Serial.printf(" (%s, Mix:%u%%)", settings->convolver.file, settings->convolver.mix);
+  }
+  Serial.println();
+
+  Serial.printf("  Compressor:   %s", settings->compressor.enabled ? "On" : "Off");
+  if (settings->compressor.enabled) {
+    Serial.printf(" (%.1fdB, %.1f:1, A:%.1fms R:%ums, Makeup:%+.1fdB)",
+                  settings->compressor.thresholdDb,
+                  settings->compressor.ratio,
+                  settings->compressor.attackMs,
+                  settings->compressor.releaseMs,
+                  settings->compressor.makeupDb);
+  }
+  Serial.println();
+
+  Serial.printf("  Limiter:      %s", settings->limiter.enabled ? "On" : "Off");
+  if (settings->limiter.enabled) {
+    Serial.printf(" (Ceiling:%.1fdB, Release:%ums)",
+                  settings->limiter.ceilingDb,
+                  settings->limiter.releaseMs);
   }
   Serial.println();
 
@@ -1166,6 +2092,13 @@ void AudioConsole::cmdInfo(String args) {
 }
 
 void AudioConsole::cmdStatus(String args) {
+  args.trim();
+  if (args == "reset") {
+    audio->resetDSPLoad();
+    Serial.println(F("[STATUS] ✓ DSP load statistics reset"));
+    return;
+  }
+  
   Serial.println();
   Serial.println(F("╔════════════════════════════════════════════════════════╗"));
   Serial.println(F("║                  SYSTEM STATUS                         ║"));
@@ -1176,7 +2109,7 @@ void AudioConsole::cmdStatus(String args) {
                 (millis() / 3600000) % 24,
                 (millis() / 60000) % 60,
                 (millis() / 1000) % 60);
-  Serial.printf("CPU:            %s @ 160 MHz\n", ESP32_VARIANT);
+  Serial.printf("CPU:            %s @ %u MHz\n", ESP32_VARIANT, platformCycleFrequency() / 1000000);
   Serial.printf("Free RAM:       %d KB\n", ESP.getFreeHeap() / 1024);
 
   if (filesystem && filesystem->isInitialized()) {
@@ -1192,6 +2125,87 @@ void AudioConsole::cmdStatus(String args) {
   Serial.printf("Sample Rate:    %u Hz\n", audio->getSampleRate());
   Serial.printf("Playing:        %s\n", audio->isPlaying() ? "Yes" : "No");
   Serial.printf("Active Voices:  %d/%d\n", audio->getActiveVoices(), audio->getVoiceCount());
+  
+  const DSPLoadStats& load = audio->getDSPLoad();
+  Serial.println();
+  if (!audio->getSettings()->performance.enableCPUMonitor) {
+    Serial.println(F("DSP Load:       Monitor disabled"));
+  } else if (load.blocks == 0) {
+    Serial.println(F("DSP Load:       No blocks rendered yet"));
+  } else {
+    Serial.printf("DSP Load:       %.1f%% now, %.1f%% avg, %.1f%% peak\n",
+                  load.current, load.average, load.peak);
+    Serial.printf("Block Time:     %u us last, %u us worst / %u us deadline\n",
+                  load.lastBlockUs, load.worstBlockUs, load.deadlineUs);
+    Serial.printf("Headroom:       %d us%s\n", load.headroomUs,
+                  load.headroomUs < 0 ? " (DEADLINE MISSED)" : "");
+    if (audio->getConvolverEnabled()) {
+      Serial.printf("Convolver:      %.1f%% avg, %u cycles/frame\n",
+                    load.convolver, load.convolverCyclesPerFrame);
+    }
+    Serial.printf("Blocks:         %u (use 'audio status reset' to clear)\n", load.blocks);
+  }
+  
+  const XrunStats& xruns = audio->getXrunStats();
+  Serial.printf("Xruns:          %u (%u late, %u underrun, %u short write)\n",
+                xruns.total, xruns.lateBlocks, xruns.underruns, xruns.shortWrites);
+  
+  const CommandStats& commands = audio->getCommandStats();
+  Serial.printf("Commands:       %u applied, %u dropped, %.1f ms max latency\n",
+                commands.applied, audio->getDroppedCommands(),
+                commands.maxLatencyFrames * 1000.0f / audio->getSampleRate());
+  
+  if (audio->getCompressorEnabled()) {
+    Serial.printf("Compressor:     %.1f dB gain reduction\n", audio->getCompressorReduction());
+  } else {
+    Serial.println(F("Compressor:     Off"));
+  }
+  
+  if (audio->getLimiterEnabled()) {
+    Serial.printf("Limiter:        %.1f dB now, %.1f dB peak gain reduction\n",
+                  audio->getLimiterReduction(), audio->getLimiterPeakReduction());
+  } else {
+    Serial.println(F("Limiter:        Off"));
+  }
+  Serial.println();
+}
+
+void AudioConsole::cmdXruns(String args) {
+  args.trim();
+  if (args == "reset") {
+    audio->resetXrunStats();
+    Serial.println(F("[XRUN] ✓ Counters and event log cleared"));
+    return;
+  }
+  
+  const XrunStats& xruns = audio->getXrunStats();
+  
+  Serial.println();
+  Serial.println(F("Xrun Statistics (I2S output):"));
+  Serial.println(F("─────────────────────────────────────────────────────"));
+  Serial.printf("  Total:        %u\n", xruns.total);
+  Serial.printf("  Late blocks:  %u\n", xruns.lateBlocks);
+  Serial.printf("  DMA underrun: %u\n", xruns.underruns);
+  Serial.printf("  Short writes: %u\n", xruns.shortWrites);
+  
+  if (audio->getSettings()->mode != MODE_I2S) {
+    Serial.println(F("  (PWM mode - xrun detection only runs on the I2S path)"));
+  }
+  
+  if (xruns.eventCount > 0) {
+    uint32_t now = millis();
+    Serial.println();
+    Serial.printf("Last %u events (newest first):\n", xruns.eventCount);
+    for (uint8_t i = 0; i < xruns.eventCount; i++) {
+      const XrunEvent& event = xruns.getEvent(i);
+      Serial.printf("  %10u ms  (%u s ago)  %-13s", event.timeMs,
+                    (now - event.timeMs) / 1000, AudioEngine::getXrunTypeName(event.type));
+      if (event.type == XRUN_LATE_BLOCK) {
+        Serial.printf("  gap %u us", event.detailUs);
+      }
+      Serial.println();
+    }
+  }
   Serial.println();
 }
 
@@ -1240,6 +2254,44 @@ void AudioConsole::cmdTest(String args) {
   Serial.println(F("[TEST] Done"));
 }
 
+void AudioConsole::cmdBench(String args) {
+#if ENABLE_BENCHMARK
+  args.trim();
+  String section = getArg(args, 0);
+  section.toLowerCase();
+  
+  AudioBenchmark bench;
+  if (countArgs(args) >= 2) {
+    long frames = getArg(args, 1).toInt();
+    bench.setFrames(constrain(frames, 256, 65536));
+  }
+  
+  Serial.println(F("[BENCH] Running (audio output keeps playing, figures include its load)..."));
+  
+  if (section.length() == 0 || section == "all") {
+    bench.runAll();
+  } else if (section == "stages") {
+    bench.runStages();
+  } else if (section == "osc") {
+    bench.runOscillators();
+  } else if (section == "resample") {
+    bench.runResampler();
+  } else if (section == "effects") {
+    bench.runEffectChain();
+  } else if (section == "engine") {
+    bench.runEngine();
+  } else {
+    Serial.println(F("[ERROR] Usage: audio bench [stages|osc|resample|effects|engine|all] [frames]"));
+    return;
+  }
+  
+  Serial.println();
+  Serial.println(F("[BENCH] Done"));
+#else
+  Serial.println(F("[ERROR] Benchmark not compiled in (ENABLE_BENCHMARK=0)"));
+#endif
+}
+
 void AudioConsole::cmdVersion(String args) {
   Serial.println();
   Serial.println(F("╔════════════════════════════════════════════════════════╗"));
@@ -1257,8 +2309,8 @@ void AudioConsole::cmdVersion(String args) {
   Serial.println(F("  ✓ I2S & PWM support"));
   Serial.println(F("  ✓ 5 Waveforms (Sine/Square/Saw/Tri/Noise)"));
   Serial.println(F("  ✓ State-Variable Filter (LP/HP/BP)"));
-  Serial.println(F("  ✓ Biquad EQ (3-band parametric)"));
-  Serial.println(F("  ✓ Schroeder Reverb (Comb+Allpass)"));
+  Serial.println(F("  ✓ Biquad EQ (8-band cascade, fixed point)"));
+  Serial.println(F("  ✓ FDN Reverb (4 lines, fixed point)"));
   Serial.println(F("  ✓ LFO Modulation (Vibrato/Tremolo)"));  // NEW!
   Serial.println(F("  ✓ Delay/Echo effect"));
   Serial.println(F("  ✓ Smart resampling"));
@@ -1322,14 +2374,23 @@ void AudioConsole::cmdHelp(String args) {
     Serial.println(F("  audio stop               Stop playback"));
     Serial.println(F("  audio volume <0-255>     Set volume"));
     Serial.println(F("  audio note <0-127> [ms]  Play MIDI note"));
+    Serial.println(F("  audio pan <0-100>        Keyboard stereo spread (%)"));
     Serial.println(F("  audio waveform <type>    Set waveform"));
+    Serial.println(F("  audio oscillator <mode>  naive / wavetable / polyblep"));
+    Serial.println(F("  audio envelope <a d s r> ADSR times (ms) and sustain"));
+    Serial.println(F("  audio steal <policy>     Voice stealing when all are busy"));
     Serial.println();
     Serial.println(F("EFFECTS:"));
     Serial.println(F("  audio filter trol>   State-Variable Filter (LP/HP/BP)"));
     Serial.println(F("  audio eq <on|off|band>   Biquad EQ control"));
-    Serial.println(F("  audio reverb trol>   Schroeder Reverb (Hall)"));
+    Serial.println(F("  audio reverb trol>   FDN Reverb (Hall)"));
     Serial.println(F("  audio lfo trol>      LFO Vibrato/Tremolo (NEW!)"));
     Serial.println(F("  audio delay <on|off>     Delay/Echo effect"));
+    Serial.println(F("  audio chorus <control>   2-3 voice stereo chorus"));
+    Serial.println(F("  audio flanger <control>  Stereo flanger with feedback"));
+    Serial.println(F("  audio conv <control>     IR convolver (load/mix)"));
+    Serial.println(F("  audio comp <control>     Compressor (threshold/ratio/...)"));
+    Serial.println(F("  audio limiter <control>  Output limiter and meter"));
     Serial.println();
     Serial.println(F("PROFILES:"));
     Serial.println(F("  audio profile list       List all profiles"));
@@ -1349,7 +2410,10 @@ void AudioConsole::cmdHelp(String args) {
     Serial.println(F("SYSTEM:"));
     Serial.println(F("  audio info               Current configuration"));
     Serial.println(F("  audio status             System status"));
+    Serial.println(F("  audio status reset       Clear DSP load peak/worst"));
+    Serial.println(F("  audio xruns [reset]      Underrun counters and log"));
     Serial.println(F("  audio list [path]        List audio files"));
+    Serial.println(F("  audio bench [section]    DSP microbenchmarks"));
     Serial.println(F("  audio version            Show version"));
     Serial.println(F("  audio reset              Factory reset"));
     Serial.println(F("  audio reboot             Restart ESP32"));
@@ -1371,10 +2435,10 @@ void AudioConsole::cmdHelp(String args) {
     if (cmd == "reverb") {
       Serial.println();
       Serial.println(F("audio reverb [on|off|room|damping|wet]"));
-      Serial.println(F("Schroeder reverb (Comb + Allpass filters)."));
+      Serial.println(F("Feedback delay network reverb (4 lines, 4 diffusers)."));
       Serial.println();
       Serial.println(F("PARAMETERS:"));
-      Serial.println(F("  room <n>     - Room size 0.0-1.0 (feedback)"));
+      Serial.println(F("  room <n>     - Room size 0.0-1.0 (decay 0.4-8 s)"));
       Serial.println(F("  damping <n>  - High-freq damping 0.0-1.0"));
       Serial.println(F("  wet <n>      - Wet/Dry mix 0.0-1.0"));
       Serial.println();
@@ -1385,6 +2449,26 @@ void AudioConsole::cmdHelp(String args) {
       Serial.println(F("  audio reverb wet 0.4     # 40% reverb"));
       Serial.println();
 
+    } else if (cmd == "envelope" || cmd == "env" || cmd == "adsr") {
+      Serial.println();
+      Serial.println(F("audio envelope [<a> <d> <s> <r>|attack|decay|sustain|release|curve]"));
+      Serial.println(F("ADSR amplitude envelope shared by all voices."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  attack <ms>      - Rise to full level, 1-10000 ms"));
+      Serial.println(F("  decay <ms>       - Fall to sustain, 1-10000 ms"));
+      Serial.println(F("  sustain <n>      - Held level 0-255"));
+      Serial.println(F("  release <ms>     - Fade after note off, 1-10000 ms"));
+      Serial.println(F("  curve <type>     - linear or exp (RC-style)"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio envelope 2 150 0 100      # Percussive pluck"));
+      Serial.println(F("  audio envelope 800 500 200 1500 # Slow pad"));
+      Serial.println(F("  audio envelope curve exp"));
+      Serial.println();
+      Serial.println(F("Saved with the profile ('audio profile save')."));
+      Serial.println();
+
     } else if (cmd == "lfo") {
       Serial.println();
       Serial.println(F("audio lfo [on|off|vibrato|tremolo|rate|depth]"));
@@ -1409,8 +2493,9 @@ void AudioConsole::cmdHelp(String args) {
 
     } else if (cmd == "filter") {
       Serial.println();
-      Serial.println(F("audio filter [on|off|type|cutoff|resonance]"));
-      Serial.println(F("State-Variable Filter (LP/HP/BP)."));
+      Serial.println(F("audio filter [on|off|type|cutoff|resonance|voice|bus|env]"));
+      Serial.println(F("State-Variable Filter (LP/HP/BP), zero-delay feedback, fixed point."));
+      Serial.println(F("One filter on the mix, or one per voice. Setting changes glide."));
       Serial.println();
       Serial.println(F("PARAMETERS:"));
       Serial.println(F("  lowpass      - Low-pass filter"));
@@ -1418,29 +2503,46 @@ void AudioConsole::cmdHelp(String args) {
       Serial.println(F("  bandpass     - Band-pass filter"));
       Serial.println(F("  cutoff <n>   - Cutoff frequency 20-20000 Hz"));
       Serial.println(F("  resonance <n>- Resonance 0.0-1.0"));
+      Serial.println(F("  voice        - One filter per voice"));
+      Serial.println(F("  bus          - One filter on the mix"));
+      Serial.println(F("  env <n>      - Per voice: octaves added at full envelope"));
+      Serial.println(F("                 and velocity, -8 to 8"));
       Serial.println();
       Serial.println(F("EXAMPLES:"));
       Serial.println(F("  audio filter on"));
       Serial.println(F("  audio filter lowpass"));
       Serial.println(F("  audio filter cutoff 800"));
       Serial.println(F("  audio filter resonance 0.7"));
+      Serial.println(F("  audio filter voice"));
+      Serial.println(F("  audio filter env 3"));
       Serial.println();
 
     } else if (cmd == "eq") {
       Serial.println();
-      Serial.println(F("audio eq [on|off|bass|mid|treble]"));
-      Serial.println(F("3-band Biquad EQ."));
+      Serial.println(F("audio eq [on|off|bass|mid|treble|band]"));
+      Serial.println(F("Biquad EQ: up to 8 sections in series, fixed point."));
+      Serial.println(F("Runs on the mix before the filter. Setting changes glide."));
       Serial.println();
       Serial.println(F("PARAMETERS:"));
-      Serial.println(F("  bass <n>     - Bass gain -12 to +12 dB (120 Hz)"));
-      Serial.println(F("  mid <n>      - Mid gain -12 to +12 dB (1000 Hz)"));
-      Serial.println(F("  treble <n>   - Treble gain -12 to +12 dB (8000 Hz)"));
+      Serial.println(F("  bass <n>     - Band 0 gain -12 to +12 dB (low shelf, 120 Hz)"));
+      Serial.println(F("  mid <n>      - Band 1 gain -12 to +12 dB (peak, 1000 Hz)"));
+      Serial.println(F("  treble <n>   - Band 2 gain -12 to +12 dB (high shelf, 8000 Hz)"));
+      Serial.println(F("  band <0-7> <type> [freq] [gain] [q]"));
+      Serial.println(F("               - Any section; omitted values are kept"));
+      Serial.println();
+      Serial.println(F("TYPES:"));
+      Serial.println(F("  peak (bell), lowshelf (ls), highshelf (hs)  - use gain"));
+      Serial.println(F("  notch, lowpass (lp), highpass (hp)          - gain ignored"));
+      Serial.println(F("  off                                         - section skipped"));
+      Serial.println(F("  freq 20 Hz to 0.45 x rate, q 0.3 to 10"));
       Serial.println();
       Serial.println(F("EXAMPLES:"));
       Serial.println(F("  audio eq on"));
       Serial.println(F("  audio eq bass +6"));
-      Serial.println(F("  audio eq mid -3"));
       Serial.println(F("  audio eq treble +4"));
+      Serial.println(F("  audio eq band 3 peak 3000 -4 2.0"));
+      Serial.println(F("  audio eq band 4 highpass 40"));
+      Serial.println(F("  audio eq band 4 off"));
       Serial.println();
 
     } else if (cmd == "waveform" || cmd == "wave") {
@@ -1460,6 +2562,174 @@ void AudioConsole::cmdHelp(String args) {
       Serial.println(F("  audio waveform square"));
       Serial.println();
 
+    } else if (cmd == "oscillator" || cmd == "osc") {
+      Serial.println();
+      Serial.println(F("audio oscillator <naive|wavetable|polyblep>"));
+      Serial.println(F("Select how square, sawtooth and triangle are generated."));
+      Serial.println();
+      Serial.println(F("MODES:"));
+      Serial.println(F("  naive     - Cheapest, audible aliasing on high notes"));
+      Serial.println(F("  wavetable - Band-limited mip-mapped tables (flash)"));
+      Serial.println(F("  polyblep  - Fixed-point PolyBLEP square/saw, no tables"));
+      Serial.println(F("              (triangle stays naive)"));
+      Serial.println();
+      Serial.println(F("Stored in the profile as audio.oscillator."));
+      Serial.println();
+
+    } else if (cmd == "pan") {
+      Serial.println();
+      Serial.println(F("audio pan <0-100>"));
+      Serial.println(F("Spread voices across the stereo field by pitch."));
+      Serial.println(F("0 keeps every voice centered; 100 puts two octaves"));
+      Serial.println(F("below/above middle C at hard left/right. Applies to"));
+      Serial.println(F("notes started afterwards."));
+      Serial.println();
+      Serial.println(F("audio note <n> <ms> <pan> places one note directly"));
+      Serial.println(F("(MIDI pan: 0-127, 64 = center)."));
+      Serial.println();
+      Serial.println(F("Stored in the profile as audio.panSpread."));
+      Serial.println();
+
+    } else if (cmd == "delay") {
+      Serial.println();
+      Serial.println(F("audio delay [on|off|time|tap|feedback|mix|mod]"));
+      Serial.println(F("Echo fed with the channel sum, returned on both sides."));
+      Serial.println(F("Time changes glide over ~150 ms like a tape transport"));
+      Serial.println(F("(the echo bends in pitch instead of clicking)."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  time <ms>        - Delay time 10-1000"));
+      Serial.println(F("  tap              - Send twice or more in tempo; the"));
+      Serial.println(F("                     mean of the last 4 gaps sets the time"));
+      Serial.println(F("  feedback <%>     - Repeats 0-90"));
+      Serial.println(F("  mix <%>          - Wet level 0-100"));
+      Serial.println(F("  mod <ms> [Hz]    - Tape wow: delay time swings by up"));
+      Serial.println(F("                     to 10 ms at 0.1-10 Hz, 0 = off"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio delay time 375     # Dotted eighth at 120 BPM"));
+      Serial.println(F("  audio delay mod 2 0.8    # Gentle tape wow"));
+      Serial.println();
+
+    } else if (cmd == "chorus") {
+      Serial.println();
+      Serial.println(F("audio chorus [on|off|voices|rate|delay|depth|mix]"));
+      Serial.println(F("Copies of the channel sum, each read from a delay swept"));
+      Serial.println(F("by a slow triangle LFO at its own phase. Two voices go"));
+      Serial.println(F("left and right; a third sits in the middle."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  voices <n>       - 2 or 3"));
+      Serial.println(F("  rate <Hz>        - Sweep rate 0.05-5.0"));
+      Serial.println(F("  delay <ms>       - Center delay 5-30"));
+      Serial.println(F("  depth <ms>       - Sweep either side 0-10 (at most"));
+      Serial.println(F("                     the delay)"));
+      Serial.println(F("  mix <%>          - Wet level 0-100"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio chorus rate 0.5    # Slow, wide ensemble"));
+      Serial.println(F("  audio chorus depth 1     # Subtle doubling"));
+      Serial.println();
+
+    } else if (cmd == "flanger" || cmd == "flange") {
+      Serial.println();
+      Serial.println(F("audio flanger [on|off|rate|delay|depth|feedback|mix]"));
+      Serial.println(F("A short swept delay mixed with the dry signal: a comb"));
+      Serial.println(F("of notches that moves with the LFO. Each side has its"));
+      Serial.println(F("own line; the right sweep runs a quarter cycle ahead."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  rate <Hz>        - Sweep rate 0.05-5.0"));
+      Serial.println(F("  delay <ms>       - Center delay 0.5-10"));
+      Serial.println(F("  depth <ms>       - Sweep either side 0-5 (at most"));
+      Serial.println(F("                     the delay)"));
+      Serial.println(F("  feedback <%>     - Resonance -90 to 90; negative"));
+      Serial.println(F("                     gives the hollow, inverted sound"));
+      Serial.println(F("  mix <%>          - Wet level 0-100, 50 = deepest"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio flanger feedback 80  # Jet sweep"));
+      Serial.println(F("  audio flanger rate 0.1     # Slow swoosh"));
+      Serial.println();
+
+    } else if (cmd == "convolver" || cmd == "conv") {
+      Serial.println();
+      Serial.println(F("audio conv [on|off|load|mix]"));
+      Serial.println(F("Convolves the output with an impulse response from a"));
+      Serial.println(F("WAV file: a measured speaker correction, a cabinet or a"));
+      Serial.println(F("small room. Runs after the EQ. Stereo files are mixed to"));
+      Serial.println(F("mono and converted to the engine rate; IRs longer than"));
+      Serial.printf("%u samples are cut.\n", CONV_MAX_IR_LENGTH);
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  load <file>      - 8/16-bit WAV on the filesystem"));
+      Serial.println(F("  mix <%>          - Wet level 0-100 (100 = IR only)"));
+      Serial.println();
+      Serial.println(F("IRs over 32 samples use FFT partitions the size of the"));
+      Serial.println(F("I2S block, which delays the output by one block while"));
+      Serial.println(F("the convolver is on. Shorter ones add no delay."));
+      Serial.println(F("'audio status' shows what it costs."));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio conv load /ir/speaker.wav  # Small-speaker EQ"));
+      Serial.println(F("  audio conv on"));
+      Serial.println();
+
+    } else if (cmd == "compressor" || cmd == "comp") {
+      Serial.println();
+      Serial.println(F("audio comp [on|off|threshold|ratio|attack|release|makeup]"));
+      Serial.println(F("Feed-forward compressor ahead of the limiter. Above the"));
+      Serial.println(F("threshold, every <ratio> dB in gives 1 dB out. Both sides"));
+      Serial.println(F("share one gain, so the stereo image holds still."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  threshold <dB> - Where compression starts, -48.0 to 0.0"));
+      Serial.println(F("  ratio <n>      - 1.0 (off) to 20.0 (limiting)"));
+      Serial.println(F("  attack <ms>    - How fast it reacts, 0.1-200"));
+      Serial.println(F("  release <ms>   - How fast it lets go, 10-2000"));
+      Serial.println(F("  makeup <dB>    - Gain after compression, 0.0-24.0"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio comp threshold -18   # Gentle bus glue with"));
+      Serial.println(F("  audio comp ratio 2         # a 2:1 ratio"));
+      Serial.println(F("  audio comp makeup 4        # Win back the level"));
+      Serial.println();
+
+    } else if (cmd == "limiter" || cmd == "limit") {
+      Serial.println();
+      Serial.println(F("audio limiter [on|off|ceiling|release|reset]"));
+      Serial.println(F("Lookahead peak limiter, the last stage before output."));
+      Serial.println(F("Voices are summed at a fixed gain (1/sqrt(voices)), so"));
+      Serial.println(F("a note keeps its level when others start or stop; the"));
+      Serial.println(F("limiter pulls chords back under the ceiling instead."));
+      Serial.println();
+      Serial.println(F("PARAMETERS:"));
+      Serial.println(F("  ceiling <dB> - Peak output level, -24.0 to 0.0 dBFS"));
+      Serial.println(F("  release <ms> - Recovery time after a peak, 10-2000"));
+      Serial.println(F("  reset        - Clear the peak gain reduction meter"));
+      Serial.println();
+      Serial.println(F("EXAMPLES:"));
+      Serial.println(F("  audio limiter ceiling -3  # 3 dB below full scale"));
+      Serial.println(F("  audio limiter release 50  # Faster recovery"));
+      Serial.println();
+
+    } else if (cmd == "steal") {
+      Serial.println();
+      Serial.println(F("audio steal <oldest|quietest|releasing|samenote>"));
+      Serial.println(F("Choose the voice a new note takes when all are busy."));
+      Serial.println(F("A free voice is always used first; a stolen voice fades"));
+      Serial.println(F("out over 2 ms before the new note starts."));
+      Serial.println();
+      Serial.println(F("POLICIES:"));
+      Serial.println(F("  oldest    - Longest-sounding voice"));
+      Serial.println(F("  quietest  - Lowest envelope * velocity"));
+      Serial.println(F("  releasing - Oldest released voice, else oldest"));
+      Serial.println(F("  samenote  - A repeated note retriggers its own voice"));
+      Serial.println(F("              (even if others are free), else releasing"));
+      Serial.println();
+      Serial.println(F("Stored in the profile as audio.voiceSteal."));
+      Serial.println();
+
     } else {
       Serial.printf("No detailed help for: %s\n", cmd.c_str());
       Serial.println(F("Use 'audio help' for overview"));
@@ -1469,6 +2739,63 @@ void AudioConsole::cmdHelp(String args) {
 }
 
 
+// ============================================================================
+// IMPULSE RESPONSE LOADER
+// ============================================================================
+// Read through the WAV codec (mixed to mono), rate-convert to the engine
+// and hand the taps to the engine; everything here is control side
+bool AudioConsole::loadImpulseResponse(const char* path) {
+  if (!filesystem || !filesystem->isInitialized()) {
+    Serial.println(F("[ERROR] Filesystem not mounted"));
+    return false;
+  }
+
+  AudioCodec* codec = codecManager ? codecManager->detectCodec(path) : nullptr;
+  if (!codec || !codec->open(path)) {
+    Serial.printf("[ERROR] Cannot open impulse response: %s\n", path);
+    return false;
+  }
+
+  AudioFormat format = codec->getFormat();
+  uint32_t engineRate = audio->getSampleRate();
+  uint32_t fileRate = format.sampleRate ? format.sampleRate : engineRate;
+
+  // Only what survives the cut at the engine rate is read
+  uint32_t maxFileTaps = (uint32_t)((uint64_t)CONV_MAX_IR_LENGTH * fileRate / engineRate);
+  int16_t* raw = (int16_t*)malloc(maxFileTaps * sizeof(int16_t));
+  int16_t* ir = (int16_t*)malloc(CONV_MAX_IR_LENGTH * sizeof(int16_t));
+  if (!raw || !ir) {
+    free(raw);
+    free(ir);
+    codec->close();
+    Serial.println(F("[ERROR] Out of memory for impulse response"));
+    return false;
+  }
+
+  uint32_t fileTaps = codec->read(raw, maxFileTaps);
+  bool cut = (fileTaps == maxFileTaps) && (codec->read(ir, 1) == 1);
+  codec->close();
+
+  uint32_t taps = fileTaps;
+  if (fileRate != engineRate) {
+    taps = Convolver::resample(raw, fileTaps, fileRate, ir, CONV_MAX_IR_LENGTH, engineRate);
+    Serial.printf("[AUDIO] IR resampled %u Hz -> %u Hz (%u -> %u taps)\n",
+                  fileRate, engineRate, fileTaps, taps);
+  } else {
+    memcpy(ir, raw, taps * sizeof(int16_t));
+  }
+  if (cut) {
+    Serial.printf("[WARN] Impulse response cut to %u samples\n", CONV_MAX_IR_LENGTH);
+  }
+
+  bool ok = taps > 0 && audio->loadImpulseResponse(ir, taps, path);
+  if (taps == 0) Serial.printf("[ERROR] No samples in %s\n", path);
+  free(raw);
+  free(ir);
+  return ok;
+}
+
+
 // ============================================================================
 // MELODY JSON LOADER
 // ============================================================================
@@ -45,12 +45,21 @@ private:
   void cmdStop(String args);
   void cmdVolume(String args);
   void cmdNote(String args);
+  void cmdPan(String args);
   void cmdWaveform(String args);
+  void cmdOscillator(String args);
+  void cmdSteal(String args);
   void cmdEQ(String args);
   void cmdFilter(String args);
   void cmdReverb(String args);
   void cmdLFO(String args);
+  void cmdEnvelope(String args);
   void cmdDelay(String args);
+  void cmdChorus(String args);
+  void cmdFlanger(String args);
+  void cmdConvolver(String args);
+  void cmdCompressor(String args);
+  void cmdLimiter(String args);
   void cmdProfile(String args);
   void cmdMode(String args);
   void cmdHardware(String args);
@@ -58,6 +67,8 @@ private:
   void cmdCodec(String args);
   void cmdList(String args);
   void cmdTest(String args);
+  void cmdBench(String args);
+  void cmdXruns(String args);
   void cmdReset(String args);
   void cmdReboot(String args);
 
@@ -72,6 +83,9 @@ public:
   AudioConsole();
   void init(AudioEngine* audioEngine, AudioProfile* profMgr, AudioFilesystem* fs, AudioCodecManager* codecMgr);
   void update();
+
+  // Impulse response WAV -> engine convolver (does not enable it)
+  bool loadImpulseResponse(const char* path);
 };
 
 #endif // AUDIOCONSOLE_H
@@ -0,0 +1,318 @@
+// AudioConvolver.cpp - ESP32 Audio OS v2.0
+// Uniformly partitioned overlap-save convolution for short impulse responses
+
+#include "AudioConvolver.h"
+#include <math.h>
+
+Convolver::Convolver()
+  : taps(0), direct(false), memory(0),
+    partSize(0), fftSize(0), partitions(0),
+    irSpectra(nullptr), history(nullptr), historySlot(0), accum(nullptr),
+    input(nullptr), previous(nullptr), output(nullptr), fill(0),
+    twiddle(nullptr), bitReverse(nullptr),
+    coef(nullptr), delay(nullptr), delayPos(0) {}
+
+Convolver::~Convolver() {
+  deallocate();
+}
+
+// ============================================================================
+// SETUP (control side)
+// ============================================================================
+
+void* Convolver::allocate(uint32_t bytes) {
+  void* block = malloc(bytes);
+  if (block) {
+    memset(block, 0, bytes);
+    memory += bytes;
+  }
+  return block;
+}
+
+bool Convolver::build(const int16_t* ir, uint32_t irTaps, uint32_t blockSize) {
+  deallocate();
+  if (irTaps == 0) return false;
+  if (irTaps > CONV_MAX_IR_LENGTH) irTaps = CONV_MAX_IR_LENGTH;
+  taps = irTaps;
+
+  if (taps <= CONV_DIRECT_MAX_TAPS) {
+    direct = true;
+    coef = (float*)allocate(taps * sizeof(float));
+    delay = (ConvolverComplex*)allocate(2 * taps * sizeof(ConvolverComplex));
+    if (!coef || !delay) {
+      deallocate();
+      return false;
+    }
+    for (uint32_t k = 0; k < taps; k++) coef[k] = ir[k] / 32768.0f;
+    return true;
+  }
+
+  // Partition = the block, rounded down to a power of two
+  partSize = CONV_MIN_PARTITION;
+  while (partSize * 2 <= blockSize && partSize * 2 <= CONV_MAX_PARTITION) partSize *= 2;
+  fftSize = partSize * 2;
+  partitions = (taps + partSize - 1) / partSize;
+
+  uint32_t bins = partSize + 1;
+  irSpectra = (ConvolverComplex*)allocate(partitions * bins * sizeof(ConvolverComplex));
+  history = (ConvolverComplex*)allocate(partitions * fftSize * sizeof(ConvolverComplex));
+  accum = (ConvolverComplex*)allocate(fftSize * sizeof(ConvolverComplex));
+  input = (ConvolverComplex*)allocate(partSize * sizeof(ConvolverComplex));
+  previous = (ConvolverComplex*)allocate(partSize * sizeof(ConvolverComplex));
+  output = (ConvolverComplex*)allocate(partSize * sizeof(ConvolverComplex));
+  twiddle = (ConvolverComplex*)allocate(partSize * sizeof(ConvolverComplex));
+  bitReverse = (uint16_t*)allocate(fftSize * sizeof(uint16_t));
+  if (!irSpectra || !history || !accum || !input || !previous || !output ||
+      !twiddle || !bitReverse) {
+    deallocate();
+    return false;
+  }
+
+  for (uint32_t k = 0; k < partSize; k++) {
+    float angle = -2.0f * PI * k / fftSize;
+    twiddle[k].re = cosf(angle);
+    twiddle[k].im = sinf(angle);
+  }
+
+  uint32_t bits = 0;
+  while ((1u << bits) < fftSize) bits++;
+  for (uint32_t i = 0; i < fftSize; i++) {
+    uint32_t r = 0;
+    for (uint32_t b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+    bitReverse[i] = r;
+  }
+
+  // Each partition zero-padded to 2B; the inverse FFT's 1/2B is folded in
+  float scale = 1.0f / (32768.0f * fftSize);
+  for (uint32_t p = 0; p < partitions; p++) {
+    memset(accum, 0, fftSize * sizeof(ConvolverComplex));
+    for (uint32_t k = 0; k < partSize && p * partSize + k < taps; k++) {
+      accum[k].re = ir[p * partSize + k] * scale;
+    }
+    fft(accum, false);
+    memcpy(irSpectra + p * bins, accum, bins * sizeof(ConvolverComplex));
+  }
+
+  reset();
+  return true;
+}
+
+void Convolver::deallocate() {
+  free(irSpectra);
+  free(history);
+  free(accum);
+  free(input);
+  free(previous);
+  free(output);
+  free(twiddle);
+  free(bitReverse);
+  free(coef);
+  free(delay);
+  irSpectra = history = accum = input = previous = output = twiddle = delay = nullptr;
+  bitReverse = nullptr;
+  coef = nullptr;
+  taps = partitions = partSize = fftSize = memory = 0;
+  direct = false;
+}
+
+void Convolver::reset() {
+  if (direct) {
+    memset(delay, 0, 2 * taps * sizeof(ConvolverComplex));
+    delayPos = 0;
+    return;
+  }
+  if (!history) return;
+  memset(history, 0, partitions * fftSize * sizeof(ConvolverComplex));
+  memset(input, 0, partSize * sizeof(ConvolverComplex));
+  memset(previous, 0, partSize * sizeof(ConvolverComplex));
+  memset(output, 0, partSize * sizeof(ConvolverComplex));
+  historySlot = 0;
+  fill = 0;
+}
+
+// ============================================================================
+// FFT (radix-2, in place, unscaled)
+// ============================================================================
+
+void Convolver::fft(ConvolverComplex* x, bool inverse) {
+  uint32_t n = fftSize;
+
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t j = bitReverse[i];
+    if (i < j) {
+      ConvolverComplex t = x[i];
+      x[i] = x[j];
+      x[j] = t;
+    }
+  }
+
+  float sign = inverse ? -1.0f : 1.0f;
+  for (uint32_t half = 1; half < n; half <<= 1) {
+    uint32_t stride = partSize / half;    // Twiddle step at this size
+    for (uint32_t i = 0; i < n; i += 2 * half) {
+      ConvolverComplex* a = x + i;
+      ConvolverComplex* b = a + half;
+      for (uint32_t k = 0; k < half; k++) {
+        float wr = twiddle[k * stride].re;
+        float wi = twiddle[k * stride].im * sign;
+        float tr = b[k].re * wr - b[k].im * wi;
+        float ti = b[k].re * wi + b[k].im * wr;
+        b[k].re = a[k].re - tr;
+        b[k].im = a[k].im - ti;
+        a[k].re += tr;
+        a[k].im += ti;
+      }
+    }
+  }
+}
+
+// ============================================================================
+// PROCESSING (audio side)
+// ============================================================================
+
+// One full partition in: frame = [previous, input], multiply-add against
+// every IR partition, back to time and keep the second half (overlap-save)
+void Convolver::processPartition() {
+  ConvolverComplex* frame = history + historySlot * fftSize;
+  memcpy(frame, previous, partSize * sizeof(ConvolverComplex));
+  memcpy(frame + partSize, input, partSize * sizeof(ConvolverComplex));
+  fft(frame, false);
+
+  // IR bins above B mirror the ones below (real IR): H[2B - m] = conj(H[m])
+  uint32_t bins = partSize + 1;
+  for (uint32_t p = 0; p < partitions; p++) {
+    uint32_t slot = (historySlot + partitions - p) % partitions;
+    const ConvolverComplex* x = history + slot * fftSize;
+    const ConvolverComplex* h = irSpectra + p * bins;
+
+    if (p == 0) {
+      for (uint32_t m = 0; m < bins; m++) {
+        accum[m].re = x[m].re * h[m].re - x[m].im * h[m].im;
+        accum[m].im = x[m].re * h[m].im + x[m].im * h[m].re;
+      }
+      for (uint32_t m = bins; m < fftSize; m++) {
+        const ConvolverComplex& hm = h[fftSize - m];
+        accum[m].re = x[m].re * hm.re + x[m].im * hm.im;
+        accum[m].im = x[m].im * hm.re - x[m].re * hm.im;
+      }
+    } else {
+      for (uint32_t m = 0; m < bins; m++) {
+        accum[m].re += x[m].re * h[m].re - x[m].im * h[m].im;
+        accum[m].im += x[m].re * h[m].im + x[m].im * h[m].re;
+      }
+      for (uint32_t m = bins; m < fftSize; m++) {
+        const ConvolverComplex& hm = h[fftSize - m];
+        accum[m].re += x[m].re * hm.re + x[m].im * hm.im;
+        accum[m].im += x[m].im * hm.re - x[m].re * hm.im;
+      }
+    }
+  }
+
+  fft(accum, true);
+  memcpy(output, accum + partSize, partSize * sizeof(ConvolverComplex));
+
+  ConvolverComplex* t = previous;
+  previous = input;
+  input = t;
+  historySlot = (historySlot + 1) % partitions;
+}
+
+void Convolver::process(float* buf, uint32_t frames, float wet) {
+  if (direct) {
+    processDirect(buf, frames, wet);
+    return;
+  }
+
+  float dry = 1.0f - wet;
+  while (frames > 0) {
+    uint32_t run = partSize - fill;
+    if (run > frames) run = frames;
+
+    ConvolverComplex* in = input + fill;
+    const ConvolverComplex* dryIn = previous + fill;
+    const ConvolverComplex* out = output + fill;
+    for (uint32_t i = 0; i < run; i++) {
+      in[i].re = buf[i * 2];
+      in[i].im = buf[i * 2 + 1];
+      buf[i * 2] = dryIn[i].re * dry + out[i].re * wet;
+      buf[i * 2 + 1] = dryIn[i].im * dry + out[i].im * wet;
+    }
+
+    fill += run;
+    if (fill == partSize) {
+      processPartition();
+      fill = 0;
+    }
+    buf += run * 2;
+    frames -= run;
+  }
+}
+
+// Newest input at delay[delayPos] and again taps later, so the taps read
+// straight through
+void Convolver::processDirect(float* buf, uint32_t frames, float wet) {
+  float dry = 1.0f - wet;
+  for (uint32_t i = 0; i < frames; i++) {
+    float left = buf[i * 2];
+    float right = buf[i * 2 + 1];
+
+    delayPos = (delayPos == 0 ? taps : delayPos) - 1;
+    delay[delayPos].re = delay[delayPos + taps].re = left;
+    delay[delayPos].im = delay[delayPos + taps].im = right;
+
+    const ConvolverComplex* x = delay + delayPos;
+    float accL = 0.0f, accR = 0.0f;
+    for (uint32_t k = 0; k < taps; k++) {
+      accL += coef[k] * x[k].re;
+      accR += coef[k] * x[k].im;
+    }
+
+    buf[i * 2] = left * dry + accL * wet;
+    buf[i * 2 + 1] = right * dry + accR * wet;
+  }
+}
+
+void Convolver::continueFrom(const Convolver& old) {
+  if (direct || old.direct || old.partSize != partSize || !old.input) return;
+  memcpy(input, old.input, partSize * sizeof(ConvolverComplex));
+  memcpy(previous, old.previous, partSize * sizeof(ConvolverComplex));
+  memcpy(output, old.output, partSize * sizeof(ConvolverComplex));
+  fill = old.fill;
+}
+
+// ============================================================================
+// IR RATE CHANGE (control side)
+// ============================================================================
+
+uint32_t Convolver::resample(const int16_t* in, uint32_t inTaps, uint32_t inRate,
+                             int16_t* out, uint32_t outMax, uint32_t outRate) {
+  const float halfWidth = 8.0f;                 // Zero crossings each side
+  float step = (float)inRate / outRate;         // Input samples per output
+  float cutoff = step > 1.0f ? 1.0f / step : 1.0f;
+  int32_t reach = (int32_t)ceilf(halfWidth / cutoff);
+
+  // A tap stands for 1/rate of the response, so taps scale with step
+  float gain = cutoff * step;
+
+  uint32_t count = (uint32_t)((uint64_t)inTaps * outRate / inRate);
+  if (count > outMax) count = outMax;
+
+  for (uint32_t n = 0; n < count; n++) {
+    float t = n * step;
+    int32_t centre = (int32_t)t;
+    float acc = 0.0f;
+    for (int32_t k = centre - reach + 1; k <= centre + reach; k++) {
+      if (k < 0 || k >= (int32_t)inTaps) continue;
+      float x = (t - k) * cutoff;
+      if (fabsf(x) >= halfWidth) continue;
+      float window = 0.5f + 0.5f * cosf(PI * x / halfWidth);
+      float sinc = (x == 0.0f) ? 1.0f : sinf(PI * x) / (PI * x);
+      acc += in[k] * sinc * window;
+    }
+    acc *= gain;
+    if (acc > 32767.0f) acc = 32767.0f;
+    if (acc < -32768.0f) acc = -32768.0f;
+    out[n] = (int16_t)lrintf(acc);
+  }
+  return count;
+}
@@ -0,0 +1,96 @@
+// AudioConvolver.h - ESP32 Audio OS v2.0
+// Uniformly partitioned overlap-save convolution for short impulse responses
+//
+// The impulse response is cut into partitions of B samples (the I2S block,
+// rounded down to a power of two) and each one is transformed once, at load,
+// into a 2B-point spectrum. Every B frames the newest 2B inputs are
+// transformed, multiplied with the partition spectra against the last P
+// input spectra and transformed back: one forward and one inverse FFT plus
+// P complex multiply-adds per bin, however the IR is split.
+//
+// Left and right share one complex FFT as its real and imaginary parts. The
+// IR is real, so its spectrum filters both without mixing them (the
+// two-signals-per-transform form of a real FFT). Frames pass through a
+// B-frame FIFO, so the stage delays dry and wet alike by one partition. IRs
+// of up to CONV_DIRECT_MAX_TAPS run as a direct FIR instead, with no delay.
+
+#ifndef AUDIO_CONVOLVER_H
+#define AUDIO_CONVOLVER_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+
+struct ConvolverComplex {
+  float re;
+  float im;
+};
+
+// ============================================================================
+// CONVOLVER
+// ============================================================================
+class Convolver {
+public:
+  Convolver();
+  ~Convolver();
+
+  // Control side: builds the partitions for ir (Q15, at the engine rate, at
+  // most CONV_MAX_IR_LENGTH taps) for blocks of blockSize frames. Allocates
+  // and runs the FFTs, so never on the audio task.
+  bool build(const int16_t* ir, uint32_t taps, uint32_t blockSize);
+  void deallocate();
+
+  // Clears the signal history; the IR stays
+  void reset();
+
+  // Audio side, when this one replaces old: keeps the FIFO (and so the
+  // delayed dry) running if both use the same partition size
+  void continueFrom(const Convolver& old);
+
+  // Filters buf (interleaved L/R) in place; wet is the 0-1 share
+  void process(float* buf, uint32_t frames, float wet);
+
+  uint32_t getTaps() const { return taps; }
+  uint32_t getPartitionSize() const { return partSize; }
+  uint32_t getPartitions() const { return partitions; }
+  bool isDirect() const { return direct; }
+  uint32_t getLatency() const { return direct ? 0 : partSize; }
+  uint32_t getMemory() const { return memory; }
+
+  // Control side: band-limited rate change of an IR (windowed sinc cut at
+  // the lower Nyquist, gain kept). Returns the taps written to out.
+  static uint32_t resample(const int16_t* in, uint32_t inTaps, uint32_t inRate,
+                           int16_t* out, uint32_t outMax, uint32_t outRate);
+
+private:
+  uint32_t taps;
+  bool direct;
+  uint32_t memory;                // Bytes allocated
+
+  // Partitioned (FFT) form
+  uint32_t partSize;              // B
+  uint32_t fftSize;               // 2B
+  uint32_t partitions;            // P
+  ConvolverComplex* irSpectra;    // P x (B + 1) bins; the rest by symmetry
+  ConvolverComplex* history;      // P input spectra (2B bins each), a ring
+  uint32_t historySlot;           // Newest spectrum in history
+  ConvolverComplex* accum;        // 2B bins, then the wet frame
+  ConvolverComplex* input;        // Partition being filled (L = re, R = im)
+  ConvolverComplex* previous;     // Last full partition: the first half of
+                                  // the next frame and the dry of output
+  ConvolverComplex* output;       // Wet of previous
+  uint32_t fill;                  // Frames in input
+  ConvolverComplex* twiddle;      // e^(-2 pi i k / 2B), k < B
+  uint16_t* bitReverse;           // 2B entries
+
+  // Direct form
+  float* coef;                    // taps, newest-first order
+  ConvolverComplex* delay;        // 2 x taps, mirrored so reads never wrap
+  uint32_t delayPos;
+
+  void* allocate(uint32_t bytes);
+  void fft(ConvolverComplex* x, bool inverse);
+  void processPartition();
+  void processDirect(float* buf, uint32_t frames, float wet);
+};
+
+#endif // AUDIO_CONVOLVER_H
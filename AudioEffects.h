@@ -0,0 +1,1133 @@
+// AudioEffects.h - ESP32 Audio OS v2.0
+// DSP building blocks used by the AudioEngine effect chain
+
+#ifndef AUDIO_EFFECTS_H
+#define AUDIO_EFFECTS_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+#include "AudioSettings.h"
+
+// ============================================================================
+// BIQUAD CASCADE (EQ, fixed point)
+// ============================================================================
+// Up to EQ_MAX_BANDS sections in series on the int32 bus, each a Direct
+// Form II transposed biquad with Q28 coefficients. The bus enters shifted
+// up EQ_GUARD_BITS. Products are 32x32->64 and the two states per channel
+// stay 64-bit, so the feedback path never drops bits. The output of each
+// section is rounded once, and that rounding residue goes into the next
+// sample (first-order error feedback). Without it, a 60 Hz shelf at 22 kHz
+// adds tens of LSB of noise; with it, about a tenth of one.
+//
+// A section that is flat (off, or a 0 dB peak/shelf) has the identity
+// coefficients and is skipped once it has settled there. New settings ramp
+// in as straight-line steps between the old and new coefficient sets, once
+// per PARAM_SMOOTH_FRAMES. Every set on that line is stable, because the
+// stable (a1, a2) region is convex.
+struct BiquadCoefficients {
+  int32_t b0, b1, b2;
+  int32_t a1, a2;               // Signs as in y = b.x - a.y
+  
+  static BiquadCoefficients identity() {
+    BiquadCoefficients c = { 1 << EQ_COEF_BITS, 0, 0, 0, 0 };
+    return c;
+  }
+  
+  bool operator==(const BiquadCoefficients& o) const {
+    return b0 == o.b0 && b1 == o.b1 && b2 == o.b2 && a1 == o.a1 && a2 == o.a2;
+  }
+  bool operator!=(const BiquadCoefficients& o) const { return !(*this == o); }
+  
+  // Control side: the RBJ cookbook response for any section type. Done in
+  // double, because float cannot resolve a1 as finely as Q28 can near DC.
+  static BiquadCoefficients design(BiquadType type, float freq, float gainDb,
+                                   float q, float sampleRate) {
+    bool hasGain = (type == BIQUAD_PEAK || type == BIQUAD_LOWSHELF || type == BIQUAD_HIGHSHELF);
+    if (type == BIQUAD_OFF || (hasGain && gainDb == 0.0f)) return identity();
+    if (freq > 0.45f * sampleRate) freq = 0.45f * sampleRate;
+    
+    double w = 2.0 * PI * freq / sampleRate;
+    double cs = cos(w);
+    double alpha = sin(w) / (2.0 * q);
+    double A = pow(10.0, gainDb / 40.0);
+    double beta = 2.0 * sqrt(A) * alpha;
+    double b0, b1, b2, a0, a1, a2;
+    
+    switch (type) {
+      case BIQUAD_PEAK:
+        b0 = 1.0 + alpha * A;
+        b1 = -2.0 * cs;
+        b2 = 1.0 - alpha * A;
+        a0 = 1.0 + alpha / A;
+        a1 = -2.0 * cs;
+        a2 = 1.0 - alpha / A;
+        break;
+      case BIQUAD_LOWSHELF:
+        b0 = A * ((A + 1.0) - (A - 1.0) * cs + beta);
+        b1 = 2.0 * A * ((A - 1.0) - (A + 1.0) * cs);
+        b2 = A * ((A + 1.0) - (A - 1.0) * cs - beta);
+        a0 = (A + 1.0) + (A - 1.0) * cs + beta;
+        a1 = -2.0 * ((A - 1.0) + (A + 1.0) * cs);
+        a2 = (A + 1.0) + (A - 1.0) * cs - beta;
+        break;
+      case BIQUAD_HIGHSHELF:
+        b0 = A * ((A + 1.0) + (A - 1.0) * cs + beta);
+        b1 = -2.0 * A * ((A - 1.0) + (A + 1.0) * cs);
+        b2 = A * ((A + 1.0) + (A - 1.0) * cs - beta);
+        a0 = (A + 1.0) - (A - 1.0) * cs + beta;
+        a1 = 2.0 * ((A - 1.0) - (A + 1.0) * cs);
+        a2 = (A + 1.0) - (A - 1.0) * cs - beta;
+        break;
+      case BIQUAD_NOTCH:
+        b0 = 1.0;
+        b1 = -2.0 * cs;
+        b2 = 1.0;
+        a0 = 1.0 + alpha;
+        a1 = -2.0 * cs;
+        a2 = 1.0 - alpha;
+        break;
+      case BIQUAD_LOWPASS:
+        b0 = (1.0 - cs) / 2.0;
+        b1 = 1.0 - cs;
+        b2 = (1.0 - cs) / 2.0;
+        a0 = 1.0 + alpha;
+        a1 = -2.0 * cs;
+        a2 = 1.0 - alpha;
+        break;
+      case BIQUAD_HIGHPASS:
+      default:
+        b0 = (1.0 + cs) / 2.0;
+        b1 = -(1.0 + cs);
+        b2 = (1.0 + cs) / 2.0;
+        a0 = 1.0 + alpha;
+        a1 = -2.0 * cs;
+        a2 = 1.0 - alpha;
+        break;
+    }
+    
+    BiquadCoefficients c;
+    c.b0 = quantize(b0 / a0);
+    c.b1 = quantize(b1 / a0);
+    c.b2 = quantize(b2 / a0);
+    c.a1 = quantize(a1 / a0);
+    c.a2 = quantize(a2 / a0);
+    return c;
+  }
+  
+  static int32_t quantize(double value) {
+    double scaled = floor(value * (1 << EQ_COEF_BITS) + 0.5);
+    if (scaled > 2147483647.0) return INT32_MAX;
+    if (scaled < -2147483647.0) return -INT32_MAX;
+    return (int32_t)scaled;
+  }
+};
+
+struct BiquadSection {
+  BiquadCoefficients coef;      // In use
+  BiquadCoefficients target;
+  BiquadCoefficients step;      // Per segment while ramping
+  uint16_t remain;              // Segments left on the ramp
+  int64_t s1[2], s2[2];         // DF2T state per channel, Q28
+  int64_t error[2];             // Rounding residue of the last output
+  
+  BiquadSection() : remain(0) {
+    coef = target = BiquadCoefficients::identity();
+    reset();
+  }
+  
+  bool active() const { return remain || coef != BiquadCoefficients::identity(); }
+  
+  void reset() {
+    for (int c = 0; c < 2; c++) s1[c] = s2[c] = error[c] = 0;
+  }
+  
+  // A republished set that did not change leaves a running ramp alone
+  void setTarget(const BiquadCoefficients& c, uint16_t segments) {
+    if (c == target) return;
+    if (!active()) reset();     // Stale memory from before it was skipped
+    target = c;
+    if (segments <= 1) {
+      settle();
+      return;
+    }
+    remain = segments;
+    step.b0 = (int32_t)(((int64_t)c.b0 - coef.b0) / segments);
+    step.b1 = (int32_t)(((int64_t)c.b1 - coef.b1) / segments);
+    step.b2 = (int32_t)(((int64_t)c.b2 - coef.b2) / segments);
+    step.a1 = (int32_t)(((int64_t)c.a1 - coef.a1) / segments);
+    step.a2 = (int32_t)(((int64_t)c.a2 - coef.a2) / segments);
+  }
+  
+  void settle() {
+    coef = target;
+    remain = 0;
+  }
+  
+  // One segment along the ramp; the last lands exactly on the target
+  void advance() {
+    if (--remain == 0) {
+      coef = target;
+      return;
+    }
+    coef.b0 += step.b0;
+    coef.b1 += step.b1;
+    coef.b2 += step.b2;
+    coef.a1 += step.a1;
+    coef.a2 += step.a2;
+  }
+  
+  static inline int32_t tick(int32_t x, int32_t b0, int32_t b1, int32_t b2,
+                             int32_t a1, int32_t a2,
+                             int64_t& z1, int64_t& z2, int64_t& e) {
+    int64_t acc = (int64_t)b0 * x + z1 + e;
+    int64_t y = (acc + (1LL << (EQ_COEF_BITS - 1))) >> EQ_COEF_BITS;
+    if (y > INT32_MAX) {
+      y = INT32_MAX;
+      e = 0;
+    } else if (y < INT32_MIN) {
+      y = INT32_MIN;
+      e = 0;
+    } else {
+      e = acc - y * (1LL << EQ_COEF_BITS);
+    }
+    z1 = (int64_t)b1 * x - (int64_t)a1 * y + z2;
+    z2 = (int64_t)b2 * x - (int64_t)a2 * y;
+    return (int32_t)y;
+  }
+  
+  // Interleaved stereo, in place. Coefficients and state are kept in locals:
+  // buf could alias the members as far as the compiler knows.
+  void process(int32_t* buf, uint32_t frames) {
+    const int32_t b0 = coef.b0, b1 = coef.b1, b2 = coef.b2;
+    const int32_t a1 = coef.a1, a2 = coef.a2;
+    int64_t z1L = s1[0], z2L = s2[0], eL = error[0];
+    int64_t z1R = s1[1], z2R = s2[1], eR = error[1];
+    
+    for (uint32_t i = 0; i < frames; i++) {
+      buf[i * 2] = tick(buf[i * 2], b0, b1, b2, a1, a2, z1L, z2L, eL);
+      buf[i * 2 + 1] = tick(buf[i * 2 + 1], b0, b1, b2, a1, a2, z1R, z2R, eR);
+    }
+    
+    s1[0] = z1L; s2[0] = z2L; error[0] = eL;
+    s1[1] = z1R; s2[1] = z2R; error[1] = eR;
+  }
+};
+
+struct BiquadCascade {
+  BiquadSection sections[EQ_MAX_BANDS];
+  uint16_t rampSegments;
+  
+  BiquadCascade() : rampSegments(1) {}
+  
+  void setRamp(uint32_t frames) {
+    uint32_t segments = frames / PARAM_SMOOTH_FRAMES;
+    rampSegments = segments > 1 ? segments : 1;
+  }
+  
+  void setTargets(const BiquadCoefficients* c) {
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) sections[b].setTarget(c[b], rampSegments);
+  }
+  
+  // Every section straight to its target, memory cleared
+  void settle() {
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      sections[b].settle();
+      sections[b].reset();
+    }
+  }
+  
+  bool active() const {
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      if (sections[b].active()) return true;
+    }
+    return false;
+  }
+  
+  // Interleaved stereo bus, in place. One section at a time over the block.
+  void process(int32_t* buf, uint32_t frames) {
+    if (!active()) return;
+    uint32_t samples = frames * 2;
+    
+    const int32_t limit = INT32_MAX >> EQ_GUARD_BITS;
+    for (uint32_t i = 0; i < samples; i++) {
+      int32_t x = buf[i];
+      if (x > limit) x = limit;
+      if (x < -limit) x = -limit;
+      buf[i] = x * (1 << EQ_GUARD_BITS);
+    }
+    
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      BiquadSection& section = sections[b];
+      if (!section.active()) continue;
+      if (!section.remain) {
+        section.process(buf, frames);
+        continue;
+      }
+      
+      // Ramp: the next coefficient set every PARAM_SMOOTH_FRAMES
+      for (uint32_t i = 0; i < frames; i += PARAM_SMOOTH_FRAMES) {
+        uint32_t run = frames - i;
+        if (run > PARAM_SMOOTH_FRAMES) run = PARAM_SMOOTH_FRAMES;
+        if (section.remain) section.advance();
+        section.process(buf + i * 2, run);
+      }
+    }
+    
+    const int64_t half = 1 << (EQ_GUARD_BITS - 1);
+    for (uint32_t i = 0; i < samples; i++) {
+      buf[i] = (int32_t)(((int64_t)buf[i] + half) >> EQ_GUARD_BITS);
+    }
+  }
+};
+
+// ============================================================================
+// STATE-VARIABLE FILTER (TPT, fixed point)
+// ============================================================================
+// Zero-delay-feedback state-variable filter in the topology-preserving
+// transform form (trapezoidal integrators): stable and on pitch up to
+// SVF_MAX_RATIO of the sample rate, where the Chamberlin form detunes and
+// blows up. The cutoff is a pitch, log2(cutoff / rate) in 1/4096 octave,
+// so sweeps and envelope offsets are plain adds and g = tan(pi * fc / fs)
+// is one table read.
+//
+// Coefficients are Q30 (one 64-bit divide per set); the two integrator
+// states are int32 at the input shifted up by the guard bits, and the
+// products are 32x32->64 rounded once. With 6 guard bits on a 16-bit
+// input the error stays within about a third of an LSB of a double
+// reference; the input is clamped to SVF_INPUT_LIMIT after the shift so
+// the states fit 32 bits at the highest resonance (gain 1 / SVF_MIN_DAMPING).
+extern int32_t svfTanTable[SVF_TAN_TABLE_SIZE];
+
+struct SvfCoefficients {
+  int32_t a1, a2, a3;           // Q30
+  int32_t k;                    // Q30 damping (1 / Q)
+  
+  // Control side: cutoff in Hz -> pitch, resonance 0-0.99 -> damping (the
+  // mapping the Chamberlin filter used: k = 1 - resonance)
+  static int32_t pitch(float cutoffHz, float sampleRate) {
+    float ratio = cutoffHz / sampleRate;
+    if (ratio > SVF_MAX_RATIO) ratio = SVF_MAX_RATIO;
+    float p = log2f(ratio) * (float)(1 << SVF_PITCH_BITS);
+    if (p < (float)SVF_PITCH_MIN) p = (float)SVF_PITCH_MIN;
+    if (p > (float)SVF_PITCH_MAX) p = (float)SVF_PITCH_MAX;
+    return (int32_t)lrintf(p);
+  }
+  
+  static int32_t damping(float resonance) {
+    float k = 1.0f - resonance;
+    if (k < SVF_MIN_DAMPING) k = SVF_MIN_DAMPING;
+    return (int32_t)(k * (float)(1L << 30));
+  }
+  
+  // Audio side: g from the table (linear between steps), then
+  // a1 = 1 / (1 + g (g + k)), a2 = g a1, a3 = g a2
+  static SvfCoefficients fromPitch(int32_t pitch, int32_t k) {
+    if (pitch < SVF_PITCH_MIN) pitch = SVF_PITCH_MIN;
+    if (pitch > SVF_PITCH_MAX) pitch = SVF_PITCH_MAX;
+    
+    const int fracBits = SVF_PITCH_BITS - SVF_TAN_STEP_BITS;
+    uint32_t offset = (uint32_t)(pitch - SVF_PITCH_MIN);
+    uint32_t index = offset >> fracBits;
+    int32_t frac = offset & ((1 << fracBits) - 1);
+    int32_t g0 = svfTanTable[index];
+    int32_t g = g0 + (int32_t)(((int64_t)(svfTanTable[index + 1] - g0) * frac) >> fracBits);
+    
+    // g is Q24 (<= tan(0.45 pi) = 6.3), D = 1 + g (g + k) in Q30
+    int64_t d = (1LL << 30) + (((int64_t)g * g) >> 18) + (((int64_t)g * k) >> 24);
+    SvfCoefficients c;
+    c.k = k;
+    c.a1 = (int32_t)((1LL << 60) / d);
+    c.a2 = (int32_t)(((int64_t)c.a1 * g) >> 24);
+    c.a3 = (int32_t)(((int64_t)c.a2 * g) >> 24);
+    return c;
+  }
+};
+
+// One channel (or one voice): the two integrator states
+struct StateVariableFilter {
+  int32_t ic1;
+  int32_t ic2;
+  
+  StateVariableFilter() : ic1(0), ic2(0) {}
+  
+  void reset() { ic1 = ic2 = 0; }
+  
+  // Filters frames samples, stride apart, in place. guard is the extra
+  // resolution (bits) carried inside; the output is not clamped.
+  void process(FilterType type, const SvfCoefficients& c, int32_t* buf,
+               uint32_t frames, uint32_t stride, int guard) {
+    switch (type) {
+      case FILTER_LOWPASS:  run<FILTER_LOWPASS>(c, buf, frames, stride, guard); break;
+      case FILTER_HIGHPASS: run<FILTER_HIGHPASS>(c, buf, frames, stride, guard); break;
+      case FILTER_BANDPASS: run<FILTER_BANDPASS>(c, buf, frames, stride, guard); break;
+    }
+  }
+  
+  template <FilterType Type>
+  void run(const SvfCoefficients& c, int32_t* buf, uint32_t frames,
+           uint32_t stride, int guard) {
+    const int64_t half = 1LL << 29;
+    const int32_t outHalf = (1 << guard) >> 1;
+    int32_t s1 = ic1;
+    int32_t s2 = ic2;
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t x = buf[i * stride];
+      if (x > (SVF_INPUT_LIMIT >> guard)) x = SVF_INPUT_LIMIT >> guard;
+      if (x < -(SVF_INPUT_LIMIT >> guard)) x = -(SVF_INPUT_LIMIT >> guard);
+      x *= (1 << guard);
+      
+      int32_t v3 = x - s2;
+      int32_t v1 = (int32_t)(((int64_t)c.a1 * s1 + (int64_t)c.a2 * v3 + half) >> 30);
+      int32_t v2 = s2 + (int32_t)(((int64_t)c.a2 * s1 + (int64_t)c.a3 * v3 + half) >> 30);
+      s1 = 2 * v1 - s1;
+      s2 = 2 * v2 - s2;
+      
+      int32_t y;
+      if (Type == FILTER_LOWPASS) {
+        y = v2;
+      } else if (Type == FILTER_BANDPASS) {
+        y = v1;
+      } else {
+        y = x - v2 - (int32_t)(((int64_t)c.k * v1 + half) >> 30);
+      }
+      buf[i * stride] = (y + outHalf) >> guard;
+    }
+    ic1 = s1;
+    ic2 = s2;
+  }
+};
+
+// One block of filter control (audio side): pitch and damping move in a
+// straight line from the start values to the end values over the block,
+// recomputed every SVF_CONTROL_FRAMES. Per voice, each adds envDepth times
+// its envelope * velocity to the pitch.
+struct SvfControl {
+  FilterType type;
+  int32_t pitch, pitchEnd;        // SVF_PITCH_BITS
+  int32_t damping, dampingEnd;    // Q30
+  int32_t envDepth;               // Pitch units at full envelope
+  
+  bool isMoving() const { return pitch != pitchEnd || damping != dampingEnd; }
+  
+  // Values at frame i of frames (pitch span * frames fits 32 bits)
+  int32_t pitchAt(uint32_t i, uint32_t frames) const {
+    if (pitch == pitchEnd) return pitch;
+    return pitch + (pitchEnd - pitch) * (int32_t)i / (int32_t)frames;
+  }
+  int32_t dampingAt(uint32_t i, uint32_t frames) const {
+    if (damping == dampingEnd) return damping;
+    return damping + (int32_t)((int64_t)(dampingEnd - damping) * i / frames);
+  }
+};
+
+// ============================================================================
+// FDN REVERB (fixed point)
+// ============================================================================
+// The channel sum runs through four series allpass diffusers into four
+// feedback delay lines, remixed every pass by a 4x4 Hadamard matrix (with
+// the 1/2 that makes it orthogonal, so the loop loses only what the line
+// gains take). Each line's gain follows from the decay time and its own
+// length, so all four die away together; a one-pole lowpass in each loop
+// is the damping. Left is lines 1 + 3, right 2 - 4 (L/R correlation 0.03
+// on noise).
+//
+// Lines and diffusers are int16 rings of exact length, scaled to the sample
+// rate, in one allocation. process() works in runs of up to
+// REVERB_CHUNK_FRAMES: the four diffusers one at a time over the run, then
+// the lines. Every loop stops at its rings' next wrap, so no sample tests
+// for one.
+struct ReverbParams {
+  int32_t lineGain[4];      // Q15 lowpass input: gain per pass * (1 - pole) / 2
+  int32_t damping;          // Q15 lowpass pole
+};
+
+struct FdnReverb {
+  struct Ring {
+    int16_t* buffer;
+    uint32_t length;
+    uint32_t pos;
+  };
+  
+  static const int32_t DIFFUSION = (int32_t)(REVERB_DIFFUSION * 32768.0f);
+  
+  Ring line[4];
+  Ring diffuser[4];
+  int32_t lowpass[4];       // Damped, scaled line outputs (see process())
+  ReverbParams params;
+  int16_t* reverbBuffer;
+  uint32_t bufferSamples;
+  bool initialized;
+  
+  FdnReverb() : reverbBuffer(nullptr), bufferSamples(0), initialized(false) {
+    params = design(DEFAULT_REVERB_ROOM_SIZE, DEFAULT_REVERB_DAMPING, (float)REVERB_REF_RATE);
+    for (int i = 0; i < 4; i++) {
+      line[i].buffer = diffuser[i].buffer = nullptr;
+      line[i].length = diffuser[i].length = 0;
+      line[i].pos = diffuser[i].pos = 0;
+      lowpass[i] = 0;
+    }
+  }
+  
+  static uint32_t lineLength(int i, uint32_t sampleRate) {
+    static const uint32_t ref[4] = {
+      REVERB_LINE1_DELAY, REVERB_LINE2_DELAY, REVERB_LINE3_DELAY, REVERB_LINE4_DELAY
+    };
+    return scaledLength(ref[i], sampleRate);
+  }
+  
+  static uint32_t diffuserLength(int i, uint32_t sampleRate) {
+    static const uint32_t ref[4] = {
+      REVERB_DIFFUSER1_DELAY, REVERB_DIFFUSER2_DELAY, REVERB_DIFFUSER3_DELAY, REVERB_DIFFUSER4_DELAY
+    };
+    return scaledLength(ref[i], sampleRate);
+  }
+  
+  static uint32_t scaledLength(uint32_t refLength, uint32_t sampleRate) {
+    uint32_t length = (uint32_t)(((uint64_t)refLength * sampleRate + REVERB_REF_RATE / 2) / REVERB_REF_RATE);
+    return length ? length : 1;
+  }
+  
+  bool init(uint32_t sampleRate) {
+    uint32_t samples = 0;
+    for (int i = 0; i < 4; i++) {
+      samples += lineLength(i, sampleRate) + diffuserLength(i, sampleRate);
+    }
+    
+    reverbBuffer = (int16_t*)malloc(samples * sizeof(int16_t));
+    if (!reverbBuffer) return false;
+    bufferSamples = samples;
+    
+    int16_t* next = reverbBuffer;
+    for (int i = 0; i < 4; i++) {
+      line[i].buffer = next;
+      line[i].length = lineLength(i, sampleRate);
+      next += line[i].length;
+      diffuser[i].buffer = next;
+      diffuser[i].length = diffuserLength(i, sampleRate);
+      next += diffuser[i].length;
+    }
+    
+    reset();
+    initialized = true;
+    return true;
+  }
+  
+  void deinit() {
+    if (reverbBuffer) {
+      free(reverbBuffer);
+      reverbBuffer = nullptr;
+    }
+    bufferSamples = 0;
+    initialized = false;
+  }
+  
+  // Room size sets the decay time (REVERB_RT60_MIN to _MAX, exponential);
+  // each line loses 60 dB over that time whatever its length
+  static ReverbParams design(float roomSize, float damping, float sampleRate) {
+    ReverbParams p;
+    float rt60 = REVERB_RT60_MIN * powf(REVERB_RT60_MAX / REVERB_RT60_MIN, roomSize);
+    float pole = damping * REVERB_DAMPING_MAX;
+    for (int i = 0; i < 4; i++) {
+      float passes = rt60 * sampleRate / (float)lineLength(i, (uint32_t)sampleRate);
+      float gain = powf(10.0f, -3.0f / passes);
+      p.lineGain[i] = (int32_t)(gain * (1.0f - pole) * 0.5f * 32767.0f);
+    }
+    p.damping = (int32_t)(pole * 32767.0f);
+    return p;
+  }
+  
+  void setParams(const ReverbParams& p) { params = p; }
+  
+  void reset() {
+    if (reverbBuffer) {
+      memset(reverbBuffer, 0, bufferSamples * sizeof(int16_t));
+    }
+    for (int i = 0; i < 4; i++) {
+      line[i].pos = diffuser[i].pos = 0;
+      lowpass[i] = 0;
+    }
+  }
+  
+  static inline int16_t saturate(int32_t sample) {
+    if (sample > 32767) sample = 32767;
+    if (sample < -32768) sample = -32768;
+    return (int16_t)sample;
+  }
+  
+  // product >> bits, rounded towards zero: a floor would bias every pass
+  // the same way and the loops would hold it as a small cycle forever
+  static inline int32_t towardZero(int32_t product, int bits) {
+    return (product + ((product >> 31) & ((1 << bits) - 1))) >> bits;
+  }
+  
+  // One allpass over n samples, in place, in runs up to its ring's wrap.
+  // Only the product that goes back into the ring needs towardZero().
+  static void diffuse(Ring& ring, int32_t* x, uint32_t n) {
+    while (n > 0) {
+      uint32_t run = ring.length - ring.pos;
+      if (run > n) run = n;
+      
+      int16_t* a = ring.buffer + ring.pos;
+      for (uint32_t i = 0; i < run; i++) {
+        int32_t y = a[i] - ((x[i] * DIFFUSION) >> 15);
+        a[i] = saturate(x[i] + towardZero(y * DIFFUSION, 15));
+        x[i] = y;
+      }
+      
+      ring.pos += run;
+      if (ring.pos == ring.length) ring.pos = 0;
+      x += run;
+      n -= run;
+    }
+  }
+  
+  // Mixes the reverb into buf (interleaved L/R). wet and wetEnd are Q12; the
+  // wet level ramps linearly from one to the other across the block.
+  void process(int32_t* buf, uint32_t frames, int32_t wet, int32_t wetEnd) {
+    int32_t wetAcc = wet << 12;
+    int32_t wetStep = (wetEnd - wet) * (1 << 12) / (int32_t)(frames ? frames : 1);
+    int32_t g0 = params.lineGain[0], g1 = params.lineGain[1];
+    int32_t g2 = params.lineGain[2], g3 = params.lineGain[3];
+    int32_t damp = params.damping;
+    int32_t f0 = lowpass[0], f1 = lowpass[1], f2 = lowpass[2], f3 = lowpass[3];
+    int32_t input[REVERB_CHUNK_FRAMES];
+    
+    while (frames > 0) {
+      // Up to the first line that wraps
+      uint32_t run = frames < REVERB_CHUNK_FRAMES ? frames : REVERB_CHUNK_FRAMES;
+      for (int i = 0; i < 4; i++) {
+        if (line[i].length - line[i].pos < run) run = line[i].length - line[i].pos;
+      }
+      
+      // Diffusion, one allpass at a time over the run
+      for (uint32_t i = 0; i < run; i++) {
+        input[i] = saturate((buf[i * 2] + buf[i * 2 + 1]) >> REVERB_INPUT_SHIFT);
+      }
+      for (int k = 0; k < 4; k++) diffuse(diffuser[k], input, run);
+      
+      int16_t* d0 = line[0].buffer + line[0].pos;
+      int16_t* d1 = line[1].buffer + line[1].pos;
+      int16_t* d2 = line[2].buffer + line[2].pos;
+      int16_t* d3 = line[3].buffer + line[3].pos;
+      
+      for (uint32_t i = 0; i < run; i++) {
+        int32_t x = input[i];
+        
+        // Line outputs through the damping lowpass, which also carries the
+        // line gain and the 1/2 that makes the Hadamard orthogonal
+        int32_t y0 = d0[i], y1 = d1[i], y2 = d2[i], y3 = d3[i];
+        f0 = towardZero(y0 * g0 + f0 * damp, 15);
+        f1 = towardZero(y1 * g1 + f1 * damp, 15);
+        f2 = towardZero(y2 * g2 + f2 * damp, 15);
+        f3 = towardZero(y3 * g3 + f3 * damp, 15);
+        
+        // Hadamard as butterflies, plus the input
+        int32_t s01 = f0 + f1, m01 = f0 - f1;
+        int32_t s23 = f2 + f3, m23 = f2 - f3;
+        d0[i] = saturate(s01 + s23 + x);
+        d1[i] = saturate(m01 + m23 + x);
+        d2[i] = saturate(s01 - s23 + x);
+        d3[i] = saturate(m01 - m23 + x);
+        
+        // The lines run 6 dB down for headroom; the taps make it back. The
+        // bus is not clamped, so the dry product needs 64 bits.
+        int32_t w = wetAcc >> 12;
+        int32_t dry = 4096 - w;
+        buf[i * 2] = (int32_t)(((int64_t)buf[i * 2] * dry + (y0 + y2) * 2 * w) >> 12);
+        buf[i * 2 + 1] = (int32_t)(((int64_t)buf[i * 2 + 1] * dry + (y1 - y3) * 2 * w) >> 12);
+        wetAcc += wetStep;
+      }
+      
+      for (int i = 0; i < 4; i++) {
+        line[i].pos += run;
+        if (line[i].pos == line[i].length) line[i].pos = 0;
+      }
+      buf += run * 2;
+      frames -= run;
+    }
+    
+    lowpass[0] = f0; lowpass[1] = f1; lowpass[2] = f2; lowpass[3] = f3;
+  }
+};
+
+// ============================================================================
+// DELAY LINE (power-of-two ring, fractional read)
+// ============================================================================
+// The write index runs free and is masked on access, so wrapping is one AND.
+// Reads take the delay in 1/2^DELAY_FRAC_BITS samples and interpolate
+// linearly, so the delay time can glide or be modulated without clicks.
+struct DelayLine {
+  int16_t* buffer;
+  uint32_t mask;            // Capacity - 1
+  uint32_t writePos;        // Free-running
+  
+  DelayLine() : buffer(nullptr), mask(0), writePos(0) {}
+  
+  // Capacity is minSamples rounded up to a power of two
+  bool init(uint32_t minSamples) {
+    uint32_t capacity = 1;
+    while (capacity < minSamples) capacity <<= 1;
+    
+    buffer = (int16_t*)malloc(capacity * sizeof(int16_t));
+    if (!buffer) return false;
+    
+    mask = capacity - 1;
+    reset();
+    return true;
+  }
+  
+  void deinit() {
+    if (buffer) {
+      free(buffer);
+      buffer = nullptr;
+    }
+    mask = 0;
+  }
+  
+  void reset() {
+    if (buffer) {
+      memset(buffer, 0, (mask + 1) * sizeof(int16_t));
+    }
+    writePos = 0;
+  }
+  
+  uint32_t capacity() const { return buffer ? mask + 1 : 0; }
+  
+  // Longest delay read() can interpolate, in whole samples
+  uint32_t maxDelay() const { return mask - 1; }
+  
+  // The input from delay samples ago, 1 <= delay <= maxDelay(). Call before
+  // this sample's write().
+  inline int32_t read(uint32_t delay) const {
+    uint32_t pos = writePos - (delay >> DELAY_FRAC_BITS);
+    int32_t frac = delay & ((1 << DELAY_FRAC_BITS) - 1);
+    int32_t s0 = buffer[pos & mask];
+    int32_t s1 = buffer[(pos - 1) & mask];
+    return s0 + (((s1 - s0) * frac) >> DELAY_FRAC_BITS);
+  }
+  
+  // Saturates to 16 bits
+  inline void write(int32_t sample) {
+    if (sample > 32767) sample = 32767;
+    if (sample < -32768) sample = -32768;
+    buffer[writePos & mask] = (int16_t)sample;
+    writePos++;
+  }
+};
+
+// ============================================================================
+// MODULATED DELAY (shared core of the chorus and flanger)
+// ============================================================================
+// A DelayLine read by up to MOD_DELAY_MAX_TAPS taps, swept around a center
+// delay by one triangle LFO with the taps spread evenly over its cycle. The
+// sweep is linear, so read positions planned once per block and ramped across
+// it follow the LFO exactly except at its turning points. The effect's own
+// sample loop does the reads and writes; see processChorusBlock().
+struct ModulatedDelay {
+  DelayLine line;
+  uint32_t phase;           // LFO, one cycle = 2^32
+  uint32_t phaseInc;        // Per sample
+  int32_t center;           // DELAY_FRAC_BITS samples
+  int32_t depth;            // Either side of center, same units
+  uint8_t taps;
+  uint32_t tapPhase[MOD_DELAY_MAX_TAPS];    // LFO offset per tap
+  uint32_t tapRead[MOD_DELAY_MAX_TAPS];     // Read position at the block start
+  int32_t tapStep[MOD_DELAY_MAX_TAPS];      // Per sample, set by plan()
+  
+  ModulatedDelay() : phase(0), phaseInc(0), center(1 << DELAY_FRAC_BITS), depth(0), taps(0) {
+    for (int t = 0; t < MOD_DELAY_MAX_TAPS; t++) {
+      tapPhase[t] = tapRead[t] = 0;
+      tapStep[t] = 0;
+    }
+  }
+  
+  bool init(uint32_t minSamples) { return line.init(minSamples); }
+  void deinit() { line.deinit(); }
+  
+  // Delays in samples. The depth is limited to keep the sweep at least one
+  // sample long; a tap added here starts where the sweep has it.
+  void configure(float delaySamples, float depthSamples, float rateHz,
+                 float sampleRate, uint8_t tapCount) {
+    if (depthSamples > delaySamples - 1.0f) depthSamples = delaySamples - 1.0f;
+    if (depthSamples < 0.0f) depthSamples = 0.0f;
+    center = (int32_t)(delaySamples * (1 << DELAY_FRAC_BITS));
+    depth = (int32_t)(depthSamples * (1 << DELAY_FRAC_BITS));
+    phaseInc = (uint32_t)(rateHz / sampleRate * 4294967296.0f);
+    
+    uint8_t previous = taps;
+    taps = tapCount;
+    for (uint8_t t = 0; t < taps; t++) {
+      tapPhase[t] = (uint32_t)(((uint64_t)t << 32) / taps);
+      if (t >= previous) tapRead[t] = target(t);
+    }
+  }
+  
+  // Clears the line; startPhase offsets the LFO (the other side of a pair)
+  void reset(uint32_t startPhase = 0) {
+    line.reset();
+    phase = startPhase;
+    for (uint8_t t = 0; t < taps; t++) {
+      tapRead[t] = target(t);
+      tapStep[t] = 0;
+    }
+  }
+  
+  // -32768..32767, as LFO::getTriangle()
+  static inline int32_t triangle(uint32_t p) {
+    uint32_t folded = p ^ (0 - (p >> 31));
+    return (int32_t)((folded << 1) >> 16) - 32768;
+  }
+  
+  uint32_t target(uint8_t t) const {
+    return (uint32_t)(center + (int32_t)(((int64_t)depth * triangle(phase + tapPhase[t])) >> 15));
+  }
+  
+  // Once per block, before the sample loop: advances the LFO and sets each
+  // tap's step towards its new position. Steps are held to half a sample per
+  // sample, so a jump in the delay setting glides instead of reading backwards.
+  void plan(uint32_t frames) {
+    const int32_t slew = 1 << (DELAY_FRAC_BITS - 1);
+    phase += phaseInc * frames;
+    for (uint8_t t = 0; t < taps; t++) {
+      int32_t step = ((int32_t)target(t) - (int32_t)tapRead[t]) / (int32_t)frames;
+      if (step > slew) step = slew;
+      if (step < -slew) step = -slew;
+      tapStep[t] = step;
+    }
+  }
+};
+
+// ============================================================================
+// PEAK LIMITER (integer, lookahead)
+// ============================================================================
+// The output runs LIMITER_LOOKAHEAD_FRAMES late. Gain is planned once per
+// LIMITER_SEGMENT_FRAMES segment from the peaks of that segment and the next,
+// so it has already ramped down when a peak leaves the delay line: no sample
+// exceeds the ceiling. It recovers towards unity exponentially at the release
+// rate. One divide per segment; per sample, a 32x32 multiply per channel.
+struct PeakLimiter {
+  static const int32_t UNITY = 1 << 16;
+  
+  int32_t delayLine[LIMITER_LOOKAHEAD_FRAMES * 2];   // Interleaved L/R
+  uint32_t pos;             // Frame index into delayLine
+  int32_t ceiling;          // Sample units
+  uint32_t releaseCoef;     // Q16 share of the gap to unity recovered per segment
+  int32_t gain;             // Q16, applied to the next sample out
+  int32_t step;             // Q16 per frame
+  int32_t segmentEnd;       // Q16 gain planned for the end of this segment
+  int32_t heldTarget;       // Q16 gain limit of the segment being output
+  uint32_t peak;            // Of the segment being written
+  int32_t lowest;           // Lowest planned gain since takeLowest()
+  
+  PeakLimiter() : ceiling(32767), releaseCoef(UNITY - 1) { reset(); }
+  
+  static int32_t ceilingLevel(float ceilingDb) {
+    return (int32_t)(32767.0f * powf(10.0f, ceilingDb / 20.0f));
+  }
+  
+  static uint32_t releaseCoefficient(float releaseMs, uint32_t sampleRate) {
+    float segments = releaseMs * sampleRate / (1000.0f * LIMITER_SEGMENT_FRAMES);
+    float coef = 1.0f - expf(-1.0f / (segments > 1.0f ? segments : 1.0f));
+    return (uint32_t)(coef * (UNITY - 1));
+  }
+  
+  void setCeiling(int32_t level) { ceiling = level; }
+  void setRelease(uint32_t coef) { releaseCoef = coef; }
+  
+  void reset() {
+    memset(delayLine, 0, sizeof(delayLine));
+    pos = 0;
+    gain = segmentEnd = heldTarget = lowest = UNITY;
+    step = 0;
+    peak = 0;
+  }
+  
+  int32_t takeLowest() {
+    int32_t result = lowest;
+    lowest = segmentEnd;
+    return result;
+  }
+  
+  // Called as a segment finishes entering the delay line; the oldest one,
+  // about to be output, was measured at the previous boundary
+  void planSegment(uint32_t segmentPeak) {
+    int32_t target = UNITY;
+    if (segmentPeak > (uint32_t)ceiling) {
+      target = (int32_t)(((uint32_t)ceiling << 16) / segmentPeak);
+    }
+    
+    gain = segmentEnd;
+    int32_t end = gain + (int32_t)(((uint32_t)(UNITY - gain) * releaseCoef) >> 16);
+    if (end > heldTarget) end = heldTarget;
+    if (end > target) end = target;
+    
+    // Rounds down: the ramp never rises above either end
+    step = (end - gain) >> LIMITER_SEGMENT_SHIFT;
+    segmentEnd = end;
+    heldTarget = target;
+    if (end < lowest) lowest = end;
+  }
+  
+  // Interleaved stereo, in place. State is kept in locals: buf could alias
+  // the members as far as the compiler knows.
+  void process(int32_t* buf, uint32_t frames) {
+    uint32_t p = pos;
+    int32_t g = gain;
+    uint32_t segmentPeak = peak;
+    
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t* slot = &delayLine[p * 2];
+      int32_t left = buf[i * 2];
+      int32_t right = buf[i * 2 + 1];
+      
+      uint32_t magnitude = (uint32_t)(left < 0 ? -left : left);
+      if (magnitude > segmentPeak) segmentPeak = magnitude;
+      magnitude = (uint32_t)(right < 0 ? -right : right);
+      if (magnitude > segmentPeak) segmentPeak = magnitude;
+      
+      buf[i * 2] = (int32_t)(((int64_t)slot[0] * g) >> 16);
+      buf[i * 2 + 1] = (int32_t)(((int64_t)slot[1] * g) >> 16);
+      slot[0] = left;
+      slot[1] = right;
+      g += step;
+      
+      if ((++p & (LIMITER_SEGMENT_FRAMES - 1)) == 0) {
+        if (p == LIMITER_LOOKAHEAD_FRAMES) p = 0;
+        planSegment(segmentPeak);
+        segmentPeak = 0;
+        g = gain;
+      }
+    }
+    
+    pos = p;
+    gain = g;
+    peak = segmentPeak;
+  }
+};
+
+// ============================================================================
+// COMPRESSOR (feed-forward, log-domain detector)
+// ============================================================================
+// Levels are log2 of the sample magnitude in Q10 (about 0.006 dB a step);
+// full scale is 15 octaves. Once per COMP_SEGMENT_FRAMES the segment peak
+// goes through a log table, the detector follows it with the attack or
+// release coefficient, and the gain computer (threshold, ratio, makeup) is a
+// subtract and a multiply in the same domain. An exp table takes the gain
+// back to linear and it ramps across the next segment. Per sample: a peak
+// compare and a 32x32->64 multiply per channel, whatever the settings.
+struct CompressorParams {
+  int32_t threshold;        // Level
+  int32_t slope;            // Q16, 1 - 1/ratio
+  int32_t makeup;           // Level difference
+  uint32_t attackCoef;      // Q16 share of the gap to the peak followed per segment
+  uint32_t releaseCoef;
+};
+
+struct Compressor {
+  static const int32_t UNITY = 1 << 16;
+  static const int32_t FULL_SCALE = 15 << COMP_LEVEL_BITS;
+  
+  int32_t log2Table[COMP_TABLE_SIZE + 1];   // log2(1 + i/size), Q10
+  int32_t exp2Table[COMP_TABLE_SIZE + 1];   // 2^(i/size), Q16
+  CompressorParams params;
+  int32_t envelope;         // Detector level
+  int32_t gain;             // Q16, applied to the next sample
+  int32_t step;             // Q16 per frame
+  int32_t segmentEnd;       // Q16 gain planned for the end of this segment
+  uint32_t count;           // Frames into the segment
+  uint32_t peak;            // Of the segment so far
+  int32_t reduction;        // Level, planned for this segment
+  int32_t deepest;          // Largest reduction since takeReduction()
+  
+  Compressor() {
+    for (int i = 0; i <= COMP_TABLE_SIZE; i++) {
+      float x = (float)i / COMP_TABLE_SIZE;
+      log2Table[i] = (int32_t)(log2f(1.0f + x) * (1 << COMP_LEVEL_BITS) + 0.5f);
+      exp2Table[i] = (int32_t)(exp2f(x) * UNITY + 0.5f);
+    }
+    params = design(0.0f, 1.0f, 10.0f, 100.0f, 0.0f, 22050.0f);
+    reset();
+  }
+  
+  // Control side: settings in the detector's integer units
+  static CompressorParams design(float thresholdDb, float ratio, float attackMs,
+                                 float releaseMs, float makeupDb, float sampleRate) {
+    const float perDb = (1 << COMP_LEVEL_BITS) / 6.0206f;
+    CompressorParams p;
+    p.threshold = FULL_SCALE + (int32_t)(thresholdDb * perDb);
+    p.slope = (int32_t)((1.0f - 1.0f / ratio) * UNITY);
+    p.makeup = (int32_t)(makeupDb * perDb);
+    p.attackCoef = segmentCoefficient(attackMs, sampleRate);
+    p.releaseCoef = segmentCoefficient(releaseMs, sampleRate);
+    return p;
+  }
+  
+  static uint32_t segmentCoefficient(float ms, float sampleRate) {
+    float segments = ms * sampleRate / (1000.0f * COMP_SEGMENT_FRAMES);
+    float coef = 1.0f - expf(-1.0f / (segments > 1.0f ? segments : 1.0f));
+    return (uint32_t)(coef * (UNITY - 1));
+  }
+  
+  static float toDb(int32_t level) {
+    return level * (6.0206f / (1 << COMP_LEVEL_BITS));
+  }
+  
+  // Takes effect from the next segment; the gain ramps there as usual
+  void setParams(const CompressorParams& p) { params = p; }
+  
+  void reset() {
+    envelope = 0;
+    gain = segmentEnd = linear(params.makeup);
+    step = 0;
+    count = 0;
+    peak = 0;
+    reduction = deepest = 0;
+  }
+  
+  int32_t takeReduction() {
+    int32_t result = deepest;
+    deepest = reduction;
+    return result;
+  }
+  
+  // log2(magnitude) in Q10, 0 for silence
+  int32_t level(uint32_t magnitude) const {
+    if (magnitude == 0) return 0;
+    int msb = 31 - __builtin_clz(magnitude);
+    uint32_t norm = (msb >= 14) ? magnitude >> (msb - 14) : magnitude << (14 - msb);
+    uint32_t index = (norm >> (14 - COMP_TABLE_BITS)) & (COMP_TABLE_SIZE - 1);
+    int32_t frac = norm & ((1 << (14 - COMP_TABLE_BITS)) - 1);
+    int32_t a = log2Table[index];
+    int32_t b = log2Table[index + 1];
+    return (msb << COMP_LEVEL_BITS) + a + (((b - a) * frac) >> (14 - COMP_TABLE_BITS));
+  }
+  
+  // 2^level as a Q16 gain
+  int32_t linear(int32_t level) const {
+    const int subBits = COMP_LEVEL_BITS - COMP_TABLE_BITS;
+    int32_t whole = level >> COMP_LEVEL_BITS;
+    int32_t frac = level & ((1 << COMP_LEVEL_BITS) - 1);
+    int32_t index = frac >> subBits;
+    int32_t a = exp2Table[index];
+    int32_t b = exp2Table[index + 1];
+    int32_t g = a + (((b - a) * (frac & ((1 << subBits) - 1))) >> subBits);
+    if (whole >= 0) return g << whole;
+    return (whole > -31) ? g >> -whole : 0;
+  }
+  
+  // Detector and gain computer for the segment that just ended; its gain
+  // applies to the next one (feed-forward, one segment behind)
+  void planSegment(uint32_t segmentPeak) {
+    int32_t input = level(segmentPeak);
+    uint32_t coef = (input > envelope) ? params.attackCoef : params.releaseCoef;
+    envelope += (int32_t)(((int64_t)(input - envelope) * coef) >> 16);
+    
+    int32_t over = envelope - params.threshold;
+    reduction = (over > 0) ? (int32_t)(((int64_t)over * params.slope) >> 16) : 0;
+    if (reduction > deepest) deepest = reduction;
+    
+    gain = segmentEnd;
+    segmentEnd = linear(params.makeup - reduction);
+    step = (segmentEnd - gain) >> COMP_SEGMENT_SHIFT;
+  }
+  
+  // Interleaved stereo, in place, linked (one gain for both sides). State is
+  // kept in locals: buf could alias the members as far as the compiler knows.
+  void process(int32_t* buf, uint32_t frames) {
+    int32_t g = gain;
+    uint32_t n = count;
+    uint32_t segmentPeak = peak;
+    
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t left = buf[i * 2];
+      int32_t right = buf[i * 2 + 1];
+      
+      uint32_t magnitude = (uint32_t)(left < 0 ? -left : left);
+      if (magnitude > segmentPeak) segmentPeak = magnitude;
+      magnitude = (uint32_t)(right < 0 ? -right : right);
+      if (magnitude > segmentPeak) segmentPeak = magnitude;
+      
+      buf[i * 2] = (int32_t)(((int64_t)left * g) >> 16);
+      buf[i * 2 + 1] = (int32_t)(((int64_t)right * g) >> 16);
+      g += step;
+      
+      if (++n == COMP_SEGMENT_FRAMES) {
+        n = 0;
+        planSegment(segmentPeak);
+        segmentPeak = 0;
+        g = gain;
+      }
+    }
+    
+    gain = g;
+    count = n;
+    peak = segmentPeak;
+  }
+};
+
+// ============================================================================
+// PARAMETER SMOOTHER (linear ramp, advanced once per block)
+// ============================================================================
+// A new target restarts a ramp of length samples from the current value.
+// Once it lands exactly on the target, advance() is a single compare.
+struct SmoothedParam {
+  float current;
+  float target;
+  uint32_t remain;          // Samples left in the ramp, 0 = settled
+  uint32_t length;
+  
+  SmoothedParam() : current(0.0f), target(0.0f), remain(0), length(0) {}
+  
+  void setLength(uint32_t samples) { length = samples; }
+  
+  // Jump, no ramp
+  void reset(float value) {
+    current = target = value;
+    remain = 0;
+  }
+  
+  void setTarget(float value) {
+    if (value == target) return;
+    target = value;
+    remain = length;
+    if (!remain) current = value;
+  }
+  
+  bool isMoving() const { return remain != 0; }
+  
+  // Value after frames more samples
+  float advance(uint32_t frames) {
+    if (!remain) return current;
+    if (frames >= remain) {
+      current = target;
+      remain = 0;
+    } else {
+      current += (target - current) * (float)frames / (float)remain;
+      remain -= frames;
+    }
+    return current;
+  }
+};
+
+// ============================================================================
+// EFFECT COEFFICIENT SET (one snapshot, see SnapshotBuffer)
+// ============================================================================
+// Targets: the audio side ramps eq (BiquadCascade) and svfPitch/svfDamping
+// (SmoothedParam)
+struct EffectCoefficients {
+  BiquadCoefficients eq[EQ_MAX_BANDS];
+  int32_t svfPitch;           // SVF_PITCH_BITS
+  int32_t svfDamping;         // Q30
+  ReverbParams reverb;
+  CompressorParams compressor;
+  
+  EffectCoefficients() {
+    svfPitch = SvfCoefficients::pitch(DEFAULT_FILTER_CUTOFF, 22050.0f);
+    svfDamping = SvfCoefficients::damping(DEFAULT_FILTER_RESONANCE);
+    reverb = FdnReverb::design(0.5f, 0.5f, 22050.0f);
+    compressor = Compressor::design(0.0f, 1.0f, 10.0f, 100.0f, 0.0f, 22050.0f);
+    for (int b = 0; b < EQ_MAX_BANDS; b++) eq[b] = BiquadCoefficients::identity();
+  }
+};
+
+#endif // AUDIO_EFFECTS_H
@@ -11,6 +11,9 @@
   int16_t sineTable[WAVETABLE_SIZE];
 #endif
 
+// g = tan(pi * cutoff / rate) per SVF pitch step, Q24 (see SvfCoefficients)
+int32_t svfTanTable[SVF_TAN_TABLE_SIZE];
+
 // ============================================================================
 // WAVETABLE INITIALIZATION
 // ============================================================================
@@ -23,133 +26,13 @@ void AudioEngine::initWavetable() {
     }
     Serial.println(F("[AUDIO] ✓ Wavetable ready"));
   #endif
-}
-
-// ============================================================================
-// VOICE IMPLEMENTATION (WITH LFO SUPPORT!)
-// ============================================================================
-
-void Voice::noteOn(uint8_t n, uint8_t v, uint32_t sampleRate) {
-  note = n;
-  vel = v;
-  phase = 0;
-  
-  float freq = 440.0f * powf(2.0f, (n - 69) / 12.0f);
-  
-  #if USE_FIXED_POINT_MATH
-    float phaseIncFloat = freq / (float)sampleRate;
-    phaseInc = FLOAT_TO_FIXED(phaseIncFloat);
-  #else
-    phaseInc = freq / (float)sampleRate;
-  #endif
-  
-  on = true;
-  env.on();
-}
-
-void Voice::noteOff() {
-  env.off();
-}
-
-int16_t Voice::getSample(float lfoVibrato, float lfoTremolo) {
-  if (!on) return 0;
-  
-  uint8_t envValue = env.get();
-  if (!env.isActive()) {
-    on = false;
-    return 0;
-  }
-  
-  int16_t sample = 0;
-  
-  // Apply LFO Vibrato (pitch modulation)
-  #if USE_FIXED_POINT_MATH
-    fixed_point_t modulatedPhaseInc = phaseInc;
-    if (lfoVibrato != 0.0f) {
-      float phaseIncFloat = FIXED_TO_FLOAT(phaseInc);
-      phaseIncFloat *= (1.0f + lfoVibrato);
-      modulatedPhaseInc = FLOAT_TO_FIXED(phaseIncFloat);
-    }
-    float phaseFloat = FIXED_TO_FLOAT(phase);
-  #else
-    float modulatedPhaseInc = phaseInc;
-    if (lfoVibrato != 0.0f) {
-      modulatedPhaseInc = phaseInc * (1.0f + lfoVibrato);
-    }
-    float phaseFloat = phase;
-  #endif
-  
-  switch(waveform) {
-    case WAVE_SINE:
-      #if USE_WAVETABLE_LOOKUP && USE_FIXED_POINT_MATH
-        {
-          uint32_t index = (phase >> FIXED_SHIFT) & (WAVETABLE_SIZE - 1);
-          uint32_t nextIndex = (index + 1) & (WAVETABLE_SIZE - 1);
-          uint32_t frac = (phase >> 8) & 0xFF;
-          
-          int16_t s0 = sineTable[index];
-          int16_t s1 = sineTable[nextIndex];
-          
-          int32_t interpolated = s0 + (((s1 - s0) * frac) >> 8);
-          sample = (int16_t)interpolated;
-        }
-      #elif USE_WAVETABLE_LOOKUP
-        {
-          uint32_t index = (uint32_t)(phaseFloat * WAVETABLE_SIZE) & (WAVETABLE_SIZE - 1);
-          sample = sineTable[index];
-        }
-      #else
-        sample = (int16_t)(sin(phaseFloat * 2.0f * PI) * 32767.0f);
-      #endif
-      break;
-      
-    case WAVE_SQUARE:
-      sample = (phaseFloat < 0.5f) ? 32767 : -32767;
-      break;
-      
-    case WAVE_SAWTOOTH:
-      sample = (int16_t)((phaseFloat * 2.0f - 1.0f) * 32767.0f);
-      break;
-      
-    case WAVE_TRIANGLE:
-      if (phaseFloat < 0.5f) {
-        sample = (int16_t)((phaseFloat * 4.0f - 1.0f) * 32767.0f);
-      } else {
-        sample = (int16_t)((3.0f - phaseFloat * 4.0f) * 32767.0f);
-      }
-      break;
-      
-    case WAVE_NOISE:
-      {
-        static uint32_t lfsr = 0xACE1u;
-        uint32_t bit = ((lfsr >> 0) ^ (lfsr >> 2) ^ (lfsr >> 22) ^ (lfsr >> 31)) & 1;
-        lfsr = (lfsr >> 1) | (bit << 31);
-        sample = (int16_t)((lfsr & 0xFFFF) - 32768);
-      }
-      break;
-  }
-  
-  // Advance phase with vibrato modulation
-  #if USE_FIXED_POINT_MATH
-    phase += modulatedPhaseInc;
-    if (phase >= FLOAT_TO_FIXED(1.0f)) {
-      phase -= FLOAT_TO_FIXED(1.0f);
-    }
-  #else
-    phase += modulatedPhaseInc;
-    if (phase >= 1.0f) phase -= 1.0f;
-  #endif
-  
-  // Apply envelope
-  int32_t result = (int32_t)sample * envValue / 255;
-  result = result * vel / 127;
   
-  // Apply LFO Tremolo (amplitude modulation)
-  if (lfoTremolo != 1.0f) {
-    result = (int32_t)(result * lfoTremolo);
+  // Past SVF_MAX_RATIO the entries hold at its value
+  for (int i = 0; i < SVF_TAN_TABLE_SIZE; i++) {
+    double ratio = pow(2.0, SVF_TAN_MIN_OCTAVE + (double)i / (1 << SVF_TAN_STEP_BITS));
+    if (ratio > SVF_MAX_RATIO) ratio = SVF_MAX_RATIO;
+    svfTanTable[i] = (int32_t)lround(tan(PI * ratio) * (1 << 24));
   }
-  
-  return (int16_t)constrain(result, -32768, 32767);
 }
 
 // ============================================================================
@@ -226,27 +109,33 @@ void MelodyPlayer::update() {
 // ============================================================================
 
 AudioEngine::AudioEngine() 
-  : settings(nullptr), voiceCount(0), audioTaskHandle(nullptr), 
-    initialized(false), pwmActive(false), lastCPUCheck(0), 
-    audioTaskCount(0), cpuUsage(0.0f),
-    delayBuffer(nullptr), delayBufferSize(0), delayWritePos(0) {
-  #if !USE_LEGACY_I2S
-    tx_handle = nullptr;
-  #endif
+  : settings(nullptr), voiceCount(0),
+    sampleClock(0),
+    mixBuffer(nullptr), fxBuffer(nullptr),
+    lfoVibratoBuffer(nullptr), lfoTremoloBuffer(nullptr), lfoTremoloGain(32768), blockSize(0),
+    pwmBlockPos(0), pwmBlockActive(false), pwmGain(0),
+    delayTime(0.0f), delayTarget(0.0f), delayModDepth(0.0f), delayGlideRate(1.0f),
+    delayRead(0), tapLastMs(0), tapCount(0),
+    convolver(nullptr), convolverLoaded(nullptr), convolverPending(nullptr),
+    convolverRetired(nullptr), convolverCycles(0), loadWindowConvolverCycles(0),
+    compressorReduction(0),
+    limiterGain(PeakLimiter::UNITY), limiterLowest(PeakLimiter::UNITY),
+    initialized(false), outputAttached(false), pwmActive(false),
+    loadWindowCycles(0), loadWindowFrames(0) {
 }
 
 AudioEngine::~AudioEngine() {
   deinit();
 }
 
-bool AudioEngine::init(AudioSettings* cfg) {
+bool AudioEngine::init(AudioSettings* cfg, bool attachOutput) {
   if (initialized) {
     Serial.println(F("[AUDIO] Already initialized"));
     return false;
   }
   
   settings = cfg;
-  voiceCount = settings->voices;
+  voiceCount = constrain(settings->voices, 1, MAX_VOICES);
   
   Serial.println(F("[AUDIO] Initializing..."));
   
@@ -254,9 +143,24 @@ bool AudioEngine::init(AudioSettings* cfg) {
     initWavetable();
   #endif
   
-  for (int i = 0; i < voiceCount; i++) {
-    voices[i] = Voice();
-    voices[i].waveform = settings->waveform;
+  commands.clear();
+  coefficients.clear();
+  commandStats.reset();
+  sampleClock.store(0, std::memory_order_relaxed);
+  
+  voiceBank.reset(voiceCount, settings->waveform);
+  // Fixed bus gain: N uncorrelated voices sum to sqrt(N) times one voice.
+  // Peaks above that are the limiter's job, not a per-sample divide's.
+  voiceBank.setBusGain((int32_t)(32768.0f / sqrtf((float)voiceCount)));
+  voiceBank.setSampleRate(settings->sampleRate);
+  setEnvelope(settings->envelope);
+  setOscillatorMode(settings->oscillator);
+  setVoiceStealPolicy(settings->voiceSteal);
+  
+  // Block render scratch buffers
+  if (!allocateRenderBuffers()) {
+    Serial.println(F("[ERROR] Render buffer allocation failed"));
+    return false;
   }
   
   // Conditional delay buffer allocation
@@ -269,34 +173,81 @@ bool AudioEngine::init(AudioSettings* cfg) {
     Serial.println(F("[AUDIO] ✓ Delay buffer not allocated (disabled)"));
   }
   
-  // Initialize Biquad EQ filters
-  updateEQFilters();
-  Serial.println(F("[AUDIO] ✓ Biquad EQ filters initialized"));
+  if (settings->chorus.enabled && !allocateChorusBuffer()) {
+    Serial.println(F("[WARN] Chorus buffer allocation failed - chorus disabled"));
+    settings->chorus.enabled = false;
+  }
+  
+  if (settings->flanger.enabled && !allocateFlangerBuffers()) {
+    Serial.println(F("[WARN] Flanger buffer allocation failed - flanger disabled"));
+    settings->flanger.enabled = false;
+  }
+  
+  if (settings->reverb.enabled && !reverb.init(settings->sampleRate)) {
+    Serial.println(F("[ERROR] Reverb buffer allocation failed - reverb disabled"));
+    settings->reverb.enabled = false;
+  }
+  
+  // From here on the render path only reads its own copy; setters reach it
+  // through the command queue
+  dsp = *settings;
+  drainCommands();
+  
+  // First coefficient set, applied directly (no audio task yet)
+  publishCoefficients();
+  applyCoefficients(*coefficients.acquire());
+  resetSmoothing();
+  
+  // Biquad EQ: sections were settled with the first coefficient set
+  Serial.printf("[AUDIO] ✓ Biquad EQ cascade: %d sections (Q%d)\n", EQ_MAX_BANDS, EQ_COEF_BITS);
   
   // Initialize State-Variable Filter
-  updateFilterCoefficients();
-  Serial.println(F("[AUDIO] ✓ State-Variable Filter initialized"));
-  
-  // Initialize Schroeder Reverb
-  if (settings->reverb.enabled) {
-    if (reverb.init()) {
-      updateReverbParameters();
-      Serial.println(F("[AUDIO] ✓ Schroeder Reverb initialized"));
-    } else {
-      Serial.println(F("[ERROR] Reverb buffer allocation failed - reverb disabled"));
-      settings->reverb.enabled = false;
-    }
+  svf[0].reset();
+  svf[1].reset();
+  voiceBank.resetFilters();
+  Serial.printf("[AUDIO] ✓ TPT state-variable filter (%s)\n",
+                dsp.filter.perVoice ? "per voice" : "bus");
+  
+  // Initialize FDN reverb
+  if (dsp.reverb.enabled) {
+    Serial.printf("[AUDIO] ✓ FDN reverb: %u samples (%.1f KB)\n",
+                  reverb.bufferSamples, reverb.bufferSamples * sizeof(int16_t) / 1024.0f);
   } else {
     Serial.println(F("[AUDIO] ✓ Reverb not allocated (disabled)"));
   }
   
+  // Echo time, glide and wow from the loaded settings
+  configureDelay(true);
+  configureChorus(true);
+  configureFlanger(true);
+  
+  // Compressor (parameters came with the first coefficient set)
+  compressor.reset();
+  compressorReduction.store(0, std::memory_order_relaxed);
+  Serial.printf("[AUDIO] ✓ Compressor %s (%.1f dB, %.1f:1)\n",
+                dsp.compressor.enabled ? "enabled" : "disabled",
+                dsp.compressor.thresholdDb, dsp.compressor.ratio);
+  
+  // Output limiter
+  configureLimiter();
+  limiter.reset();
+  resetLimiterMeter();
+  Serial.printf("[AUDIO] ✓ Limiter %s (ceiling %.1f dB, release %u ms)\n",
+                dsp.limiter.enabled ? "enabled" : "disabled",
+                dsp.limiter.ceilingDb, dsp.limiter.releaseMs);
+  
   // Initialize LFO (NEW!)
   updateLFORate();
   Serial.println(F("[AUDIO] ✓ LFO initialized"));
   
   melodyPlayer.setAudioEngine(this);
+  resetDSPLoad();
+  resetXrunStats();
   
-  if (settings->mode == MODE_I2S) {
+  outputAttached = attachOutput;
+  if (!attachOutput) {
+    Serial.println(F("[AUDIO] ✓ Offline mode (no output attached)"));
+  } else if (settings->mode == MODE_I2S) {
     initI2S();
   } else {
     initPWM();
@@ -307,15 +258,13 @@ bool AudioEngine::init(AudioSettings* cfg) {
   Serial.printf("[AUDIO] ✓ Mode: %s, Sample Rate: %u Hz, Voices: %u\n",
                 settings->getModeName(), settings->sampleRate, voiceCount);
   
-  #if USE_FIXED_POINT_MATH
-    Serial.println(F("[AUDIO] ✓ Fixed-point math enabled"));
-  #endif
+  Serial.println(F("[AUDIO] ✓ Fixed-point voice bank enabled"));
   #if USE_WAVETABLE_LOOKUP
     Serial.println(F("[AUDIO] ✓ Wavetable lookup enabled"));
   #endif
   
-  Serial.printf("[AUDIO] ✓ Waveform: %s\n", getWaveformName());
-  Serial.printf("[AUDIO] ✓ Free RAM: %d KB\n", ESP.getFreeHeap() / 1024);
+  Serial.printf("[AUDIO] ✓ Waveform: %s (%s)\n", getWaveformName(), settings->getOscillatorName());
+  Serial.printf("[AUDIO] ✓ Free RAM: %d KB\n", platformFreeHeap() / 1024);
   
   #if HAS_DUAL_CORE
     if (settings->multiCore.useDualCore) {
@@ -332,14 +281,20 @@ void AudioEngine::deinit() {
   
   Serial.println(F("[AUDIO] Shutting down..."));
   
-  if (settings->mode == MODE_I2S) {
-    deinitI2S();
-  } else {
-    deinitPWM();
+  if (outputAttached) {
+    if (settings->mode == MODE_I2S) {
+      deinitI2S();
+    } else {
+      deinitPWM();
+    }
+    outputAttached = false;
   }
   
   freeDelayBuffer();
+  freeModulationBuffers();
+  freeRenderBuffers();
   reverb.deinit();
+  freeConvolvers();
   
   initialized = false;
   Serial.println(F("[AUDIO] ✓ Shutdown complete"));
@@ -349,157 +304,156 @@ void AudioEngine::deinit() {
 // CONDITIONAL DELAY BUFFER ALLOCATION
 // ============================================================================
 
+// Room for the longest time plus the modulation swing and the interpolation
+// tap, rounded up to a power of two by DelayLine
 bool AudioEngine::allocateDelayBuffer() {
-  delayBufferSize = (settings->sampleRate * MAX_DELAY_TIME) / 1000;
-  delayBuffer = (int16_t*)malloc(delayBufferSize * sizeof(int16_t));
-  
-  if (!delayBuffer) {
-    delayBufferSize = 0;
-    return false;
-  }
+  uint32_t samples = (settings->sampleRate * (MAX_DELAY_TIME + DELAY_MOD_DEPTH_MAX)) / 1000 + 2;
+  if (!delayLine.init(samples)) return false;
   
-  memset(delayBuffer, 0, delayBufferSize * sizeof(int16_t));
-  delayWritePos = 0;
   Serial.printf("[AUDIO] ✓ Delay buffer: %u samples (%.1f KB)\n", 
-                delayBufferSize, (delayBufferSize * sizeof(int16_t)) / 1024.0f);
+                delayLine.capacity(), (delayLine.capacity() * sizeof(int16_t)) / 1024.0f);
   return true;
 }
 
 void AudioEngine::freeDelayBuffer() {
-  if (delayBuffer) {
-    free(delayBuffer);
-    delayBuffer = nullptr;
-    delayBufferSize = 0;
+  if (delayLine.buffer) {
+    delayLine.deinit();
     Serial.println(F("[AUDIO] ✓ Delay buffer freed"));
   }
 }
 
+// Chorus and flanger lines: the longest sweep plus the interpolation tap.
+// A few KB, allocated on first use and kept until deinit.
+bool AudioEngine::allocateChorusBuffer() {
+  float ms = CHORUS_DELAY_MAX_MS + CHORUS_DEPTH_MAX_MS;
+  if (!chorus.init((uint32_t)(settings->sampleRate * ms / 1000.0f) + 2)) return false;
+  
+  Serial.printf("[AUDIO] ✓ Chorus buffer: %u samples (%.1f KB)\n",
+                chorus.line.capacity(), (chorus.line.capacity() * sizeof(int16_t)) / 1024.0f);
+  return true;
+}
+
+bool AudioEngine::allocateFlangerBuffers() {
+  float ms = FLANGER_DELAY_MAX_MS + FLANGER_DEPTH_MAX_MS;
+  uint32_t samples = (uint32_t)(settings->sampleRate * ms / 1000.0f) + 2;
+  if (!flanger[0].init(samples)) return false;
+  if (!flanger[1].init(samples)) {
+    flanger[0].deinit();
+    return false;
+  }
+  
+  Serial.printf("[AUDIO] ✓ Flanger buffers: 2 x %u samples (%.1f KB)\n",
+                flanger[0].line.capacity(), (2 * flanger[0].line.capacity() * sizeof(int16_t)) / 1024.0f);
+  return true;
+}
+
+void AudioEngine::freeModulationBuffers() {
+  chorus.deinit();
+  flanger[0].deinit();
+  flanger[1].deinit();
+}
+
 // ============================================================================
-// BIQUAD EQ FILTER CALCULATION
+// BLOCK RENDER BUFFER ALLOCATION
 // ============================================================================
 
-void AudioEngine::updateEQFilters() {
-  float fs = (float)settings->sampleRate;
+bool AudioEngine::allocateRenderBuffers() {
+  blockSize = settings->performance.i2sBufferSize;
+  if (blockSize == 0) blockSize = DEFAULT_I2S_BUFFER;
   
-  // Calculate Bass filter
-  if (settings->eq.bass != 0) {
-    float freq = (float)settings->eq.bassFreq;
-    float Q = settings->eq.q;
-    float gain = (float)settings->eq.bass;
-    float A = powf(10.0f, gain / 40.0f);
-    float omega = 2.0f * PI * freq / fs;
-    float sn = sinf(omega);
-    float cs = cosf(omega);
-    float alpha = sn / (2.0f * Q);
-    
-    float b0 = 1.0f + alpha * A;
-    float b1 = -2.0f * cs;
-    float b2 = 1.0f - alpha * A;
-    float a0 = 1.0f + alpha / A;
-    float a1 = -2.0f * cs;
-    float a2 = 1.0f - alpha / A;
-    
-    eqBass.b0 = b0 / a0;
-    eqBass.b1 = b1 / a0;
-    eqBass.b2 = b2 / a0;
-    eqBass.a1 = a1 / a0;
-    eqBass.a2 = a2 / a0;
-  } else {
-    eqBass.b0 = 1.0f;
-    eqBass.b1 = 0.0f;
-    eqBass.b2 = 0.0f;
-    eqBass.a1 = 0.0f;
-    eqBass.a2 = 0.0f;
-  }
-  
-  // Calculate Mid filter
-  if (settings->eq.mid != 0) {
-    float freq = (float)settings->eq.midFreq;
-    float Q = settings->eq.q;
-    float gain = (float)settings->eq.mid;
-    float A = powf(10.0f, gain / 40.0f);
-    float omega = 2.0f * PI * freq / fs;
-    float sn = sinf(omega);
-    float cs = cosf(omega);
-    float alpha = sn / (2.0f * Q);
-    
-    float b0 = 1.0f + alpha * A;
-    float b1 = -2.0f * cs;
-    float b2 = 1.0f - alpha * A;
-    float a0 = 1.0f + alpha / A;
-    float a1 = -2.0f * cs;
-    float a2 = 1.0f - alpha / A;
-    
-    eqMid.b0 = b0 / a0;
-    eqMid.b1 = b1 / a0;
-    eqMid.b2 = b2 / a0;
-    eqMid.a1 = a1 / a0;
-    eqMid.a2 = a2 / a0;
-  } else {
-    eqMid.b0 = 1.0f;
-    eqMid.b1 = 0.0f;
-    eqMid.b2 = 0.0f;
-    eqMid.a1 = 0.0f;
-    eqMid.a2 = 0.0f;
-  }
-  
-  // Calculate Treble filter
-  if (settings->eq.treble != 0) {
-    float freq = (float)settings->eq.trebleFreq;
-    float Q = settings->eq.q;
-    float gain = (float)settings->eq.treble;
-    float A = powf(10.0f, gain / 40.0f);
-    float omega = 2.0f * PI * freq / fs;
-    float sn = sinf(omega);
-    float cs = cosf(omega);
-    float alpha = sn / (2.0f * Q);
-    
-    float b0 = 1.0f + alpha * A;
-    float b1 = -2.0f * cs;
-    float b2 = 1.0f - alpha * A;
-    float a0 = 1.0f + alpha / A;
-    float a1 = -2.0f * cs;
-    float a2 = 1.0f - alpha / A;
-    
-    eqTreble.b0 = b0 / a0;
-    eqTreble.b1 = b1 / a0;
-    eqTreble.b2 = b2 / a0;
-    eqTreble.a1 = a1 / a0;
-    eqTreble.a2 = a2 / a0;
-  } else {
-    eqTreble.b0 = 1.0f;
-    eqTreble.b1 = 0.0f;
-    eqTreble.b2 = 0.0f;
-    eqTreble.a1 = 0.0f;
-    eqTreble.a2 = 0.0f;
+  // Interleaved L/R, the I2S frame layout
+  mixBuffer = (int32_t*)malloc(blockSize * 2 * sizeof(int32_t));
+  fxBuffer = (float*)malloc(blockSize * 2 * sizeof(float));
+  uint32_t lfoSegments = (blockSize + LFO_CONTROL_FRAMES - 1) / LFO_CONTROL_FRAMES;
+  lfoVibratoBuffer = (int32_t*)malloc(lfoSegments * sizeof(int32_t));
+  lfoTremoloBuffer = (int32_t*)malloc(blockSize * sizeof(int32_t));
+  
+  if (!mixBuffer || !fxBuffer || !lfoVibratoBuffer || !lfoTremoloBuffer ||
+      !voiceBank.allocate(blockSize)) {
+    freeRenderBuffers();
+    return false;
   }
   
-  eqBass.reset();
-  eqMid.reset();
-  eqTreble.reset();
+  pwmBlockPos = blockSize;
+  pwmBlockActive = false;
+  return true;
+}
+
+void AudioEngine::freeRenderBuffers() {
+  free(mixBuffer);
+  free(fxBuffer);
+  free(lfoVibratoBuffer);
+  free(lfoTremoloBuffer);
+  mixBuffer = nullptr;
+  fxBuffer = nullptr;
+  lfoVibratoBuffer = nullptr;
+  lfoTremoloBuffer = nullptr;
+  voiceBank.deallocate();
+  blockSize = 0;
 }
 
 // ============================================================================
-// STATE-VARIABLE FILTER CALCULATION
+// EFFECT COEFFICIENTS (computed on the control side, swapped in per block)
 // ============================================================================
 
-void AudioEngine::updateFilterCoefficients() {
-  svf.updateCoefficients(
-    settings->filter.cutoff,
-    settings->filter.resonance,
-    (float)settings->sampleRate
-  );
-  svf.reset();
+// Control side: recomputes the whole set from settings into the copy the
+// audio task is not reading, then hands it over with one pointer exchange
+void AudioEngine::publishCoefficients() {
+  const AudioSettings& s = *settings;
+  float fs = (float)s.sampleRate;
+  EffectCoefficients& c = coefficients.edit();
+  
+  for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+    const EQBand& band = s.eq.bands[b];
+    c.eq[b] = BiquadCoefficients::design(band.type, band.freq, band.gain, band.q, fs);
+  }
+  
+  c.svfPitch = SvfCoefficients::pitch(s.filter.cutoff, fs);
+  c.svfDamping = SvfCoefficients::damping(s.filter.resonance);
+  
+  c.reverb = FdnReverb::design(s.reverb.roomSize, s.reverb.damping, fs);
+  
+  c.compressor = Compressor::design(s.compressor.thresholdDb, s.compressor.ratio,
+                                    s.compressor.attackMs, s.compressor.releaseMs,
+                                    s.compressor.makeupDb, fs);
+  
+  coefficients.publish();
+}
+
+// Audio side, at the start of a block: new targets, same filter memory
+void AudioEngine::applyCoefficients(const EffectCoefficients& c) {
+  eqCascade.setTargets(c.eq);
+  
+  filterPitch.setTarget((float)c.svfPitch);
+  filterDamping.setTarget((float)c.svfDamping);
+  
+  reverb.setParams(c.reverb);
+  
+  compressor.setParams(c.compressor);
 }
 
 // ============================================================================
-// SCHROEDER REVERB PARAMETER UPDATE
+// PARAMETER SMOOTHING (audio side)
 // ============================================================================
 
-void AudioEngine::updateReverbParameters() {
-  if (reverb.initialized) {
-    reverb.updateParameters(settings->reverb.roomSize, settings->reverb.damping);
-  }
+// Jumps every ramp to its target (init, nothing playing)
+void AudioEngine::resetSmoothing() {
+  uint32_t length = (dsp.sampleRate * PARAM_SMOOTH_MS) / 1000;
+  
+  volumeLevel.setLength(length);
+  volumeLevel.reset(dsp.volume);
+  reverbWet.setLength(length);
+  reverbWet.reset(dsp.reverb.wet);
+  
+  filterPitch.setLength(length);
+  filterPitch.reset(filterPitch.target);
+  filterDamping.setLength(length);
+  filterDamping.reset(filterDamping.target);
+  svfCoef = SvfCoefficients::fromPitch((int32_t)filterPitch.current,
+                                       (int32_t)filterDamping.current);
+  
+  eqCascade.setRamp(length);
+  eqCascade.settle();
 }
 
 // ============================================================================
@@ -507,7 +461,7 @@ void AudioEngine::updateReverbParameters() {
 // ============================================================================
 
 void AudioEngine::updateLFORate() {
-  lfo.setRate(settings->lfo.rate, (float)settings->sampleRate);
+  lfo.setRate(dsp.lfo.rate, (float)dsp.sampleRate);
 }
 // ============================================================================
 // I2S INITIALIZATION
@@ -516,100 +470,20 @@ void AudioEngine::updateLFORate() {
 void AudioEngine::initI2S() {
   Serial.println(F("[I2S] Initializing..."));
   
-  #if USE_LEGACY_I2S
-    i2s_config_t i2s_config = {
-      .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX),
-      .sample_rate = settings->sampleRate,
-      .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
-      .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
-      .communication_format = I2S_COMM_FORMAT_STAND_I2S,
-      .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-      .dma_buf_count = settings->performance.i2sNumBuffers,
-      .dma_buf_len = settings->performance.i2sBufferSize,
-      .use_apll = false,
-      .tx_desc_auto_clear = true,
-      .fixed_mclk = 0
-    };
-    
-    i2s_pin_config_t pin_config = {
-      .bck_io_num = I2S_PIN_NO_CHANGE,
-      .ws_io_num = I2S_PIN_NO_CHANGE,
-      .data_out_num = settings->i2s.pin,
-      .data_in_num = I2S_PIN_NO_CHANGE
-    };
-    
-    esp_err_t err = i2s_driver_install(I2S_NUM_0, &i2s_config, 0, NULL);
-    if (err != ESP_OK) {
-      Serial.printf("[ERROR] I2S driver install failed: %d\n", err);
-      return;
-    }
-    
-    err = i2s_set_pin(I2S_NUM_0, &pin_config);
-    if (err != ESP_OK) {
-      Serial.printf("[ERROR] I2S set pin failed: %d\n", err);
-      i2s_driver_uninstall(I2S_NUM_0);
-      return;
-    }
-    
-  #else
-    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
-    chan_cfg.dma_desc_num = settings->performance.i2sNumBuffers;
-    chan_cfg.dma_frame_num = settings->performance.i2sBufferSize;
-    chan_cfg.auto_clear = true;
-    
-    esp_err_t err = i2s_new_channel(&chan_cfg, &tx_handle, NULL);
-    if (err != ESP_OK) {
-      Serial.printf("[ERROR] I2S new channel failed: %d\n", err);
-      return;
-    }
-    
-    i2s_std_config_t std_cfg = {
-      .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(settings->sampleRate),
-      .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
-      .gpio_cfg = {
-        .mclk = I2S_GPIO_UNUSED,
-        .bclk = I2S_GPIO_UNUSED,
-        .ws = I2S_GPIO_UNUSED,
-        .dout = (gpio_num_t)settings->i2s.pin,
-        .din = I2S_GPIO_UNUSED,
-        .invert_flags = {
-          .mclk_inv = false,
-          .bclk_inv = false,
-          .ws_inv = false
-        }
-      }
-    };
-    
-    err = i2s_channel_init_std_mode(tx_handle, &std_cfg);
-    if (err != ESP_OK) {
-      Serial.printf("[ERROR] I2S init std mode failed: %d\n", err);
-      i2s_del_channel(tx_handle);
-      tx_handle = nullptr;
-      return;
-    }
-    
-    err = i2s_channel_enable(tx_handle);
-    if (err != ESP_OK) {
-      Serial.printf("[ERROR] I2S enable failed: %d\n", err);
-      i2s_del_channel(tx_handle);
-      tx_handle = nullptr;
-      return;
-    }
-  #endif
+  if (!platformI2SBegin(settings->sampleRate, settings->i2s.pin,
+                        settings->performance.i2sNumBuffers,
+                        settings->performance.i2sBufferSize)) {
+    return;
+  }
+  
+  if (!platformHasAudioTask()) {
+    Serial.println(F("[I2S] ✓ No audio task on this platform - pull blocks with renderBlock()"));
+    return;
+  }
   
   uint8_t audioCore = settings->multiCore.useDualCore ? settings->multiCore.audioCore : 0;
   
-  BaseType_t result = xTaskCreatePinnedToCore(
-    audioTask,
-    "AudioTask",
-    8192,
-    this,
-    configMAX_PRIORITIES - 1,
-    &audioTaskHandle,
-    audioCore
-  );
-  
-  if (result != pdPASS) {
+  if (!platformStartAudioTask(audioTask, this, audioCore)) {
     Serial.println(F("[ERROR] Failed to create audio task"));
     deinitI2S();
     return;
@@ -619,361 +493,879 @@ void AudioEngine::initI2S() {
 }
 
 void AudioEngine::deinitI2S() {
-  if (audioTaskHandle) {
-    vTaskDelete(audioTaskHandle);
-    audioTaskHandle = nullptr;
-  }
-  
-  #if USE_LEGACY_I2S
-    i2s_driver_uninstall(I2S_NUM_0);
-  #else
-    if (tx_handle) {
-      i2s_channel_disable(tx_handle);
-      i2s_del_channel(tx_handle);
-      tx_handle = nullptr;
-    }
-  #endif
+  platformStopAudioTask();
+  platformI2SEnd();
 }
 
 // ============================================================================
-// I2S AUDIO TASK (WITH LFO, REVERB, SVF, EQ & DELAY)
+// BLOCK RENDER PIPELINE (SHARED BY I2S TASK AND PWM UPDATE)
 // ============================================================================
 
-void AudioEngine::audioTask(void* parameter) {
-  AudioEngine* engine = (AudioEngine*)parameter;
-  int16_t buffer[engine->settings->performance.i2sBufferSize * 2];
-  size_t bytesWritten;
+// The LFO runs at control rate: one value per LFO_CONTROL_FRAMES segment.
+// Vibrato holds each segment's pitch offset; tremolo ramps linearly between
+// segment values so the gain has no steps.
+void AudioEngine::renderLFOBlock(uint32_t frames, bool& vibrato, bool& tremolo) {
+  vibrato = false;
+  tremolo = false;
+  if (!dsp.lfo.enabled) {
+    lfoTremoloGain = 32768;
+    return;
+  }
   
-  uint32_t taskCount = 0;
-  uint32_t lastMonitor = millis();
-  uint32_t lastMelodyUpdate = millis();
+  vibrato = dsp.lfo.vibratoEnabled;
+  tremolo = dsp.lfo.tremoloEnabled;
+  if (!tremolo) lfoTremoloGain = 32768;
   
-  while (true) {
-    uint32_t now = millis();
-    if (now - lastMelodyUpdate >= 1) {
-      lastMelodyUpdate = now;
-      engine->melodyPlayer.update();
-    }
-    
-    for (uint32_t i = 0; i < engine->settings->performance.i2sBufferSize; i++) {
-      // LFO outputs (per sample)
-      float lfoVibrato = 0.0f;
-      float lfoTremolo = 1.0f;
-      if (engine->settings->lfo.enabled) {
-        float lfoValue = engine->lfo.getSine(); // -1..1
-        
-        // Vibrato: pitch modulation (scaled by depth)
-        if (engine->settings->lfo.vibratoEnabled) {
-          float depth = engine->settings->lfo.depth / 100.0f;
-          lfoVibrato = lfoValue * depth * 0.02f; // ±2% Pitch bei 100% Depth
-        }
-        
-        // Tremolo: amplitude modulation (0..1)
-        if (engine->settings->lfo.tremoloEnabled) {
-          float depth = engine->settings->lfo.depth / 100.0f;
-          // Map -1..1 to 1-depth .. 1
-          float amp = 1.0f - depth + (lfoValue + 1.0f) * 0.5f * depth;
-          lfoTremolo = amp;
-        }
-      }
-      
-      // Voice mixing
-      int32_t mixed = 0;
-      int active = 0;
-      
-      for (int v = 0; v < engine->voiceCount; v++) {
-        if (engine->voices[v].on) {
-          mixed += engine->voices[v].getSample(lfoVibrato, lfoTremolo);
-          active++;
-        }
-      }
-      
-      if (active > 1) {
-        mixed /= active;
-      }
-      
-      mixed = (mixed * engine->settings->volume) / 255;
-      
-      // State-Variable Filter
-      if (engine->settings->filter.enabled) {
-        float sample = (float)mixed;
-        float lp, bp, hp;
-        
-        engine->svf.process(sample, 0, lp, bp, hp);
-        
-        switch(engine->settings->filter.type) {
-          case FILTER_LOWPASS:  sample = lp; break;
-          case FILTER_HIGHPASS: sample = hp; break;
-          case FILTER_BANDPASS: sample = bp; break;
-        }
-        
-        mixed = (int32_t)sample;
-      }
-      
-      // Biquad EQ
-      if (engine->settings->eq.enabled) {
-        float sample = (float)mixed;
-        
-        if (engine->settings->eq.bass != 0) {
-          sample = engine->eqBass.process(sample, 0);
-        }
-        if (engine->settings->eq.mid != 0) {
-          sample = engine->eqMid.process(sample, 0);
-        }
-        if (engine->settings->eq.treble != 0) {
-          sample = engine->eqTreble.process(sample, 0);
-        }
-        
-        mixed = (int32_t)sample;
-      }
-      
-      // Reverb
-      if (engine->settings->reverb.enabled && engine->reverb.initialized) {
-        float sample = (float)mixed;
-        float wet = engine->reverb.process(sample, engine->settings->reverb.damping);
-        float dry = sample * (1.0f - engine->settings->reverb.wet);
-        float reverbOut = dry + (wet * engine->settings->reverb.wet);
-        mixed = (int32_t)reverbOut;
-      }
-      
-      // Delay
-      if (engine->settings->delay.enabled && engine->delayBuffer) {
-        uint32_t delaySamples = (engine->settings->sampleRate * engine->settings->delay.timeMs) / 1000;
-        if (delaySamples >= engine->delayBufferSize) {
-          delaySamples = engine->delayBufferSize - 1;
-        }
-        
-        uint32_t readPos = (engine->delayWritePos + engine->delayBufferSize - delaySamples) % engine->delayBufferSize;
-        int32_t delayedSample = engine->delayBuffer[readPos];
-        
-        int32_t feedbackAmount = (engine->settings->delay.feedback * delayedSample) / 100;
-        int32_t toBuffer = mixed + feedbackAmount;
-        
-        if (toBuffer > 32767) toBuffer = 32767;
-        if (toBuffer < -32768) toBuffer = -32768;
-        engine->delayBuffer[engine->delayWritePos] = (int16_t)toBuffer;
-        
-        int32_t dry = (mixed * (100 - engine->settings->delay.mix)) / 100;
-        int32_t wet = (delayedSample * engine->settings->delay.mix) / 100;
-        mixed = dry + wet;
-        
-        engine->delayWritePos = (engine->delayWritePos + 1) % engine->delayBufferSize;
-      }
-      
-      // Clipping
-      if (mixed > 32767) mixed = 32767;
-      if (mixed < -32768) mixed = -32768;
-      
-      buffer[i * 2] = (int16_t)mixed;
-      buffer[i * 2 + 1] = (int16_t)mixed;
-    }
+  // Depth 0..100% -> vibrato ±2% pitch, tremolo gain 1-depth .. 1 (Q15)
+  int32_t depth = (int32_t)(dsp.lfo.depth * 327.68f);
+  int32_t vibratoDepth = (depth * 655) >> 15;
+  int32_t tremoloBase = 32768 - depth;
+  
+  uint32_t segment = 0;
+  for (uint32_t start = 0; start < frames; start += LFO_CONTROL_FRAMES) {
+    uint32_t len = frames - start;
+    if (len > LFO_CONTROL_FRAMES) len = LFO_CONTROL_FRAMES;
     
-    #if USE_LEGACY_I2S
-      i2s_write(I2S_NUM_0, buffer, sizeof(buffer), &bytesWritten, portMAX_DELAY);
-    #else
-      i2s_channel_write(engine->tx_handle, buffer, sizeof(buffer), &bytesWritten, portMAX_DELAY);
-    #endif
+    int32_t lfoValue = lfo.getSine(len);   // Q15
+    lfoVibratoBuffer[segment++] = (lfoValue * vibratoDepth) >> 15;
     
-    taskCount++;
-    if (engine->settings->performance.enableCPUMonitor) {
-      now = millis();
-      if (now - lastMonitor >= CPU_MONITOR_INTERVAL) {
-        engine->audioTaskCount = taskCount;
-        taskCount = 0;
-        lastMonitor = now;
-        
-        uint32_t expectedTasks = (CPU_MONITOR_INTERVAL * engine->settings->sampleRate) / engine->settings->performance.i2sBufferSize;
-        engine->cpuUsage = (float)engine->audioTaskCount / expectedTasks * 100.0f;
+    if (tremolo) {
+      int32_t target = tremoloBase + (((lfoValue + 32768) * (depth >> 1)) >> 15);
+      int32_t gain = lfoTremoloGain << 8;
+      int32_t step = ((target - lfoTremoloGain) << 8) / (int32_t)len;
+      for (uint32_t i = 0; i < len; i++) {
+        gain += step;
+        lfoTremoloBuffer[start + i] = gain >> 8;
       }
+      lfoTremoloGain = target;
     }
   }
 }
 
-// ============================================================================
-// PWM INITIALIZATION
-// ============================================================================
-
-void AudioEngine::initPWM() {
-  Serial.println(F("[PWM] Initializing..."));
+bool AudioEngine::renderVoicesBlock(uint32_t frames) {
+  bool vibrato, tremolo;
+  renderLFOBlock(frames, vibrato, tremolo);
   
-  ledcAttach(settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
-  ledcWrite(settings->pwm.pin, 1 << (settings->pwm.resolution - 1));
-  pwmActive = true;
+  memset(mixBuffer, 0, frames * 2 * sizeof(int32_t));
   
-  Serial.printf("[PWM] ✓ Initialized on GPIO %u (%u Hz, %u-bit)\n",
-                settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
+  // Volume as a Q15 gain (255 = unity), so the only divide is the ramp step
+  // once per block. The ramp runs in Q23 so the step does not lose the end
+  // point. Advanced even when silent, so the ramp never resumes stale.
+  bool volumeRamp = volumeLevel.isMoving();
+  int32_t volumeAcc = (int32_t)(volumeLevel.current * (8388608.0f / 255.0f));
+  int32_t volumeStep = ((int32_t)(volumeLevel.advance(frames) * (8388608.0f / 255.0f)) -
+                        volumeAcc) / (int32_t)frames;
+  
+  // Per-voice filter: the voice bank runs this block's ramp
+  SvfControl voiceFilter;
+  bool perVoice = dsp.filter.enabled && dsp.filter.perVoice;
+  if (perVoice) voiceFilter = advanceFilter(frames);
+  
+  if (!voiceBank.render(mixBuffer, frames,
+                        vibrato ? lfoVibratoBuffer : nullptr,
+                        perVoice ? &voiceFilter : nullptr)) {
+    return false;
+  }
+  
+  // The bus is a plain sum at fixed gain: |mixed| <= sqrt(MAX_VOICES) * 46341
+  // (hard pan), which is more than 16 bits - the limiter brings it back.
+  // Against a Q15 gain the products need 64 bits.
+  uint32_t samples = frames * 2;
+  if (!volumeRamp) {
+    int32_t gain = (dsp.volume * 32768 + 127) / 255;
+    for (uint32_t i = 0; i < samples; i++) {
+      mixBuffer[i] = (int32_t)(((int64_t)mixBuffer[i] * gain) >> 15);
+    }
+  } else {
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t gain = volumeAcc >> 8;
+      mixBuffer[i * 2] = (int32_t)(((int64_t)mixBuffer[i * 2] * gain) >> 15);
+      mixBuffer[i * 2 + 1] = (int32_t)(((int64_t)mixBuffer[i * 2 + 1] * gain) >> 15);
+      volumeAcc += volumeStep;
+    }
+  }
+  
+  // Tremolo is common to all voices: apply it once to the mix. Q11 gain
+  // keeps the product in 32 bits at full bus level.
+  if (tremolo) {
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t gain = lfoTremoloBuffer[i] >> 4;
+      mixBuffer[i * 2] = (mixBuffer[i * 2] * gain) >> 11;
+      mixBuffer[i * 2 + 1] = (mixBuffer[i * 2 + 1] * gain) >> 11;
+    }
+  }
+  return true;
 }
 
-void AudioEngine::deinitPWM() {
-  if (pwmActive) {
-    ledcWrite(settings->pwm.pin, 0);
-    ledcDetach(settings->pwm.pin);
-    pinMode(settings->pwm.pin, OUTPUT);
-    digitalWrite(settings->pwm.pin, LOW);
-    pwmActive = false;
+// This block's cutoff/damping ramp (advances the smoothed params), for the
+// bus filter or the voice bank
+SvfControl AudioEngine::advanceFilter(uint32_t frames) {
+  SvfControl ctl;
+  ctl.type = dsp.filter.type;
+  ctl.pitch = (int32_t)filterPitch.current;
+  ctl.pitchEnd = (int32_t)filterPitch.advance(frames);
+  ctl.damping = (int32_t)filterDamping.current;
+  ctl.dampingEnd = (int32_t)filterDamping.advance(frames);
+  ctl.envDepth = (int32_t)(dsp.filter.envDepth * (1 << SVF_PITCH_BITS));
+  return ctl;
+}
+
+// Each channel of the interleaved bus runs on its own state (stride 2).
+// Holding still, the cached coefficients serve the whole block; while the
+// cutoff or resonance ramps, a new set every SVF_CONTROL_FRAMES.
+void AudioEngine::processFilterBlock(int32_t* buf, uint32_t frames) {
+  SvfControl ctl = advanceFilter(frames);
+  
+  if (!ctl.isMoving()) {
+    svf[0].process(ctl.type, svfCoef, buf, frames, 2, SVF_BUS_GUARD_BITS);
+    svf[1].process(ctl.type, svfCoef, buf + 1, frames, 2, SVF_BUS_GUARD_BITS);
+    return;
+  }
+  
+  for (uint32_t i = 0; i < frames; i += SVF_CONTROL_FRAMES) {
+    uint32_t run = frames - i;
+    if (run > SVF_CONTROL_FRAMES) run = SVF_CONTROL_FRAMES;
+    SvfCoefficients c = SvfCoefficients::fromPitch(ctl.pitchAt(i, frames),
+                                                   ctl.dampingAt(i, frames));
+    svf[0].process(ctl.type, c, buf + i * 2, run, 2, SVF_BUS_GUARD_BITS);
+    svf[1].process(ctl.type, c, buf + i * 2 + 1, run, 2, SVF_BUS_GUARD_BITS);
+  }
+  svfCoef = SvfCoefficients::fromPitch(ctl.pitchEnd, ctl.dampingEnd);
+}
+
+// The wet level ramps in Q12 across the block; the loop is FdnReverb::process
+void AudioEngine::processReverbBlock(int32_t* buf, uint32_t frames) {
+  int32_t wet = (int32_t)(reverbWet.current * 4096.0f);
+  int32_t wetEnd = (int32_t)(reverbWet.advance(frames) * 4096.0f);
+  reverb.process(buf, frames, wet, wetEnd);
+}
+
+// Delay time is set once per block: it glides towards the target (slew
+// limited to half a sample per sample, so the echo bends in pitch but never
+// plays backwards), plus the wow. The read position ramps linearly to it.
+void AudioEngine::processDelayBlock(int32_t* buf, uint32_t frames) {
+  float glide = frames * delayGlideRate;
+  if (glide > 1.0f) glide = 1.0f;
+  float move = (delayTarget - delayTime) * glide;
+  float slew = frames * 0.5f;
+  if (move > slew) move = slew;
+  if (move < -slew) move = -slew;
+  delayTime += move;
+  
+  float delay = delayTime;
+  if (delayModDepth > 0.0f) {
+    delay += delayModDepth * (delayMod.getSine(frames) * (1.0f / 32767.0f));
+  }
+  float maxDelay = (float)delayLine.maxDelay();
+  if (delay < 1.0f) delay = 1.0f;
+  if (delay > maxDelay) delay = maxDelay;
+  
+  uint32_t end = (uint32_t)(delay * (1 << DELAY_FRAC_BITS));
+  int32_t step = ((int32_t)end - (int32_t)delayRead) / (int32_t)frames;
+  uint32_t read = delayRead;
+  
+  // Q12 gains. The bus is not clamped (a resonant filter lifts it well past
+  // 16 bits), so its products are 64-bit; the line is 16-bit, so the echo
+  // and feedback products stay in 32.
+  int32_t feedback = dsp.delay.feedback * 4096 / 100;
+  int32_t wet = dsp.delay.mix * 4096 / 100;
+  int32_t dry = 4096 - wet;
+  
+  // Local copy: buf stores could alias its members as far as the compiler knows
+  DelayLine line = delayLine;
+  
+  // One line fed with the channel sum; the echo returns on both sides
+  for (uint32_t i = 0; i < frames; i++) {
+    int32_t left = buf[i * 2];
+    int32_t right = buf[i * 2 + 1];
+    int32_t delayed = line.read(read);
+    
+    line.write(((left + right) >> 1) + ((delayed * feedback) >> 12));
+    
+    int32_t echo = (delayed * wet) >> 12;
+    buf[i * 2] = (int32_t)(((int64_t)left * dry) >> 12) + echo;
+    buf[i * 2 + 1] = (int32_t)(((int64_t)right * dry) >> 12) + echo;
+    read += step;
   }
+  
+  delayLine.writePos = line.writePos;
+  delayRead = end;
 }
-// ============================================================================
-// UPDATE (for PWM mode with LFO, REVERB, SVF, EQ & DELAY)
-// ============================================================================
 
-void AudioEngine::update() {
-  if (settings->mode != MODE_PWM) return;
+// Channel sum in, one tap per voice out. Voices alternate left and right; a
+// third sits in the middle. Pan and wet are folded into one gain per tap.
+void AudioEngine::processChorusBlock(int32_t* buf, uint32_t frames) {
+  chorus.plan(frames);
   
-  static uint32_t lastMicros = 0;
-  uint32_t now = micros();
+  uint8_t taps = chorus.taps;
+  int32_t wet = dsp.chorus.mix * 4096 / 100;
+  int32_t dry = 4096 - wet;
+  int32_t gainL[MOD_DELAY_MAX_TAPS], gainR[MOD_DELAY_MAX_TAPS];
+  uint32_t read[MOD_DELAY_MAX_TAPS];
+  int32_t step[MOD_DELAY_MAX_TAPS];
+  for (uint8_t t = 0; t < taps; t++) {
+    gainL[t] = (chorusPanLeft[t] * wet) >> 12;
+    gainR[t] = (chorusPanRight[t] * wet) >> 12;
+    read[t] = chorus.tapRead[t];
+    step[t] = chorus.tapStep[t];
+  }
   
-  uint32_t interval = 1000000 / settings->sampleRate;
+  // Local copy: buf stores could alias its members as far as the compiler knows
+  DelayLine line = chorus.line;
   
-  if (now - lastMicros >= interval) {
-    lastMicros = now;
+  for (uint32_t i = 0; i < frames; i++) {
+    int32_t left = buf[i * 2];
+    int32_t right = buf[i * 2 + 1];
+    int64_t wetL = 0, wetR = 0;
     
-    // LFO outputs (per sample)
-    float lfoVibrato = 0.0f;
-    float lfoTremolo = 1.0f;
-    if (settings->lfo.enabled) {
-      float lfoValue = lfo.getSine(); // -1..1
-      
-      if (settings->lfo.vibratoEnabled) {
-        float depth = settings->lfo.depth / 100.0f;
-        lfoVibrato = lfoValue * depth * 0.02f;
-      }
-      
-      if (settings->lfo.tremoloEnabled) {
-        float depth = settings->lfo.depth / 100.0f;
-        float amp = 1.0f - depth + (lfoValue + 1.0f) * 0.5f * depth;
-        lfoTremolo = amp;
-      }
+    for (uint8_t t = 0; t < taps; t++) {
+      int32_t voice = line.read(read[t]);
+      wetL += (int64_t)voice * gainL[t];
+      wetR += (int64_t)voice * gainR[t];
+      read[t] += step[t];
     }
+    line.write((left + right) >> 1);
     
-    int32_t mixed = 0;
-    int active = 0;
+    // The bus is not clamped: 64-bit products
+    buf[i * 2] = (int32_t)(((int64_t)left * dry + wetL) >> 12);
+    buf[i * 2 + 1] = (int32_t)(((int64_t)right * dry + wetR) >> 12);
+  }
+  
+  chorus.line.writePos = line.writePos;
+  for (uint8_t t = 0; t < taps; t++) chorus.tapRead[t] = read[t];
+}
+
+// Each side through its own line, fed back (signed Q12) for the resonant comb
+void AudioEngine::processFlangerBlock(int32_t* buf, uint32_t frames) {
+  int32_t feedback = dsp.flanger.feedback * 4096 / 100;
+  int32_t wet = dsp.flanger.mix * 4096 / 100;
+  int32_t dry = 4096 - wet;
+  
+  for (int ch = 0; ch < 2; ch++) {
+    ModulatedDelay& side = flanger[ch];
+    side.plan(frames);
     
-    for (int v = 0; v < voiceCount; v++) {
-      if (voices[v].on) {
-        mixed += voices[v].getSample(lfoVibrato, lfoTremolo);
-        active++;
-      }
-    }
+    DelayLine line = side.line;
+    uint32_t read = side.tapRead[0];
+    int32_t step = side.tapStep[0];
+    int32_t* sample = buf + ch;
     
-    if (active == 0) {
-      if (pwmActive) {
-        ledcWrite(settings->pwm.pin, 0);
-        ledcDetach(settings->pwm.pin);
-        pinMode(settings->pwm.pin, OUTPUT);
-        digitalWrite(settings->pwm.pin, LOW);
-        pwmActive = false;
-      }
-      melodyPlayer.update();
-      return;
+    for (uint32_t i = 0; i < frames; i++) {
+      int32_t input = sample[i * 2];
+      int32_t delayed = line.read(read);
+      line.write(input + ((delayed * feedback) >> 12));
+      sample[i * 2] = (int32_t)(((int64_t)input * dry + delayed * wet) >> 12);
+      read += step;
     }
     
-    if (!pwmActive) {
-      ledcAttach(settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
-      pwmActive = true;
+    side.line.writePos = line.writePos;
+    side.tapRead[0] = read;
+  }
+}
+
+bool AudioEngine::renderMix(uint32_t frames) {
+  drainCommands();
+  if (const EffectCoefficients* c = coefficients.acquire()) {
+    applyCoefficients(*c);
+  }
+  takeConvolver();
+  bool active = renderVoicesBlock(frames);
+  
+  // EQ on the integer bus, ahead of the float stages: it is linear, so the
+  // order does not change the sound. Ramps only advance while it runs.
+  if (dsp.eq.enabled) {
+    eqCascade.process(mixBuffer, frames);
+  }
+  
+  // Bus filter (the per-voice one ran in renderVoicesBlock)
+  if (dsp.filter.enabled && !dsp.filter.perVoice) {
+    processFilterBlock(mixBuffer, frames);
+  }
+  
+  // Float stage (convolver)
+  if (dsp.convolver.enabled && convolver) {
+    uint32_t samples = frames * 2;
+    for (uint32_t i = 0; i < samples; i++) fxBuffer[i] = (float)mixBuffer[i];
+    
+    uint32_t start = platformCycleCount();
+    convolver->process(fxBuffer, frames, dsp.convolver.mix / 100.0f);
+    convolverCycles += platformCycleCount() - start;
+    
+    for (uint32_t i = 0; i < samples; i++) mixBuffer[i] = (int32_t)fxBuffer[i];
+  }
+  
+  // Integer stages (reverb -> chorus -> flanger -> echo)
+  if (dsp.reverb.enabled && reverb.initialized) {
+    processReverbBlock(mixBuffer, frames);
+  }
+  if (dsp.chorus.enabled && chorus.line.buffer) {
+    processChorusBlock(mixBuffer, frames);
+  }
+  if (dsp.flanger.enabled && flanger[1].line.buffer) {
+    processFlangerBlock(mixBuffer, frames);
+  }
+  if (dsp.delay.enabled && delayLine.buffer) {
+    processDelayBlock(mixBuffer, frames);
+  }
+  
+  if (dsp.compressor.enabled) {
+    compressor.process(mixBuffer, frames);
+    compressorReduction.store(compressor.takeReduction(), std::memory_order_relaxed);
+  }
+  
+  // Last stage: whatever the bus and effects summed to, hold the ceiling
+  if (dsp.limiter.enabled) {
+    limiter.process(mixBuffer, frames);
+    int32_t lowest = limiter.takeLowest();
+    limiterGain.store(lowest, std::memory_order_relaxed);
+    if (lowest < limiterLowest.load(std::memory_order_relaxed)) {
+      limiterLowest.store(lowest, std::memory_order_relaxed);
     }
+  }
+  
+  sampleClock.fetch_add(frames, std::memory_order_relaxed);
+  return active;
+}
+
+void AudioEngine::renderBlock(int16_t* out, uint32_t frames) {
+  uint32_t start = platformCycleCount();
+  uint32_t total = frames;
+  
+  while (frames > 0) {
+    uint32_t n = (frames < blockSize) ? frames : blockSize;
+    renderMix(n);
     
-    if (active > 1) {
-      mixed /= active;
+    // Already in I2S frame order: clamp straight across
+    for (uint32_t i = 0; i < n * 2; i++) {
+      int32_t mixed = mixBuffer[i];
+      if (mixed > 32767) mixed = 32767;
+      if (mixed < -32768) mixed = -32768;
+      out[i] = (int16_t)mixed;
     }
     
-    // SVF
-    if (settings->filter.enabled) {
-      float sample = (float)mixed;
-      float lp, bp, hp;
+    out += n * 2;
+    frames -= n;
+  }
+  
+  recordLoad(platformCycleCount() - start, total);
+}
+
+// ============================================================================
+// DSP LOAD MONITOR
+// ============================================================================
+
+void AudioEngine::recordLoad(uint32_t cycles, uint32_t frames) {
+  uint32_t convCycles = convolverCycles;
+  convolverCycles = 0;
+  if (!dsp.performance.enableCPUMonitor || frames == 0) return;
+  
+  float cyclesPerFrame = (float)platformCycleFrequency() / dsp.sampleRate;
+  uint32_t blockUs = (uint32_t)((uint64_t)cycles * 1000000 / platformCycleFrequency());
+  int32_t slackUs = (int32_t)((uint64_t)frames * 1000000 / dsp.sampleRate) - (int32_t)blockUs;
+  
+  load.current = (float)cycles * 100.0f / (frames * cyclesPerFrame);
+  load.lastBlockUs = blockUs;
+  load.deadlineUs = (uint32_t)((uint64_t)blockSize * 1000000 / dsp.sampleRate);
+  if (load.current > load.peak) load.peak = load.current;
+  if (blockUs > load.worstBlockUs) load.worstBlockUs = blockUs;
+  if (load.blocks == 0 || slackUs < load.headroomUs) load.headroomUs = slackUs;
+  load.blocks++;
+  
+  // Windowed average: busy cycles over the budget of all frames rendered
+  loadWindowCycles += cycles;
+  loadWindowConvolverCycles += convCycles;
+  loadWindowFrames += frames;
+  
+  uint32_t windowFrames = (uint32_t)((uint64_t)dsp.sampleRate * CPU_MONITOR_INTERVAL / 1000);
+  if (loadWindowFrames >= windowFrames) {
+    load.average = (float)loadWindowCycles * 100.0f / (loadWindowFrames * cyclesPerFrame);
+    load.convolver = (float)loadWindowConvolverCycles * 100.0f / (loadWindowFrames * cyclesPerFrame);
+    load.convolverCyclesPerFrame = (uint32_t)(loadWindowConvolverCycles / loadWindowFrames);
+    loadWindowCycles = 0;
+    loadWindowConvolverCycles = 0;
+    loadWindowFrames = 0;
+  }
+}
+
+void AudioEngine::resetDSPLoad() {
+  load.reset();
+  loadWindowCycles = 0;
+  loadWindowConvolverCycles = 0;
+  loadWindowFrames = 0;
+}
+
+// ============================================================================
+// XRUN DETECTION
+// ============================================================================
+
+void AudioEngine::recordXrun(XrunType type, uint32_t detailUs) {
+  switch (type) {
+    case XRUN_LATE_BLOCK:   xruns.lateBlocks++; break;
+    case XRUN_DMA_UNDERRUN: xruns.underruns++; break;
+    case XRUN_SHORT_WRITE:  xruns.shortWrites++; break;
+  }
+  xruns.total++;
+  
+  XrunEvent& event = xruns.events[xruns.eventHead];
+  event.timeMs = millis();
+  event.type = type;
+  event.detailUs = detailUs;
+  
+  xruns.eventHead = (xruns.eventHead + 1) % XRUN_LOG_SIZE;
+  if (xruns.eventCount < XRUN_LOG_SIZE) xruns.eventCount++;
+}
+
+const char* AudioEngine::getXrunTypeName(XrunType type) {
+  switch (type) {
+    case XRUN_LATE_BLOCK:   return "Late block";
+    case XRUN_DMA_UNDERRUN: return "DMA underrun";
+    case XRUN_SHORT_WRITE:  return "Short write";
+    default:                return "Unknown";
+  }
+}
+
+// ============================================================================
+// I2S AUDIO TASK
+// ============================================================================
+
+void AudioEngine::audioTask(void* parameter) {
+  AudioEngine* engine = (AudioEngine*)parameter;
+  const uint32_t frames = engine->blockSize;
+  int16_t buffer[frames * 2];
+  
+  // Xrun detection: once the DMA queue is full, each write returns as soon as
+  // one buffer drained, so the gap until the next write must stay within one
+  // block period or the queue loses a block of margin.
+  uint32_t cyclesPerUs = platformCycleFrequency() / 1000000;
+  uint32_t periodCycles = (uint32_t)((uint64_t)frames * platformCycleFrequency() / engine->settings->sampleRate);
+  uint32_t lastUnderruns = platformI2SUnderruns();
+  uint32_t lastWriteDone = platformCycleCount();
+  bool primed = false;
+  
+  while (true) {
+    // renderBlock() records its own DSP load; the blocking write is not timed
+    engine->renderBlock(buffer, frames);
+    
+    uint32_t gap = platformCycleCount() - lastWriteDone;
+    if (primed && gap > periodCycles) {
+      engine->recordXrun(XRUN_LATE_BLOCK, gap / cyclesPerUs);
+    }
+    
+    size_t written = platformI2SWrite(buffer, sizeof(buffer));
+    lastWriteDone = platformCycleCount();
+    primed = true;
+    
+    if (written < sizeof(buffer)) {
+      engine->recordXrun(XRUN_SHORT_WRITE, 0);
+    }
+    
+    uint32_t underruns = platformI2SUnderruns();
+    while (lastUnderruns != underruns) {
+      engine->recordXrun(XRUN_DMA_UNDERRUN, 0);
+      lastUnderruns++;
+    }
+  }
+}
+
+// ============================================================================
+// PWM INITIALIZATION
+// ============================================================================
+
+void AudioEngine::initPWM() {
+  Serial.println(F("[PWM] Initializing..."));
+  
+  platformPWMAttach(settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
+  platformPWMWrite(settings->pwm.pin, 1 << (settings->pwm.resolution - 1));
+  pwmActive = true;
+  
+  Serial.printf("[PWM] ✓ Initialized on GPIO %u (%u Hz, %u-bit)\n",
+                settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
+}
+
+void AudioEngine::deinitPWM() {
+  if (pwmActive) {
+    platformPWMDetach(settings->pwm.pin);
+    pwmActive = false;
+  }
+}
+// ============================================================================
+// UPDATE (loop task: melody timing; PWM mode also consumes the shared block
+// pipeline one sample per tick)
+// ============================================================================
+
+void AudioEngine::update() {
+  // The melody player posts notes like the console does, from this task
+  melodyPlayer.update();
+  
+  if (!outputAttached || settings->mode != MODE_PWM) return;
+  
+  static uint32_t lastMicros = 0;
+  uint32_t now = micros();
+  
+  uint32_t interval = 1000000 / settings->sampleRate;
+  
+  if (now - lastMicros >= interval) {
+    lastMicros = now;
+    
+    if (pwmBlockPos >= blockSize) {
+      uint32_t start = platformCycleCount();
+      pwmBlockActive = renderMix(blockSize);
+      recordLoad(platformCycleCount() - start, blockSize);
+      pwmBlockPos = 0;
+      pwmGain = (settings->pwm.gain * 32768 + 127) / 255;
+    }
+    // One pin: play the channel sum
+    int32_t mixed = (mixBuffer[pwmBlockPos * 2] + mixBuffer[pwmBlockPos * 2 + 1]) / 2;
+    pwmBlockPos++;
+    
+    if (!pwmBlockActive) {
+      if (pwmActive) {
+        platformPWMDetach(settings->pwm.pin);
+        pwmActive = false;
+      }
+      return;
+    }
+    
+    if (!pwmActive) {
+      platformPWMAttach(settings->pwm.pin, settings->pwm.frequency, settings->pwm.resolution);
+      pwmActive = true;
+    }
+    
+    // Volume is already applied in the shared pipeline
+    mixed = (int32_t)(((int64_t)mixed * pwmGain) >> 15);
+    
+    // The bus exceeds 16 bits when the limiter is off: clamp before the
+    // offset, or a negative peak would wrap to full duty
+    if (mixed > 32767) mixed = 32767;
+    if (mixed < -32768) mixed = -32768;
+    
+    uint32_t pwm = ((mixed + 32768) >> (16 - settings->pwm.resolution));
+    pwm = constrain(pwm, 0, (1U << settings->pwm.resolution) - 1);
+    
+    platformPWMWrite(settings->pwm.pin, pwm);
+  }
+}
+
+// ============================================================================
+// CONTROL COMMANDS (posted by the loop task, applied by the audio task)
+// ============================================================================
+
+// Returns false (and reports it) when the queue stayed full. Releases wait
+// up to AUDIO_COMMAND_RETRY_MS for the audio task to drain a slot: a late
+// note-off is better than a stuck note.
+bool AudioEngine::postCommand(AudioCommand& cmd) {
+  cmd.frame = sampleClock.load(std::memory_order_relaxed);
+  if (cmd.type == CMD_NOTE_OFF || cmd.type == CMD_ALL_NOTES_OFF) {
+    for (uint32_t waited = 0; commands.full() && waited < AUDIO_COMMAND_RETRY_MS; waited++) {
+      delay(1);
+    }
+  }
+  if (commands.push(cmd)) return true;
+  
+  Serial.println(F("[ERROR] Audio command queue full - command dropped"));
+  return false;
+}
+
+// Runs at the start of every block, before anything reads dsp or the voices
+void AudioEngine::drainCommands() {
+  uint32_t now = sampleClock.load(std::memory_order_relaxed);
+  AudioCommand cmd;
+  
+  while (commands.pop(cmd)) {
+    uint32_t latency = now - cmd.frame;
+    if (latency > commandStats.maxLatencyFrames) commandStats.maxLatencyFrames = latency;
+    applyCommand(cmd);
+    commandStats.applied++;
+  }
+}
+
+void AudioEngine::applyCommand(const AudioCommand& cmd) {
+  switch (cmd.type) {
+    case CMD_NOTE_ON:
+      voiceBank.play(cmd.a, cmd.b, cmd.c);
+      break;
       
-      svf.process(sample, 0, lp, bp, hp);
+    case CMD_NOTE_OFF:
+      voiceBank.release(cmd.a);
+      break;
       
-      switch(settings->filter.type) {
-        case FILTER_LOWPASS:  sample = lp; break;
-        case FILTER_HIGHPASS: sample = hp; break;
-        case FILTER_BANDPASS: sample = bp; break;
-      }
+    case CMD_ALL_NOTES_OFF:
+      voiceBank.allNotesOff();
+      break;
+      
+    case CMD_VOLUME:
+      dsp.volume = cmd.a;
+      volumeLevel.setTarget(cmd.a);
+      break;
+      
+    case CMD_WAVEFORM:
+      dsp.waveform = (WaveformType)cmd.a;
+      voiceBank.setWaveform(dsp.waveform);
+      break;
       
-      mixed = (int32_t)sample;
+    case CMD_OSCILLATOR:
+      dsp.oscillator = (OscillatorMode)cmd.a;
+      voiceBank.setOscillatorMode(dsp.oscillator);
+      break;
+      
+    case CMD_VOICE_STEAL:
+      dsp.voiceSteal = (VoiceStealPolicy)cmd.a;
+      voiceBank.setStealPolicy(dsp.voiceSteal);
+      break;
+      
+    case CMD_ENVELOPE: {
+      EnvelopeConfig& env = dsp.envelope;
+      env.attackMs = cmd.u16[0];
+      env.decayMs = cmd.u16[1];
+      env.releaseMs = cmd.u16[2];
+      env.sustain = cmd.a;
+      env.curve = (EnvelopeCurve)cmd.b;
+      // Converted to per-sample steps for the current rate here, once
+      voiceBank.setEnvelope(env.attackMs, env.decayMs, env.sustain, env.releaseMs, env.curve);
+      break;
     }
-    
-    // EQ
-    if (settings->eq.enabled) {
-      float sample = (float)mixed;
       
-      if (settings->eq.bass != 0)   sample = eqBass.process(sample, 0);
-      if (settings->eq.mid != 0)    sample = eqMid.process(sample, 0);
-      if (settings->eq.treble != 0) sample = eqTreble.process(sample, 0);
+    case CMD_EQ: {
+      // Bands arrive as a snapshot; the sections hold stale memory while
+      // the EQ is off, so clear them as it comes back in
+      if (cmd.a && !dsp.eq.enabled) {
+        eqCascade.settle();
+      }
+      dsp.eq.enabled = cmd.a;
+      break;
+    }
+      
+    case CMD_FILTER:
+      // Ramps only advance while the filter runs; a filter that starts
+      // (or moves between bus and voices) starts clear
+      if (cmd.a && (!dsp.filter.enabled || (bool)cmd.c != dsp.filter.perVoice)) {
+        svf[0].reset();
+        svf[1].reset();
+        voiceBank.resetFilters();
+        filterPitch.reset(filterPitch.target);
+        filterDamping.reset(filterDamping.target);
+        svfCoef = SvfCoefficients::fromPitch((int32_t)filterPitch.current,
+                                             (int32_t)filterDamping.current);
+      }
+      dsp.filter.enabled = cmd.a;
+      dsp.filter.type = (FilterType)cmd.b;
+      dsp.filter.perVoice = cmd.c;
+      dsp.filter.cutoff = cmd.f[0];
+      dsp.filter.resonance = cmd.f[1];
+      dsp.filter.envDepth = cmd.f[2];
+      break;
       
-      mixed = (int32_t)sample;
+    case CMD_REVERB: {
+      bool start = cmd.a && !dsp.reverb.enabled;
+      bool stop = dsp.reverb.enabled && !cmd.a;
+      dsp.reverb.enabled = cmd.a;
+      dsp.reverb.roomSize = cmd.f[0];
+      dsp.reverb.damping = cmd.f[1];
+      dsp.reverb.wet = cmd.f[2];
+      if (stop) reverb.reset();
+      // The wet ramp only advances while the reverb runs
+      if (start) {
+        reverbWet.reset(dsp.reverb.wet);
+      } else {
+        reverbWet.setTarget(dsp.reverb.wet);
+      }
+      break;
     }
-    
-    // Reverb
-    if (settings->reverb.enabled && reverb.initialized) {
-      float sample = (float)mixed;
-      float wet = reverb.process(sample, settings->reverb.damping);
-      float dry = sample * (1.0f - settings->reverb.wet);
-      float reverbOut = dry + (wet * settings->reverb.wet);
-      mixed = (int32_t)reverbOut;
+      
+    case CMD_LFO: {
+      bool start = cmd.a && !dsp.lfo.enabled;
+      dsp.lfo.enabled = cmd.a;
+      dsp.lfo.vibratoEnabled = cmd.b;
+      dsp.lfo.tremoloEnabled = cmd.c;
+      dsp.lfo.rate = cmd.f[0];
+      dsp.lfo.depth = cmd.f[1];
+      if (start) lfo.reset();
+      updateLFORate();
+      break;
+    }
+      
+    case CMD_DELAY: {
+      bool start = cmd.a && !dsp.delay.enabled;
+      dsp.delay.enabled = cmd.a;
+      dsp.delay.feedback = cmd.b;
+      dsp.delay.mix = cmd.c;
+      dsp.delay.timeMs = cmd.u16[0];
+      dsp.delay.modRate = cmd.f[1];
+      dsp.delay.modDepth = cmd.f[2];
+      configureDelay(start);
+      break;
     }
-    
-    // Delay
-    if (settings->delay.enabled && delayBuffer) {
-      uint32_t delaySamples = (settings->sampleRate * settings->delay.timeMs) / 1000;
-      if (delaySamples >= delayBufferSize) delaySamples = delayBufferSize - 1;
       
-      uint32_t readPos = (delayWritePos + delayBufferSize - delaySamples) % delayBufferSize;
-      int32_t delayedSample = delayBuffer[readPos];
+    case CMD_CHORUS: {
+      bool start = cmd.a && !dsp.chorus.enabled;
+      dsp.chorus.enabled = cmd.a;
+      dsp.chorus.voices = cmd.b;
+      dsp.chorus.mix = cmd.c;
+      dsp.chorus.rate = cmd.f[0];
+      dsp.chorus.delayMs = cmd.f[1];
+      dsp.chorus.depthMs = cmd.f[2];
+      configureChorus(start);
+      break;
+    }
       
-      int32_t feedbackAmount = (settings->delay.feedback * delayedSample) / 100;
-      int32_t toBuffer = mixed + feedbackAmount;
+    case CMD_FLANGER: {
+      bool start = cmd.a && !dsp.flanger.enabled;
+      dsp.flanger.enabled = cmd.a;
+      dsp.flanger.feedback = (int8_t)cmd.b;
+      dsp.flanger.mix = cmd.c;
+      dsp.flanger.rate = cmd.f[0];
+      dsp.flanger.delayMs = cmd.f[1];
+      dsp.flanger.depthMs = cmd.f[2];
+      configureFlanger(start);
+      break;
+    }
       
-      if (toBuffer > 32767) toBuffer = 32767;
-      if (toBuffer < -32768) toBuffer = -32768;
-      delayBuffer[delayWritePos] = (int16_t)toBuffer;
+    case CMD_CONVOLVER:
+      // The history is stale after a pause; a new IR arrives by takeConvolver()
+      if (cmd.a && !dsp.convolver.enabled && convolver) convolver->reset();
+      dsp.convolver.enabled = cmd.a;
+      dsp.convolver.mix = cmd.b;
+      break;
       
-      int32_t dry = (mixed * (100 - settings->delay.mix)) / 100;
-      int32_t wet = (delayedSample * settings->delay.mix) / 100;
-      mixed = dry + wet;
+    case CMD_COMPRESSOR:
+      if (cmd.a && !dsp.compressor.enabled) compressor.reset();
+      if (!cmd.a) compressorReduction.store(0, std::memory_order_relaxed);
+      dsp.compressor.enabled = cmd.a;
+      break;
       
-      delayWritePos = (delayWritePos + 1) % delayBufferSize;
+    case CMD_LIMITER: {
+      bool start = cmd.a && !dsp.limiter.enabled;
+      dsp.limiter.enabled = cmd.a;
+      dsp.limiter.ceilingDb = cmd.f[0];
+      dsp.limiter.releaseMs = (uint16_t)cmd.f[1];
+      configureLimiter();
+      if (start) limiter.reset();
+      if (!cmd.a) limiterGain.store(PeakLimiter::UNITY, std::memory_order_relaxed);
+      break;
     }
-    
-    mixed = (mixed * settings->pwm.gain * settings->volume) / (255 * 255);
-    
-    uint32_t pwm = ((mixed + 32768) >> (16 - settings->pwm.resolution));
-    pwm = constrain(pwm, 0, (1 << settings->pwm.resolution) - 1);
-    
-    ledcWrite(settings->pwm.pin, pwm);
   }
-  
-  melodyPlayer.update();
+}
+
+// Each group is posted whole, so the audio side never sees half an update
+
+bool AudioEngine::postEQ() {
+  AudioCommand cmd(CMD_EQ);
+  cmd.a = settings->eq.enabled;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postFilter() {
+  AudioCommand cmd(CMD_FILTER);
+  cmd.a = settings->filter.enabled;
+  cmd.b = settings->filter.type;
+  cmd.c = settings->filter.perVoice;
+  cmd.f[0] = settings->filter.cutoff;
+  cmd.f[1] = settings->filter.resonance;
+  cmd.f[2] = settings->filter.envDepth;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postReverb() {
+  AudioCommand cmd(CMD_REVERB);
+  cmd.a = settings->reverb.enabled;
+  cmd.f[0] = settings->reverb.roomSize;
+  cmd.f[1] = settings->reverb.damping;
+  cmd.f[2] = settings->reverb.wet;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postLFO() {
+  AudioCommand cmd(CMD_LFO);
+  cmd.a = settings->lfo.enabled;
+  cmd.b = settings->lfo.vibratoEnabled;
+  cmd.c = settings->lfo.tremoloEnabled;
+  cmd.f[0] = settings->lfo.rate;
+  cmd.f[1] = settings->lfo.depth;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postDelay() {
+  AudioCommand cmd(CMD_DELAY);
+  cmd.a = settings->delay.enabled;
+  cmd.b = settings->delay.feedback;
+  cmd.c = settings->delay.mix;
+  cmd.u16[0] = settings->delay.timeMs;
+  cmd.f[1] = settings->delay.modRate;
+  cmd.f[2] = settings->delay.modDepth;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postChorus() {
+  AudioCommand cmd(CMD_CHORUS);
+  cmd.a = settings->chorus.enabled;
+  cmd.b = settings->chorus.voices;
+  cmd.c = settings->chorus.mix;
+  cmd.f[0] = settings->chorus.rate;
+  cmd.f[1] = settings->chorus.delayMs;
+  cmd.f[2] = settings->chorus.depthMs;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postFlanger() {
+  AudioCommand cmd(CMD_FLANGER);
+  cmd.a = settings->flanger.enabled;
+  cmd.b = (uint8_t)settings->flanger.feedback;
+  cmd.c = settings->flanger.mix;
+  cmd.f[0] = settings->flanger.rate;
+  cmd.f[1] = settings->flanger.delayMs;
+  cmd.f[2] = settings->flanger.depthMs;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postConvolver() {
+  AudioCommand cmd(CMD_CONVOLVER);
+  cmd.a = settings->convolver.enabled;
+  cmd.b = settings->convolver.mix;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postCompressor() {
+  AudioCommand cmd(CMD_COMPRESSOR);
+  cmd.a = settings->compressor.enabled;
+  return postCommand(cmd);
+}
+
+bool AudioEngine::postLimiter() {
+  AudioCommand cmd(CMD_LIMITER);
+  cmd.a = settings->limiter.enabled;
+  cmd.f[0] = settings->limiter.ceilingDb;
+  cmd.f[1] = settings->limiter.releaseMs;
+  return postCommand(cmd);
 }
 
 // ============================================================================
 // PLAYBACK CONTROL
 // ============================================================================
 
-int AudioEngine::findFreeVoice() {
-  for (int i = 0; i < voiceCount; i++) {
-    if (!voices[i].on) return i;
-  }
-  return 0;
+// Keyboard pan: panSpread 100% puts two octaves either side of middle C at
+// the hard left/right
+bool AudioEngine::noteOn(uint8_t note, uint8_t velocity) {
+  int32_t offset = ((int32_t)note - 60) * settings->panSpread * 63 / (24 * 100);
+  return noteOn(note, velocity, (uint8_t)constrain(PAN_CENTER + offset, 1, 127));
 }
 
-void AudioEngine::noteOn(uint8_t note, uint8_t velocity) {
-  int idx = findFreeVoice();
-  voices[idx].noteOn(note, velocity, settings->sampleRate);
+bool AudioEngine::noteOn(uint8_t note, uint8_t velocity, uint8_t pan) {
+  AudioCommand cmd(CMD_NOTE_ON);
+  cmd.a = note;
+  cmd.b = velocity;
+  cmd.c = pan;
+  return postCommand(cmd);
 }
 
-void AudioEngine::noteOff(uint8_t note) {
-  for (int i = 0; i < voiceCount; i++) {
-    if (voices[i].on && voices[i].note == note) {
-      voices[i].noteOff();
-    }
-  }
+bool AudioEngine::noteOff(uint8_t note) {
+  AudioCommand cmd(CMD_NOTE_OFF);
+  cmd.a = note;
+  return postCommand(cmd);
 }
 
-void AudioEngine::allNotesOff() {
-  for (int i = 0; i < voiceCount; i++) {
-    voices[i].noteOff();
-  }
+bool AudioEngine::allNotesOff() {
+  AudioCommand cmd(CMD_ALL_NOTES_OFF);
+  return postCommand(cmd);
 }
 
 void AudioEngine::playMelody(const Note* melody, size_t length) {
@@ -994,34 +1386,62 @@ bool AudioEngine::isPlaying() {
 
 void AudioEngine::setVolume(uint8_t volume) {
   settings->volume = constrain(volume, 0, 255);
+  
+  AudioCommand cmd(CMD_VOLUME);
+  cmd.a = settings->volume;
+  postCommand(cmd);
 }
 
 uint8_t AudioEngine::getVolume() {
   return settings->volume;
 }
 
+// Control side only: turned into a pan per note in noteOn()
+void AudioEngine::setPanSpread(uint8_t spread) {
+  settings->panSpread = constrain(spread, 0, 100);
+}
+
+uint8_t AudioEngine::getPanSpread() {
+  return settings->panSpread;
+}
+
 // ============================================================================
 // SETTINGS: BIQUAD EQ
 // ============================================================================
 
 void AudioEngine::setEQ(int8_t bass, int8_t mid, int8_t treble) {
-  settings->eq.bass = constrain(bass, -12, 12);
-  settings->eq.mid = constrain(mid, -12, 12);
-  settings->eq.treble = constrain(treble, -12, 12);
-  updateEQFilters();
+  EQBand* bands = settings->eq.bands;
+  bands[0].gain = constrain(bass, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+  bands[1].gain = constrain(mid, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+  bands[2].gain = constrain(treble, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+  publishCoefficients();
 }
 
 void AudioEngine::getEQ(int8_t& bass, int8_t& mid, int8_t& treble) {
-  bass = settings->eq.bass;
-  mid = settings->eq.mid;
-  treble = settings->eq.treble;
+  const EQBand* bands = settings->eq.bands;
+  bass = (int8_t)lroundf(bands[0].gain);
+  mid = (int8_t)lroundf(bands[1].gain);
+  treble = (int8_t)lroundf(bands[2].gain);
+}
+
+bool AudioEngine::setEQBand(uint8_t band, BiquadType type, float freq, float gainDb, float q) {
+  if (band >= EQ_MAX_BANDS) return false;
+  float maxFreq = settings->sampleRate * 0.45f;
+  settings->eq.bands[band].set(type,
+                               constrain(freq, (float)EQ_MIN_FREQ, maxFreq),
+                               constrain(gainDb, (float)-EQ_MAX_GAIN_DB, (float)EQ_MAX_GAIN_DB),
+                               constrain(q, EQ_MIN_Q, EQ_MAX_Q));
+  publishCoefficients();
+  return true;
+}
+
+const EQBand* AudioEngine::getEQBand(uint8_t band) {
+  return band < EQ_MAX_BANDS ? &settings->eq.bands[band] : nullptr;
 }
 
 void AudioEngine::setEQEnabled(bool enabled) {
   settings->eq.enabled = enabled;
-  if (enabled) {
-    updateEQFilters();
-  }
+  postEQ();
 }
 
 bool AudioEngine::getEQEnabled() {
@@ -1034,9 +1454,7 @@ bool AudioEngine::getEQEnabled() {
 
 void AudioEngine::setFilterEnabled(bool enabled) {
   settings->filter.enabled = enabled;
-  if (enabled) {
-    updateFilterCoefficients();
-  }
+  postFilter();
 }
 
 bool AudioEngine::getFilterEnabled() {
@@ -1045,6 +1463,7 @@ bool AudioEngine::getFilterEnabled() {
 
 void AudioEngine::setFilterType(FilterType type) {
   settings->filter.type = type;
+  postFilter();
 }
 
 FilterType AudioEngine::getFilterType() {
@@ -1057,7 +1476,8 @@ const char* AudioEngine::getFilterTypeName() {
 
 void AudioEngine::setFilterCutoff(float cutoffHz) {
   settings->filter.cutoff = constrain(cutoffHz, FILTER_CUTOFF_MIN, FILTER_CUTOFF_MAX);
-  updateFilterCoefficients();
+  publishCoefficients();
+  postFilter();
 }
 
 float AudioEngine::getFilterCutoff() {
@@ -1066,32 +1486,49 @@ float AudioEngine::getFilterCutoff() {
 
 void AudioEngine::setFilterResonance(float resonance) {
   settings->filter.resonance = constrain(resonance, FILTER_RESONANCE_MIN, FILTER_RESONANCE_MAX);
-  updateFilterCoefficients();
+  publishCoefficients();
+  postFilter();
 }
 
 float AudioEngine::getFilterResonance() {
   return settings->filter.resonance;
 }
 
+void AudioEngine::setFilterPerVoice(bool perVoice) {
+  settings->filter.perVoice = perVoice;
+  postFilter();
+}
+
+bool AudioEngine::getFilterPerVoice() {
+  return settings->filter.perVoice;
+}
+
+void AudioEngine::setFilterEnvDepth(float octaves) {
+  settings->filter.envDepth = constrain(octaves, -FILTER_ENV_DEPTH_MAX, FILTER_ENV_DEPTH_MAX);
+  postFilter();
+}
+
+float AudioEngine::getFilterEnvDepth() {
+  return settings->filter.envDepth;
+}
+
 // ============================================================================
-// SETTINGS: SCHROEDER REVERB
+// SETTINGS: REVERB
 // ============================================================================
 
 void AudioEngine::setReverbEnabled(bool enabled) {
+  // Allocated here, not in the audio task; it only reads the buffer once the
+  // enable command arrives
   if (enabled && !reverb.initialized) {
-    if (!reverb.init()) {
+    if (!reverb.init(settings->sampleRate)) {
       Serial.println(F("[ERROR] Failed to allocate reverb buffer"));
       settings->reverb.enabled = false;
       return;
     }
-    updateReverbParameters();
   }
   
   settings->reverb.enabled = enabled;
-  
-  if (!enabled && reverb.initialized) {
-    reverb.reset();
-  }
+  postReverb();
 }
 
 bool AudioEngine::getReverbEnabled() {
@@ -1100,7 +1537,8 @@ bool AudioEngine::getReverbEnabled() {
 
 void AudioEngine::setReverbRoomSize(float size) {
   settings->reverb.roomSize = constrain(size, 0.0f, 1.0f);
-  updateReverbParameters();
+  publishCoefficients();
+  postReverb();
 }
 
 float AudioEngine::getReverbRoomSize() {
@@ -1109,6 +1547,8 @@ float AudioEngine::getReverbRoomSize() {
 
 void AudioEngine::setReverbDamping(float damping) {
   settings->reverb.damping = constrain(damping, 0.0f, 1.0f);
+  publishCoefficients();
+  postReverb();
 }
 
 float AudioEngine::getReverbDamping() {
@@ -1117,6 +1557,7 @@ float AudioEngine::getReverbDamping() {
 
 void AudioEngine::setReverbWet(float wet) {
   settings->reverb.wet = constrain(wet, 0.0f, 1.0f);
+  postReverb();
 }
 
 float AudioEngine::getReverbWet() {
@@ -1129,10 +1570,7 @@ float AudioEngine::getReverbWet() {
 
 void AudioEngine::setLFOEnabled(bool enabled) {
   settings->lfo.enabled = enabled;
-  if (enabled) {
-    lfo.reset();
-    updateLFORate();
-  }
+  postLFO();
 }
 
 bool AudioEngine::getLFOEnabled() {
@@ -1141,6 +1579,7 @@ bool AudioEngine::getLFOEnabled() {
 
 void AudioEngine::setLFOVibratoEnabled(bool enabled) {
   settings->lfo.vibratoEnabled = enabled;
+  postLFO();
 }
 
 bool AudioEngine::getLFOVibratoEnabled() {
@@ -1149,6 +1588,7 @@ bool AudioEngine::getLFOVibratoEnabled() {
 
 void AudioEngine::setLFOTremoloEnabled(bool enabled) {
   settings->lfo.tremoloEnabled = enabled;
+  postLFO();
 }
 
 bool AudioEngine::getLFOTremoloEnabled() {
@@ -1157,7 +1597,7 @@ bool AudioEngine::getLFOTremoloEnabled() {
 
 void AudioEngine::setLFORate(float rateHz) {
   settings->lfo.rate = constrain(rateHz, LFO_RATE_MIN, LFO_RATE_MAX);
-  updateLFORate();
+  postLFO();
 }
 
 float AudioEngine::getLFORate() {
@@ -1166,6 +1606,7 @@ float AudioEngine::getLFORate() {
 
 void AudioEngine::setLFODepth(float depthPercent) {
   settings->lfo.depth = constrain(depthPercent, LFO_DEPTH_MIN, LFO_DEPTH_MAX);
+  postLFO();
 }
 
 float AudioEngine::getLFODepth() {
@@ -1176,8 +1617,25 @@ float AudioEngine::getLFODepth() {
 // SETTINGS: DELAY
 // ============================================================================
 
+// Audio side: delay time in samples, glide and wow. restart (the delay was
+// just switched on) clears the line and jumps to the new time.
+void AudioEngine::configureDelay(bool restart) {
+  float rate = (float)dsp.sampleRate;
+  delayTarget = dsp.delay.timeMs * rate / 1000.0f;
+  delayModDepth = dsp.delay.modDepth * rate / 1000.0f;
+  delayGlideRate = 1000.0f / (DELAY_GLIDE_MS * rate);
+  delayMod.setRate(dsp.delay.modRate, rate);
+  
+  if (restart) {
+    delayLine.reset();
+    delayMod.reset();
+    delayTime = delayTarget;
+    delayRead = (uint32_t)(delayTime * (1 << DELAY_FRAC_BITS));
+  }
+}
+
 void AudioEngine::setDelayEnabled(bool enabled) {
-  if (enabled && !delayBuffer) {
+  if (enabled && !delayLine.buffer) {
     if (!allocateDelayBuffer()) {
       Serial.println(F("[ERROR] Failed to allocate delay buffer"));
       settings->delay.enabled = false;
@@ -1185,12 +1643,9 @@ void AudioEngine::setDelayEnabled(bool enabled) {
     }
   }
   
+  // The audio task clears the line when the enable command arrives
   settings->delay.enabled = enabled;
-  
-  if (enabled && delayBuffer) {
-    memset(delayBuffer, 0, delayBufferSize * sizeof(int16_t));
-    delayWritePos = 0;
-  }
+  postDelay();
 }
 
 bool AudioEngine::getDelayEnabled() {
@@ -1199,6 +1654,7 @@ bool AudioEngine::getDelayEnabled() {
 
 void AudioEngine::setDelayTime(uint16_t ms) {
   settings->delay.timeMs = constrain(ms, 10, MAX_DELAY_TIME);
+  postDelay();
 }
 
 uint16_t AudioEngine::getDelayTime() {
@@ -1207,6 +1663,7 @@ uint16_t AudioEngine::getDelayTime() {
 
 void AudioEngine::setDelayFeedback(uint8_t percent) {
   settings->delay.feedback = constrain(percent, 0, 90);
+  postDelay();
 }
 
 uint8_t AudioEngine::getDelayFeedback() {
@@ -1215,27 +1672,470 @@ uint8_t AudioEngine::getDelayFeedback() {
 
 void AudioEngine::setDelayMix(uint8_t percent) {
   settings->delay.mix = constrain(percent, 0, 100);
+  postDelay();
 }
 
 uint8_t AudioEngine::getDelayMix() {
   return settings->delay.mix;
 }
 
+void AudioEngine::setDelayModulation(float rateHz, float depthMs) {
+  settings->delay.modRate = constrain(rateHz, DELAY_MOD_RATE_MIN, DELAY_MOD_RATE_MAX);
+  settings->delay.modDepth = constrain(depthMs, 0.0f, (float)DELAY_MOD_DEPTH_MAX);
+  postDelay();
+}
+
+float AudioEngine::getDelayModRate() {
+  return settings->delay.modRate;
+}
+
+float AudioEngine::getDelayModDepth() {
+  return settings->delay.modDepth;
+}
+
+uint16_t AudioEngine::tapDelay() {
+  uint32_t now = millis();
+  uint32_t gap = now - tapLastMs;
+  tapLastMs = now;
+  
+  if (tapCount == 0 || gap > DELAY_TAP_TIMEOUT_MS) {
+    tapCount = 1;
+    return 0;
+  }
+  
+  // Keep the last DELAY_TAP_COUNT intervals, newest first
+  uint8_t intervals = (tapCount < DELAY_TAP_COUNT) ? tapCount : DELAY_TAP_COUNT;
+  for (uint8_t i = intervals - 1; i > 0; i--) tapIntervals[i] = tapIntervals[i - 1];
+  tapIntervals[0] = (uint16_t)gap;
+  if (tapCount <= DELAY_TAP_COUNT) tapCount++;
+  
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < intervals; i++) sum += tapIntervals[i];
+  setDelayTime((uint16_t)(sum / intervals));
+  return settings->delay.timeMs;
+}
+
+// ============================================================================
+// SETTINGS: CHORUS
+// ============================================================================
+
+// Audio side: sweep in samples and the voice pans. restart (the chorus was
+// just switched on) clears the line.
+void AudioEngine::configureChorus(bool restart) {
+  float rate = (float)dsp.sampleRate;
+  uint8_t voices = dsp.chorus.voices;
+  chorus.configure(dsp.chorus.delayMs * rate / 1000.0f, dsp.chorus.depthMs * rate / 1000.0f,
+                   dsp.chorus.rate, rate, voices);
+  
+  for (uint8_t t = 0; t < voices; t++) {
+    bool middle = (t == 2);
+    chorusPanLeft[t] = middle ? 2896 : ((t & 1) ? 0 : 4096);     // 2896 = 4096 / sqrt(2)
+    chorusPanRight[t] = middle ? 2896 : ((t & 1) ? 4096 : 0);
+  }
+  
+  if (restart) chorus.reset();
+}
+
+void AudioEngine::setChorusEnabled(bool enabled) {
+  if (enabled && !chorus.line.buffer) {
+    if (!allocateChorusBuffer()) {
+      Serial.println(F("[ERROR] Failed to allocate chorus buffer"));
+      settings->chorus.enabled = false;
+      return;
+    }
+  }
+  
+  // The audio task clears the line when the enable command arrives
+  settings->chorus.enabled = enabled;
+  postChorus();
+}
+
+bool AudioEngine::getChorusEnabled() {
+  return settings->chorus.enabled;
+}
+
+void AudioEngine::setChorusVoices(uint8_t voices) {
+  settings->chorus.voices = constrain(voices, CHORUS_VOICES_MIN, CHORUS_VOICES_MAX);
+  postChorus();
+}
+
+uint8_t AudioEngine::getChorusVoices() {
+  return settings->chorus.voices;
+}
+
+void AudioEngine::setChorusRate(float rateHz) {
+  settings->chorus.rate = constrain(rateHz, CHORUS_RATE_MIN, CHORUS_RATE_MAX);
+  postChorus();
+}
+
+float AudioEngine::getChorusRate() {
+  return settings->chorus.rate;
+}
+
+void AudioEngine::setChorusDelay(float ms) {
+  settings->chorus.delayMs = constrain(ms, CHORUS_DELAY_MIN_MS, CHORUS_DELAY_MAX_MS);
+  postChorus();
+}
+
+float AudioEngine::getChorusDelay() {
+  return settings->chorus.delayMs;
+}
+
+void AudioEngine::setChorusDepth(float ms) {
+  settings->chorus.depthMs = constrain(ms, 0.0f, CHORUS_DEPTH_MAX_MS);
+  postChorus();
+}
+
+float AudioEngine::getChorusDepth() {
+  return settings->chorus.depthMs;
+}
+
+void AudioEngine::setChorusMix(uint8_t percent) {
+  settings->chorus.mix = constrain(percent, 0, 100);
+  postChorus();
+}
+
+uint8_t AudioEngine::getChorusMix() {
+  return settings->chorus.mix;
+}
+
+// ============================================================================
+// SETTINGS: FLANGER
+// ============================================================================
+
+// Audio side: the same sweep on both lines, the right one a quarter cycle on
+void AudioEngine::configureFlanger(bool restart) {
+  float rate = (float)dsp.sampleRate;
+  for (int ch = 0; ch < 2; ch++) {
+    flanger[ch].configure(dsp.flanger.delayMs * rate / 1000.0f, dsp.flanger.depthMs * rate / 1000.0f,
+                          dsp.flanger.rate, rate, 1);
+  }
+  
+  if (restart) {
+    flanger[0].reset();
+    flanger[1].reset(FLANGER_STEREO_PHASE);
+  }
+}
+
+void AudioEngine::setFlangerEnabled(bool enabled) {
+  if (enabled && !flanger[1].line.buffer) {
+    if (!allocateFlangerBuffers()) {
+      Serial.println(F("[ERROR] Failed to allocate flanger buffers"));
+      settings->flanger.enabled = false;
+      return;
+    }
+  }
+  
+  settings->flanger.enabled = enabled;
+  postFlanger();
+}
+
+bool AudioEngine::getFlangerEnabled() {
+  return settings->flanger.enabled;
+}
+
+void AudioEngine::setFlangerRate(float rateHz) {
+  settings->flanger.rate = constrain(rateHz, FLANGER_RATE_MIN, FLANGER_RATE_MAX);
+  postFlanger();
+}
+
+float AudioEngine::getFlangerRate() {
+  return settings->flanger.rate;
+}
+
+void AudioEngine::setFlangerDelay(float ms) {
+  settings->flanger.delayMs = constrain(ms, FLANGER_DELAY_MIN_MS, FLANGER_DELAY_MAX_MS);
+  postFlanger();
+}
+
+float AudioEngine::getFlangerDelay() {
+  return settings->flanger.delayMs;
+}
+
+void AudioEngine::setFlangerDepth(float ms) {
+  settings->flanger.depthMs = constrain(ms, 0.0f, FLANGER_DEPTH_MAX_MS);
+  postFlanger();
+}
+
+float AudioEngine::getFlangerDepth() {
+  return settings->flanger.depthMs;
+}
+
+void AudioEngine::setFlangerFeedback(int8_t percent) {
+  settings->flanger.feedback = constrain(percent, -FLANGER_FEEDBACK_MAX, FLANGER_FEEDBACK_MAX);
+  postFlanger();
+}
+
+int8_t AudioEngine::getFlangerFeedback() {
+  return settings->flanger.feedback;
+}
+
+void AudioEngine::setFlangerMix(uint8_t percent) {
+  settings->flanger.mix = constrain(percent, 0, 100);
+  postFlanger();
+}
+
+uint8_t AudioEngine::getFlangerMix() {
+  return settings->flanger.mix;
+}
+
+// ============================================================================
+// SETTINGS: CONVOLVER
+// ============================================================================
+
+// Audio side, at a block start: one swap at a time, so a retired convolver
+// is never overwritten before the control side has freed it
+void AudioEngine::takeConvolver() {
+  if (!convolverPending.load(std::memory_order_relaxed)) return;
+  if (convolverRetired.load(std::memory_order_acquire)) return;
+  
+  Convolver* next = convolverPending.exchange(nullptr, std::memory_order_acq_rel);
+  if (!next) return;
+  if (convolver) next->continueFrom(*convolver);
+  convolverRetired.store(convolver, std::memory_order_release);
+  convolver = next;
+}
+
+void AudioEngine::collectConvolver() {
+  delete convolverRetired.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+// Shutdown only: the audio task is gone
+void AudioEngine::freeConvolvers() {
+  collectConvolver();
+  delete convolverPending.exchange(nullptr, std::memory_order_acq_rel);
+  delete convolver;
+  convolver = nullptr;
+  convolverLoaded = nullptr;
+}
+
+bool AudioEngine::loadImpulseResponse(const int16_t* ir, uint32_t taps, const char* path) {
+  if (!initialized || taps == 0) return false;
+  
+  Convolver* next = new Convolver();
+  if (!next->build(ir, taps, blockSize)) {
+    delete next;
+    Serial.printf("[AUDIO] ✗ Convolver: no memory for %u taps\n", taps);
+    return false;
+  }
+  
+  // Free before and after publishing: the audio side may retire one in
+  // between, and takes the new one only once the slot is empty
+  collectConvolver();
+  delete convolverPending.exchange(next, std::memory_order_acq_rel);   // Never taken
+  collectConvolver();
+  convolverLoaded = next;
+  
+  // At startup the path is the profile's own
+  if (path != settings->convolver.file) {
+    strncpy(settings->convolver.file, path ? path : "", CONV_FILE_MAX - 1);
+    settings->convolver.file[CONV_FILE_MAX - 1] = '\0';
+  }
+  
+  if (next->isDirect()) {
+    Serial.printf("[AUDIO] ✓ Convolver: %u taps, direct FIR (%u bytes)\n",
+                  next->getTaps(), next->getMemory());
+  } else {
+    Serial.printf("[AUDIO] ✓ Convolver: %u taps, %u x %u partitions, %u frames latency (%.1f KB)\n",
+                  next->getTaps(), next->getPartitions(), next->getPartitionSize(),
+                  next->getLatency(), next->getMemory() / 1024.0f);
+  }
+  return true;
+}
+
+const char* AudioEngine::getConvolverFile() {
+  return settings->convolver.file;
+}
+
+void AudioEngine::setConvolverEnabled(bool enabled) {
+  settings->convolver.enabled = enabled;
+  postConvolver();
+}
+
+bool AudioEngine::getConvolverEnabled() {
+  return settings->convolver.enabled;
+}
+
+void AudioEngine::setConvolverMix(uint8_t percent) {
+  settings->convolver.mix = constrain(percent, 0, 100);
+  postConvolver();
+}
+
+uint8_t AudioEngine::getConvolverMix() {
+  return settings->convolver.mix;
+}
+
+// ============================================================================
+// SETTINGS: COMPRESSOR
+// ============================================================================
+
+void AudioEngine::setCompressorEnabled(bool enabled) {
+  settings->compressor.enabled = enabled;
+  postCompressor();
+}
+
+bool AudioEngine::getCompressorEnabled() {
+  return settings->compressor.enabled;
+}
+
+void AudioEngine::setCompressorThreshold(float thresholdDb) {
+  settings->compressor.thresholdDb = constrain(thresholdDb, COMP_THRESHOLD_MIN_DB, COMP_THRESHOLD_MAX_DB);
+  publishCoefficients();
+}
+
+float AudioEngine::getCompressorThreshold() {
+  return settings->compressor.thresholdDb;
+}
+
+void AudioEngine::setCompressorRatio(float ratio) {
+  settings->compressor.ratio = constrain(ratio, COMP_RATIO_MIN, COMP_RATIO_MAX);
+  publishCoefficients();
+}
+
+float AudioEngine::getCompressorRatio() {
+  return settings->compressor.ratio;
+}
+
+void AudioEngine::setCompressorAttack(float ms) {
+  settings->compressor.attackMs = constrain(ms, COMP_ATTACK_MIN_MS, COMP_ATTACK_MAX_MS);
+  publishCoefficients();
+}
+
+float AudioEngine::getCompressorAttack() {
+  return settings->compressor.attackMs;
+}
+
+void AudioEngine::setCompressorRelease(uint16_t ms) {
+  settings->compressor.releaseMs = constrain(ms, COMP_RELEASE_MIN_MS, COMP_RELEASE_MAX_MS);
+  publishCoefficients();
+}
+
+uint16_t AudioEngine::getCompressorRelease() {
+  return settings->compressor.releaseMs;
+}
+
+void AudioEngine::setCompressorMakeup(float makeupDb) {
+  settings->compressor.makeupDb = constrain(makeupDb, 0.0f, COMP_MAKEUP_MAX_DB);
+  publishCoefficients();
+}
+
+float AudioEngine::getCompressorMakeup() {
+  return settings->compressor.makeupDb;
+}
+
+float AudioEngine::getCompressorReduction() {
+  return Compressor::toDb(compressorReduction.load(std::memory_order_relaxed));
+}
+
+// ============================================================================
+// SETTINGS: OUTPUT LIMITER
+// ============================================================================
+
+// Audio side: ceiling and release in the limiter's integer units
+void AudioEngine::configureLimiter() {
+  limiter.setCeiling(PeakLimiter::ceilingLevel(dsp.limiter.ceilingDb));
+  limiter.setRelease(PeakLimiter::releaseCoefficient(dsp.limiter.releaseMs, dsp.sampleRate));
+}
+
+void AudioEngine::setLimiterEnabled(bool enabled) {
+  settings->limiter.enabled = enabled;
+  postLimiter();
+}
+
+bool AudioEngine::getLimiterEnabled() {
+  return settings->limiter.enabled;
+}
+
+void AudioEngine::setLimiterCeiling(float ceilingDb) {
+  settings->limiter.ceilingDb = constrain(ceilingDb, LIMITER_CEILING_MIN_DB, LIMITER_CEILING_MAX_DB);
+  postLimiter();
+}
+
+float AudioEngine::getLimiterCeiling() {
+  return settings->limiter.ceilingDb;
+}
+
+void AudioEngine::setLimiterRelease(uint16_t ms) {
+  settings->limiter.releaseMs = constrain(ms, LIMITER_RELEASE_MIN_MS, LIMITER_RELEASE_MAX_MS);
+  postLimiter();
+}
+
+uint16_t AudioEngine::getLimiterRelease() {
+  return settings->limiter.releaseMs;
+}
+
+float AudioEngine::getLimiterReduction() {
+  int32_t gain = limiterGain.load(std::memory_order_relaxed);
+  return 20.0f * log10f((float)PeakLimiter::UNITY / gain);
+}
+
+float AudioEngine::getLimiterPeakReduction() {
+  int32_t gain = limiterLowest.load(std::memory_order_relaxed);
+  return 20.0f * log10f((float)PeakLimiter::UNITY / gain);
+}
+
+void AudioEngine::resetLimiterMeter() {
+  limiterGain.store(PeakLimiter::UNITY, std::memory_order_relaxed);
+  limiterLowest.store(PeakLimiter::UNITY, std::memory_order_relaxed);
+}
+
 // ============================================================================
 // SETTINGS: WAVEFORM
 // ============================================================================
 
 void AudioEngine::setWaveform(WaveformType waveform) {
   settings->waveform = waveform;
-  for (int i = 0; i < voiceCount; i++) {
-    voices[i].waveform = waveform;
-  }
+  
+  AudioCommand cmd(CMD_WAVEFORM);
+  cmd.a = waveform;
+  postCommand(cmd);
 }
 
 WaveformType AudioEngine::getWaveform() {
   return settings->waveform;
 }
 
+// ============================================================================
+// SETTINGS: ENVELOPE
+// ============================================================================
+
+void AudioEngine::setEnvelope(const EnvelopeConfig& envelope) {
+  EnvelopeConfig& env = settings->envelope;
+  env = envelope;
+  env.attackMs = constrain(env.attackMs, ENV_TIME_MIN_MS, ENV_TIME_MAX_MS);
+  env.decayMs = constrain(env.decayMs, ENV_TIME_MIN_MS, ENV_TIME_MAX_MS);
+  env.releaseMs = constrain(env.releaseMs, ENV_TIME_MIN_MS, ENV_TIME_MAX_MS);
+  
+  AudioCommand cmd(CMD_ENVELOPE);
+  cmd.u16[0] = env.attackMs;
+  cmd.u16[1] = env.decayMs;
+  cmd.u16[2] = env.releaseMs;
+  cmd.a = env.sustain;
+  cmd.b = env.curve;
+  postCommand(cmd);
+}
+
+void AudioEngine::setOscillatorMode(OscillatorMode mode) {
+  // Settings record the mode actually used (wavetable may fall back)
+  settings->oscillator = VoiceBank::availableMode(mode);
+  
+  AudioCommand cmd(CMD_OSCILLATOR);
+  cmd.a = settings->oscillator;
+  postCommand(cmd);
+}
+
+void AudioEngine::setVoiceStealPolicy(VoiceStealPolicy policy) {
+  settings->voiceSteal = policy;
+  
+  AudioCommand cmd(CMD_VOICE_STEAL);
+  cmd.a = policy;
+  postCommand(cmd);
+}
+
+OscillatorMode AudioEngine::getOscillatorMode() {
+  return settings->oscillator;
+}
+
 const char* AudioEngine::getWaveformName() {
   switch(settings->waveform) {
     case WAVE_SINE:     return "Sine";
@@ -1252,9 +2152,5 @@ const char* AudioEngine::getWaveformName() {
 // ============================================================================
 
 uint8_t AudioEngine::getActiveVoices() {
-  uint8_t count = 0;
-  for (int i = 0; i < voiceCount; i++) {
-    if (voices[i].on) count++;
-  }
-  return count;
+  return voiceBank.getActiveCount();
 }
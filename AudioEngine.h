@@ -3,17 +3,12 @@
 #ifndef AUDIO_ENGINE_H
 #define AUDIO_ENGINE_H
 
-#include <Arduino.h>
+#include "AudioPlatform.h"
 #include "AudioSettings.h"
-
-// ESP32 variant detection for I2S
-#if defined(CONFIG_IDF_TARGET_ESP32)
-  #include <driver/i2s.h>
-  #define USE_LEGACY_I2S 1
-#else
-  #include <driver/i2s_std.h>
-  #define USE_LEGACY_I2S 0
-#endif
+#include "AudioEffects.h"
+#include "AudioVoiceBank.h"
+#include "AudioConvolver.h"
+#include "AudioCommandQueue.h"
 
 // ============================================================================
 // MIDI NOTE DEFINITIONS
@@ -51,145 +46,39 @@ struct Note {
   uint8_t velocity;
 };
 
-// ============================================================================
-// FIXED-POINT TYPES
-// ============================================================================
-#if USE_FIXED_POINT_MATH
-  typedef uint32_t fixed_point_t;
-  #define FIXED_SHIFT 16
-  #define FLOAT_TO_FIXED(f) ((fixed_point_t)((f) * 65536.0f))
-  #define FIXED_TO_FLOAT(x) (((float)(x)) / 65536.0f)
-  #define FIXED_MUL(a, b) (((int64_t)(a) * (int64_t)(b)) >> FIXED_SHIFT)
-#endif
-
-// ============================================================================
-// ENVELOPE GENERATOR
-// ============================================================================
-struct Envelope {
-  enum State { ENV_OFF, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE };
-  State state;
-  uint32_t sampleCount;
-  
-  Envelope() : state(ENV_OFF), sampleCount(0) {}
-  
-  inline void on() {
-    state = ENV_ATTACK;
-    sampleCount = 0;
-  }
-  
-  inline void off() {
-    if (state != ENV_OFF) {
-      state = ENV_RELEASE;
-      sampleCount = 0;
-    }
-  }
-  
-  inline bool isActive() const {
-    return state != ENV_OFF;
-  }
-  
-  inline uint8_t get() {
-    if (state == ENV_OFF) return 0;
-    
-    sampleCount++;
-    
-    switch(state) {
-      case ENV_ATTACK:
-        if (sampleCount >= ENV_ATTACK_SAMPLES) {
-          state = ENV_DECAY;
-          sampleCount = 0;
-          return 255;
-        }
-        return (uint8_t)((sampleCount * 255) / ENV_ATTACK_SAMPLES);
-        
-      case ENV_DECAY:
-        if (sampleCount >= ENV_DECAY_SAMPLES) {
-          state = ENV_SUSTAIN;
-          return ENV_SUSTAIN_LEVEL;
-        }
-        return (uint8_t)(255 - ((sampleCount * (255 - ENV_SUSTAIN_LEVEL)) / ENV_DECAY_SAMPLES));
-        
-      case ENV_SUSTAIN:
-        return ENV_SUSTAIN_LEVEL;
-        
-      case ENV_RELEASE:
-        if (sampleCount >= ENV_RELEASE_SAMPLES) {
-          state = ENV_OFF;
-          return 0;
-        }
-        return (uint8_t)(ENV_SUSTAIN_LEVEL - ((sampleCount * ENV_SUSTAIN_LEVEL) / ENV_RELEASE_SAMPLES));
-        
-      default:
-        return 0;
-    }
-  }
-};
-
 // ============================================================================
 // LFO OSCILLATOR (NEW!)
 // ============================================================================
 struct LFO {
-  float phase;
-  float phaseInc;
+  uint32_t phase;         // One cycle = 2^32
+  uint32_t phaseInc;      // Per sample
   
-  LFO() : phase(0.0f), phaseInc(0.0f) {}
+  LFO() : phase(0), phaseInc(0) {}
   
   void setRate(float rateHz, float sampleRate) {
-    phaseInc = rateHz / sampleRate;
+    phaseInc = (uint32_t)(rateHz / sampleRate * 4294967296.0f);
   }
   
   void reset() {
-    phase = 0.0f;
+    phase = 0;
   }
   
-  // Get sine wave output (-1.0 to +1.0)
-  inline float getSine() {
-    float output = sinf(phase * 2.0f * PI);
-    phase += phaseInc;
-    if (phase >= 1.0f) phase -= 1.0f;
+  // Sine output (Q15, -32767..32767), then advance by 'samples'
+  inline int32_t getSine(uint32_t samples = 1) {
+    int32_t output = sineFromPhase(phase);
+    phase += phaseInc * samples;
     return output;
   }
   
-  // Get triangle wave output (-1.0 to +1.0)
-  inline float getTriangle() {
-    float output;
-    if (phase < 0.5f) {
-      output = (phase * 4.0f) - 1.0f;
-    } else {
-      output = 3.0f - (phase * 4.0f);
-    }
-    phase += phaseInc;
-    if (phase >= 1.0f) phase -= 1.0f;
+  // Triangle output (Q15, -32768..32767), then advance by 'samples'
+  inline int32_t getTriangle(uint32_t samples = 1) {
+    uint32_t folded = phase ^ (0 - (phase >> 31));
+    int32_t output = (int32_t)((folded << 1) >> 16) - 32768;
+    phase += phaseInc * samples;
     return output;
   }
 };
 
-// ============================================================================
-// VOICE STRUCTURE
-// ============================================================================
-struct Voice {
-  bool on;
-  uint8_t note;
-  uint8_t vel;
-  WaveformType waveform;
-  
-  #if USE_FIXED_POINT_MATH
-    fixed_point_t phase;
-    fixed_point_t phaseInc;
-  #else
-    float phase;
-    float phaseInc;
-  #endif
-  
-  Envelope env;
-  
-  Voice() : on(false), note(0), vel(127), waveform(WAVE_SINE), phase(0), phaseInc(0) {}
-  
-  void noteOn(uint8_t n, uint8_t v, uint32_t sampleRate);
-  void noteOff();
-  int16_t getSample(float lfoVibrato = 0.0f, float lfoTremolo = 1.0f);
-};
-
 // ============================================================================
 // MELODY PLAYER
 // ============================================================================
@@ -222,249 +111,220 @@ public:
   bool isPlaying() const { return playing; }
 };
 
+// ============================================================================
+// DSP LOAD STATISTICS
+// ============================================================================
+// Measured with the cycle counter around the render pipeline only; the
+// blocking I2S write is excluded. Loads are a percentage of the real-time
+// budget of one block (frames / sampleRate).
+struct DSPLoadStats {
+  float current;          // Last block
+  float average;          // Mean over the last CPU_MONITOR_INTERVAL
+  float peak;             // Highest single block since reset
+  uint32_t lastBlockUs;   // Render time of the last block
+  uint32_t worstBlockUs;  // Longest block render time since reset
+  uint32_t deadlineUs;    // Budget of one full engine block
+  int32_t headroomUs;     // Smallest per-block slack to its deadline
+  uint32_t blocks;        // Blocks measured since reset
+  float convolver;        // Convolver share of the budget, same window as average
+  uint32_t convolverCyclesPerFrame;
+  
+  DSPLoadStats() { reset(); }
+  
+  void reset() {
+    current = 0.0f;
+    average = 0.0f;
+    peak = 0.0f;
+    lastBlockUs = 0;
+    worstBlockUs = 0;
+    deadlineUs = 0;
+    headroomUs = 0;
+    blocks = 0;
+    convolver = 0.0f;
+    convolverCyclesPerFrame = 0;
+  }
+};
+
+// ============================================================================
+// XRUN STATISTICS (I2S output path)
+// ============================================================================
+enum XrunType : uint8_t {
+  XRUN_LATE_BLOCK = 0,    // Render gap between writes exceeded one block period
+  XRUN_DMA_UNDERRUN,      // Driver reported DMA starvation
+  XRUN_SHORT_WRITE        // I2S write accepted fewer bytes than requested
+};
+
+struct XrunEvent {
+  uint32_t timeMs;        // millis() when detected
+  XrunType type;
+  uint32_t detailUs;      // Late blocks: render gap, otherwise 0
+};
+
+struct XrunStats {
+  uint32_t total;
+  uint32_t lateBlocks;
+  uint32_t underruns;
+  uint32_t shortWrites;
+  XrunEvent events[XRUN_LOG_SIZE];  // Ring buffer, newest at eventHead - 1
+  uint8_t eventHead;
+  uint8_t eventCount;
+  
+  XrunStats() { reset(); }
+  
+  void reset() {
+    total = 0;
+    lateBlocks = 0;
+    underruns = 0;
+    shortWrites = 0;
+    eventHead = 0;
+    eventCount = 0;
+  }
+  
+  // i = 0 is the most recent event
+  const XrunEvent& getEvent(uint8_t i) const {
+    return events[(eventHead + XRUN_LOG_SIZE - 1 - i) % XRUN_LOG_SIZE];
+  }
+};
+
+// ============================================================================
+// CONTROL COMMAND STATISTICS
+// ============================================================================
+struct CommandStats {
+  uint32_t applied;           // Commands applied by the audio task
+  uint32_t maxLatencyFrames;  // Longest post-to-apply delay
+  
+  CommandStats() { reset(); }
+  
+  void reset() {
+    applied = 0;
+    maxLatencyFrames = 0;
+  }
+};
+
 // ============================================================================
 // MAIN AUDIO ENGINE CLASS
 // ============================================================================
 class AudioEngine {
 private:
-  AudioSettings* settings;
-  Voice voices[8];
+  AudioSettings* settings;        // Control side: written by setters, read by getters
+  AudioSettings dsp;              // Render side: written only by applyCommand()
+  VoiceBank voiceBank;
   uint8_t voiceCount;
   
   MelodyPlayer melodyPlayer;
   
+  // Control -> audio task events, drained at every block boundary
+  AudioCommandQueue commands;
+  std::atomic<uint32_t> sampleClock;  // Frames rendered since init
+  CommandStats commandStats;
+  
+  bool postCommand(AudioCommand& cmd);
+  void drainCommands();
+  void applyCommand(const AudioCommand& cmd);
+  bool postEQ();
+  bool postFilter();
+  bool postReverb();
+  bool postLFO();
+  bool postDelay();
+  bool postChorus();
+  bool postFlanger();
+  bool postConvolver();
+  bool postCompressor();
+  bool postLimiter();
+  
   // LFO Oscillator (NEW!)
   LFO lfo;
   
-  // Delay buffer
-  int16_t* delayBuffer;
-  uint32_t delayBufferSize;
-  uint32_t delayWritePos;
-  
-  // Biquad EQ Filters
-  struct BiquadFilter {
-    float b0, b1, b2;
-    float a1, a2;
-    float x1[2], x2[2];
-    float y1[2], y2[2];
-    
-    BiquadFilter() : b0(1), b1(0), b2(0), a1(0), a2(0) {
-      for(int i=0; i<2; i++) {
-        x1[i] = x2[i] = y1[i] = y2[i] = 0;
-      }
-    }
-    
-    inline float process(float input, int channel) {
-      float output = b0 * input + b1 * x1[channel] + b2 * x2[channel]
-                                - a1 * y1[channel] - a2 * y2[channel];
-      x2[channel] = x1[channel];
-      x1[channel] = input;
-      y2[channel] = y1[channel];
-      y1[channel] = output;
-      return output;
-    }
-    
-    void reset() {
-      for(int i=0; i<2; i++) {
-        x1[i] = x2[i] = y1[i] = y2[i] = 0;
-      }
-    }
-  };
-  
-  BiquadFilter eqBass;
-  BiquadFilter eqMid;
-  BiquadFilter eqTreble;
-  
-  // State-Variable Filter
-  struct StateVariableFilter {
-    float lowpass[2];
-    float bandpass[2];
-    float highpass[2];
-    float f;
-    float q;
-    
-    StateVariableFilter() : f(0.1f), q(1.0f) {
-      for(int i=0; i<2; i++) {
-        lowpass[i] = bandpass[i] = highpass[i] = 0.0f;
-      }
-    }
-    
-    inline void process(float input, int channel, float& lp, float& bp, float& hp) {
-      lowpass[channel] += f * bandpass[channel];
-      highpass[channel] = input - lowpass[channel] - q * bandpass[channel];
-      bandpass[channel] += f * highpass[channel];
-      
-      lp = lowpass[channel];
-      bp = bandpass[channel];
-      hp = highpass[channel];
-    }
-    
-    void updateCoefficients(float cutoffHz, float resonance, float sampleRate) {
-      f = 2.0f * sinf(PI * cutoffHz / sampleRate);
-      q = 1.0f - resonance;
-      if (f > 1.99f) f = 1.99f;
-      if (q < 0.01f) q = 0.01f;
-    }
-    
-    void reset() {
-      for(int i=0; i<2; i++) {
-        lowpass[i] = bandpass[i] = highpass[i] = 0.0f;
-      }
-    }
-  };
-  
-  StateVariableFilter svf;
-  
-  // Schroeder Reverb Structure
-  struct SchroederReverb {
-    struct CombFilter {
-      float* buffer;
-      uint32_t bufferSize;
-      uint32_t readPos;
-      float feedback;
-      float filterStore;
-      
-      CombFilter() : buffer(nullptr), bufferSize(0), readPos(0), 
-                     feedback(0.5f), filterStore(0.0f) {}
-      
-      float process(float input, float damping) {
-        float output = buffer[readPos];
-        filterStore = (output * (1.0f - damping)) + (filterStore * damping);
-        buffer[readPos] = input + (filterStore * feedback);
-        readPos++;
-        if (readPos >= bufferSize) readPos = 0;
-        return output;
-      }
-      
-      void reset() {
-        if (buffer) {
-          memset(buffer, 0, bufferSize * sizeof(float));
-        }
-        readPos = 0;
-        filterStore = 0.0f;
-      }
-    };
-    
-    struct AllpassFilter {
-      float* buffer;
-      uint32_t bufferSize;
-      uint32_t readPos;
-      
-      AllpassFilter() : buffer(nullptr), bufferSize(0), readPos(0) {}
-      
-      float process(float input) {
-        float bufferOut = buffer[readPos];
-        float output = -input + bufferOut;
-        buffer[readPos] = input + (bufferOut * 0.5f);
-        readPos++;
-        if (readPos >= bufferSize) readPos = 0;
-        return output;
-      }
-      
-      void reset() {
-        if (buffer) {
-          memset(buffer, 0, bufferSize * sizeof(float));
-        }
-        readPos = 0;
-      }
-    };
-    
-    CombFilter comb[4];
-    AllpassFilter allpass[2];
-    float* reverbBuffer;
-    bool initialized;
-    
-    SchroederReverb() : reverbBuffer(nullptr), initialized(false) {}
-    
-    bool init() {
-      reverbBuffer = (float*)malloc(REVERB_BUFFER_SIZE * sizeof(float));
-      if (!reverbBuffer) return false;
-      
-      memset(reverbBuffer, 0, REVERB_BUFFER_SIZE * sizeof(float));
-      
-      uint32_t offset = 0;
-      comb[0].buffer = reverbBuffer + offset;
-      comb[0].bufferSize = REVERB_COMB1_DELAY;
-      offset += REVERB_COMB1_DELAY;
-      
-      comb[1].buffer = reverbBuffer + offset;
-      comb[1].bufferSize = REVERB_COMB2_DELAY;
-      offset += REVERB_COMB2_DELAY;
-      
-      comb[2].buffer = reverbBuffer + offset;
-      comb[2].bufferSize = REVERB_COMB3_DELAY;
-      offset += REVERB_COMB3_DELAY;
-      
-      comb[3].buffer = reverbBuffer + offset;
-      comb[3].bufferSize = REVERB_COMB4_DELAY;
-      offset += REVERB_COMB4_DELAY;
-      
-      allpass[0].buffer = reverbBuffer + offset;
-      allpass[0].bufferSize = REVERB_ALLPASS1_DELAY;
-      offset += REVERB_ALLPASS1_DELAY;
-      
-      allpass[1].buffer = reverbBuffer + offset;
-      allpass[1].bufferSize = REVERB_ALLPASS2_DELAY;
-      
-      initialized = true;
-      return true;
-    }
-    
-    void deinit() {
-      if (reverbBuffer) {
-        free(reverbBuffer);
-        reverbBuffer = nullptr;
-      }
-      initialized = false;
-    }
-    
-    void updateParameters(float roomSize, float damping) {
-      float feedback = 0.5f + (roomSize * 0.45f);
-      for (int i = 0; i < 4; i++) {
-        comb[i].feedback = feedback;
-      }
-    }
-    
-    float process(float input, float damping) {
-      float combOut = 0.0f;
-      for (int i = 0; i < 4; i++) {
-        combOut += comb[i].process(input, damping);
-      }
-      combOut *= 0.25f;
-      
-      float output = allpass[0].process(combOut);
-      output = allpass[1].process(output);
-      
-      return output;
-    }
-    
-    void reset() {
-      for (int i = 0; i < 4; i++) {
-        comb[i].reset();
-      }
-      for (int i = 0; i < 2; i++) {
-        allpass[i].reset();
-      }
-    }
-  };
-  
-  SchroederReverb reverb;
-  
-  // I2S handles
-  #if USE_LEGACY_I2S
-    // ESP32 Classic
-  #else
-    i2s_chan_handle_t tx_handle;
-  #endif
+  // Block render scratch buffers (sized to i2sBufferSize)
+  int32_t* mixBuffer;
+  float* fxBuffer;
+  int32_t* lfoVibratoBuffer;      // Q15 pitch offset per LFO_CONTROL_FRAMES segment
+  int32_t* lfoTremoloBuffer;      // Q15 gain per sample (ramped between segments)
+  int32_t lfoTremoloGain;         // Gain at the end of the previous block
+  uint32_t blockSize;
+  
+  // PWM block playback position
+  uint32_t pwmBlockPos;
+  bool pwmBlockActive;
+  int32_t pwmGain;                // pwm.gain / 255 in Q15, taken per block
+  
+  // Echo: one line fed with the channel sum (audio side)
+  DelayLine delayLine;
+  LFO delayMod;                   // Tape wow on the read position
+  float delayTime;                // Samples, gliding towards delayTarget
+  float delayTarget;
+  float delayModDepth;            // Samples
+  float delayGlideRate;           // Share of the remaining glide per frame
+  uint32_t delayRead;             // DELAY_FRAC_BITS samples, end of the last block
+  
+  // Tap tempo (control side)
+  uint32_t tapLastMs;
+  uint16_t tapIntervals[DELAY_TAP_COUNT];
+  uint8_t tapCount;
+  
+  // Chorus and flanger: modulated delay cores (audio side)
+  ModulatedDelay chorus;          // Channel sum in, one tap per voice
+  int32_t chorusPanLeft[MOD_DELAY_MAX_TAPS];   // Q12 per voice
+  int32_t chorusPanRight[MOD_DELAY_MAX_TAPS];
+  ModulatedDelay flanger[2];      // One line per side
+  
+  // Biquad EQ: fixed-point cascade on the int32 bus, ramps its own coefficients
+  BiquadCascade eqCascade;
+  
+  // State-variable filter on the bus (one per channel) and its coefficients
+  // while the cutoff holds still; per-voice filters live in the voice bank
+  StateVariableFilter svf[2];
+  SvfCoefficients svfCoef;
+  
+  // FDN reverb
+  FdnReverb reverb;
+  
+  // Convolver, built on the control side and handed over by pointer: the
+  // audio side takes convolverPending at a block start and parks the one it
+  // replaced in convolverRetired for the control side to free
+  Convolver* convolver;                       // Audio side
+  Convolver* convolverLoaded;                 // Control side: newest built
+  std::atomic<Convolver*> convolverPending;
+  std::atomic<Convolver*> convolverRetired;
+  uint32_t convolverCycles;                   // Since the last recordLoad()
+  uint64_t loadWindowConvolverCycles;
+  
+  void takeConvolver();
+  void collectConvolver();
+  void freeConvolvers();
+  
+  // Compressor (before the limiter) and its gain reduction meter, log2 Q10
+  Compressor compressor;
+  std::atomic<int32_t> compressorReduction;   // Largest in the last block
+  
+  // Output limiter (last stage) and its gain reduction meter, Q16 gain
+  PeakLimiter limiter;
+  std::atomic<int32_t> limiterGain;     // Lowest gain in the last block
+  std::atomic<int32_t> limiterLowest;   // Lowest gain since resetLimiterMeter()
+  
+  // EQ/filter/reverb/compressor coefficients in flight from the control side
+  SnapshotBuffer<EffectCoefficients> coefficients;
+  
+  // Smoothed parameters (audio side): ramp to the latest command or
+  // snapshot over PARAM_SMOOTH_MS instead of stepping
+  SmoothedParam volumeLevel;      // 0-255
+  SmoothedParam reverbWet;
+  SmoothedParam filterPitch;      // SVF_PITCH_BITS
+  SmoothedParam filterDamping;    // Q30
   
-  TaskHandle_t audioTaskHandle;
   bool initialized;
+  bool outputAttached;
   bool pwmActive;
   
   // Performance monitoring
-  uint32_t lastCPUCheck;
-  uint32_t audioTaskCount;
-  float cpuUsage;
+  DSPLoadStats load;
+  uint64_t loadWindowCycles;
+  uint32_t loadWindowFrames;
+  
+  void recordLoad(uint32_t cycles, uint32_t frames);
+  
+  XrunStats xruns;
+  void recordXrun(XrunType type, uint32_t detailUs);
   
   // Internal methods
   void initI2S();
@@ -473,28 +333,58 @@ private:
   void deinitPWM();
   bool allocateDelayBuffer();
   void freeDelayBuffer();
+  bool allocateChorusBuffer();
+  bool allocateFlangerBuffers();
+  void freeModulationBuffers();
+  bool allocateRenderBuffers();
+  void freeRenderBuffers();
   
   // Audio task (I2S mode)
   static void audioTask(void* parameter);
   
-  // Voice management
-  int findFreeVoice();
+  // Block render stages (one call per block, flags read once)
+  bool renderMix(uint32_t frames);
+  void renderLFOBlock(uint32_t frames, bool& vibrato, bool& tremolo);
+  bool renderVoicesBlock(uint32_t frames);
+  SvfControl advanceFilter(uint32_t frames);
+  void processFilterBlock(int32_t* buf, uint32_t frames);
+  void processReverbBlock(int32_t* buf, uint32_t frames);
+  void processDelayBlock(int32_t* buf, uint32_t frames);
+  void processChorusBlock(int32_t* buf, uint32_t frames);
+  void processFlangerBlock(int32_t* buf, uint32_t frames);
+  
+  // Coefficient snapshot: computed from settings (control side), applied at
+  // the start of a block without touching filter state (audio side)
+  void publishCoefficients();
+  void applyCoefficients(const EffectCoefficients& c);
+  void resetSmoothing();
+  void updateLFORate();
+  void configureLimiter();
+  void configureDelay(bool restart);
+  void configureChorus(bool restart);
+  void configureFlanger(bool restart);
   
 public:
   AudioEngine();
   ~AudioEngine();
   
-  // Initialization
-  bool init(AudioSettings* settings);
+  // Initialization (attachOutput=false renders offline, no I2S/PWM)
+  bool init(AudioSettings* settings, bool attachOutput = true);
   void deinit();
   
-  // Update (call in loop for PWM mode)
+  // Update (call in loop: melody timing, and PWM output)
   void update();
   
-  // Playback control
-  void noteOn(uint8_t note, uint8_t velocity = 127);
-  void noteOff(uint8_t note);
-  void allNotesOff();
+  // Render interleaved stereo frames through the full effect chain
+  void renderBlock(int16_t* out, uint32_t frames);
+  
+  // Playback control. These and all setters below only post a command;
+  // call them from one task (the loop) - the queue has a single producer.
+  // Without a pan (MIDI 0-127, 64 = center) the note is placed by panSpread
+  bool noteOn(uint8_t note, uint8_t velocity = 127);
+  bool noteOn(uint8_t note, uint8_t velocity, uint8_t pan);
+  bool noteOff(uint8_t note);
+  bool allNotesOff();
   
   void playMelody(const Note* melody, size_t length);
   void stopMelody();
@@ -504,11 +394,19 @@ public:
   void setVolume(uint8_t volume);
   uint8_t getVolume();
   
+  // Keyboard pan width 0-100% (applies to notes started afterwards)
+  void setPanSpread(uint8_t spread);
+  uint8_t getPanSpread();
+  
+  // Bass/mid/treble are the gains of bands 0-2, whatever their type
   void setEQ(int8_t bass, int8_t mid, int8_t treble);
   void getEQ(int8_t& bass, int8_t& mid, int8_t& treble);
+  
+  // One cascade section; freq, gain and q are clamped to the EQ limits
+  bool setEQBand(uint8_t band, BiquadType type, float freq, float gainDb, float q);
+  const EQBand* getEQBand(uint8_t band);
   void setEQEnabled(bool enabled);
   bool getEQEnabled();
-  void updateEQFilters();
   
   // Filter control
   void setFilterEnabled(bool enabled);
@@ -520,7 +418,10 @@ public:
   float getFilterCutoff();
   void setFilterResonance(float resonance);
   float getFilterResonance();
-  void updateFilterCoefficients();
+  void setFilterPerVoice(bool perVoice);
+  bool getFilterPerVoice();
+  void setFilterEnvDepth(float octaves);
+  float getFilterEnvDepth();
   
   // Reverb control
   void setReverbEnabled(bool enabled);
@@ -531,7 +432,6 @@ public:
   float getReverbDamping();
   void setReverbWet(float wet);
   float getReverbWet();
-  void updateReverbParameters();
   
   // LFO control (NEW!)
   void setLFOEnabled(bool enabled);
@@ -544,7 +444,6 @@ public:
   float getLFORate();
   void setLFODepth(float depthPercent);
   float getLFODepth();
-  void updateLFORate();
   
   // Delay control
   void setDelayEnabled(bool enabled);
@@ -555,12 +454,102 @@ public:
   uint8_t getDelayFeedback();
   void setDelayMix(uint8_t percent);
   uint8_t getDelayMix();
+  // Tape-style modulation of the echo time; depth 0 turns it off
+  void setDelayModulation(float rateHz, float depthMs);
+  float getDelayModRate();
+  float getDelayModDepth();
+  // Tap tempo: sets the time from the mean of the recent tap intervals.
+  // Returns the new time in ms, or 0 while waiting for a second tap.
+  uint16_t tapDelay();
+  
+  // Chorus: 2-3 voices swept around the delay by a triangle LFO, spread
+  // across the stereo field
+  void setChorusEnabled(bool enabled);
+  bool getChorusEnabled();
+  void setChorusVoices(uint8_t voices);
+  uint8_t getChorusVoices();
+  void setChorusRate(float rateHz);
+  float getChorusRate();
+  void setChorusDelay(float ms);
+  float getChorusDelay();
+  void setChorusDepth(float ms);
+  float getChorusDepth();
+  void setChorusMix(uint8_t percent);
+  uint8_t getChorusMix();
+  
+  // Flanger: short swept delay with feedback (negative inverts it), one
+  // line per side with the right sweep a quarter cycle ahead
+  void setFlangerEnabled(bool enabled);
+  bool getFlangerEnabled();
+  void setFlangerRate(float rateHz);
+  float getFlangerRate();
+  void setFlangerDelay(float ms);
+  float getFlangerDelay();
+  void setFlangerDepth(float ms);
+  float getFlangerDepth();
+  void setFlangerFeedback(int8_t percent);
+  int8_t getFlangerFeedback();
+  void setFlangerMix(uint8_t percent);
+  uint8_t getFlangerMix();
+  
+  // Convolver: the impulse response after the EQ, mix = wet share 0-100%.
+  // The IR (Q15 at the engine rate) is built here on the control side and
+  // swapped in at the next block; path is only recorded for the profile.
+  // FFT-sized IRs delay the whole signal by one partition while enabled.
+  bool loadImpulseResponse(const int16_t* ir, uint32_t taps, const char* path);
+  const Convolver* getConvolver() { return convolverLoaded; }   // nullptr: none loaded
+  const char* getConvolverFile();
+  void setConvolverEnabled(bool enabled);
+  bool getConvolverEnabled();
+  void setConvolverMix(uint8_t percent);
+  uint8_t getConvolverMix();
+  
+  // Compressor: feed-forward, stereo-linked, ahead of the limiter.
+  // Reduction is reported in dB, 0 = untouched.
+  void setCompressorEnabled(bool enabled);
+  bool getCompressorEnabled();
+  void setCompressorThreshold(float thresholdDb);
+  float getCompressorThreshold();
+  void setCompressorRatio(float ratio);
+  float getCompressorRatio();
+  void setCompressorAttack(float ms);
+  float getCompressorAttack();
+  void setCompressorRelease(uint16_t ms);
+  uint16_t getCompressorRelease();
+  void setCompressorMakeup(float makeupDb);
+  float getCompressorMakeup();
+  float getCompressorReduction();
+  
+  // Output limiter (ceiling in dBFS). Gain reduction is reported in dB,
+  // 0 = untouched.
+  void setLimiterEnabled(bool enabled);
+  bool getLimiterEnabled();
+  void setLimiterCeiling(float ceilingDb);
+  float getLimiterCeiling();
+  void setLimiterRelease(uint16_t ms);
+  uint16_t getLimiterRelease();
+  float getLimiterReduction();
+  float getLimiterPeakReduction();
+  void resetLimiterMeter();
   
   // Waveform control
   void setWaveform(WaveformType waveform);
   WaveformType getWaveform();
   const char* getWaveformName();
   
+  // Envelope (ADSR shared by all voices)
+  void setEnvelope(const EnvelopeConfig& envelope);
+  const EnvelopeConfig& getEnvelope() { return settings->envelope; }
+  
+  // Oscillator mode (naive / wavetable / polyblep)
+  void setOscillatorMode(OscillatorMode mode);
+  OscillatorMode getOscillatorMode();
+  
+  // Voice allocation when all voices are busy
+  void setVoiceStealPolicy(VoiceStealPolicy policy);
+  VoiceStealPolicy getVoiceStealPolicy() { return settings->voiceSteal; }
+  uint32_t getVoiceStealCount() { return voiceBank.getStealCount(); }
+  
   // Status
   uint8_t getActiveVoices();
   uint8_t getVoiceCount() { return voiceCount; }
@@ -569,8 +558,15 @@ public:
   AudioSettings* getSettings() { return settings; }
   
   // Performance monitoring
-  float getCPUUsage() { return cpuUsage; }
-  uint32_t getFreeHeap() { return ESP.getFreeHeap(); }
+  float getCPUUsage() { return load.average; }
+  const DSPLoadStats& getDSPLoad() { return load; }
+  void resetDSPLoad();
+  const XrunStats& getXrunStats() { return xruns; }
+  const CommandStats& getCommandStats() { return commandStats; }
+  uint32_t getDroppedCommands() { return commands.getDropped(); }
+  void resetXrunStats() { xruns.reset(); }
+  static const char* getXrunTypeName(XrunType type);
+  uint32_t getFreeHeap() { return platformFreeHeap(); }
   
   // Wavetable initialization
   static void initWavetable();
@@ -579,11 +575,4 @@ public:
   MelodyPlayer* getMelodyPlayer() { return &melodyPlayer; }
 };
 
-// ============================================================================
-// GLOBAL WAVETABLE
-// ============================================================================
-#if USE_WAVETABLE_LOOKUP
-  extern int16_t sineTable[WAVETABLE_SIZE];
-#endif
-
 #endif // AUDIO_ENGINE_H
@@ -0,0 +1,62 @@
+// AudioPlatform.h - ESP32 Audio OS v2.0
+// Platform Abstraction Layer (Serial, Time, Heap, Cycles, I2S, LEDC, Audio Task)
+//
+// The DSP core (AudioEngine, VoiceBank, AudioResampler, effects) only talks to
+// the hardware through this header. On target it pulls in the Arduino core;
+// with AUDIO_PLATFORM_HOST defined it uses the Linux backend in host/, which
+// provides the same Serial/millis/micros API plus an offline render path.
+
+#ifndef AUDIO_PLATFORM_H
+#define AUDIO_PLATFORM_H
+
+#if defined(AUDIO_PLATFORM_HOST)
+  #include "HostArduino.h"
+#else
+  #include <Arduino.h>
+#endif
+
+// ============================================================================
+// HEAP
+// ============================================================================
+uint32_t platformFreeHeap();
+
+// ============================================================================
+// CYCLE COUNTER (profiling)
+// ============================================================================
+// Free-running 32-bit counter; differences are valid across one wrap.
+uint32_t platformCycleCount();
+uint32_t platformCycleFrequency();
+
+// ============================================================================
+// I2S OUTPUT (16-bit interleaved stereo)
+// ============================================================================
+bool platformI2SBegin(uint32_t sampleRate, uint8_t pin,
+                      uint32_t numBuffers, uint32_t bufferFrames);
+void platformI2SEnd();
+
+// Blocks until the DMA queue accepted the data, returns bytes written
+size_t platformI2SWrite(const int16_t* frames, size_t bytes);
+
+// Cumulative DMA starvation events reported by the driver (the DMA ran out
+// of fresh buffers and replayed cleared ones). 0 where not supported.
+uint32_t platformI2SUnderruns();
+
+// ============================================================================
+// LEDC PWM OUTPUT
+// ============================================================================
+void platformPWMAttach(uint8_t pin, uint32_t frequency, uint8_t resolution);
+void platformPWMWrite(uint8_t pin, uint32_t duty);
+
+// Detaches LEDC and drives the pin low (silence, no idle hiss)
+void platformPWMDetach(uint8_t pin);
+
+// ============================================================================
+// AUDIO TASK
+// ============================================================================
+// Starts the real-time render task. Returns false if the platform cannot run
+// it; the host backend never starts a task and is driven by renderBlock().
+bool platformStartAudioTask(void (*task)(void*), void* arg, uint8_t core);
+void platformStopAudioTask();
+bool platformHasAudioTask();
+
+#endif // AUDIO_PLATFORM_H
@@ -0,0 +1,248 @@
+// AudioPlatform_ESP32.cpp - ESP32 Audio OS v2.0
+// ESP32 backend for the platform abstraction layer (Arduino core + ESP-IDF)
+
+#if !defined(AUDIO_PLATFORM_HOST)
+
+#include "AudioPlatform.h"
+
+// ESP32 variant detection for I2S
+#if defined(CONFIG_IDF_TARGET_ESP32)
+  #include <driver/i2s.h>
+  #define USE_LEGACY_I2S 1
+#else
+  #include <driver/i2s_std.h>
+  #define USE_LEGACY_I2S 0
+#endif
+
+#if USE_LEGACY_I2S
+  static QueueHandle_t i2sEventQueue = nullptr;
+#else
+  static i2s_chan_handle_t tx_handle = nullptr;
+#endif
+static bool i2sInstalled = false;
+static volatile uint32_t i2sUnderruns = 0;
+static TaskHandle_t audioTaskHandle = nullptr;
+
+// ============================================================================
+// HEAP
+// ============================================================================
+
+uint32_t platformFreeHeap() {
+  return ESP.getFreeHeap();
+}
+
+// ============================================================================
+// CYCLE COUNTER
+// ============================================================================
+
+uint32_t platformCycleCount() {
+  return ESP.getCycleCount();
+}
+
+uint32_t platformCycleFrequency() {
+  return ESP.getCpuFreqMHz() * 1000000UL;
+}
+
+// ============================================================================
+// I2S OUTPUT
+// ============================================================================
+
+#if !USE_LEGACY_I2S
+// DMA finished a buffer nobody refilled: the send queue overflowed and the
+// driver is replaying auto-cleared descriptors
+static bool IRAM_ATTR onI2SSendQueueOverflow(i2s_chan_handle_t handle,
+                                             i2s_event_data_t* event, void* ctx) {
+  i2sUnderruns = i2sUnderruns + 1;
+  return false;
+}
+#endif
+
+bool platformI2SBegin(uint32_t sampleRate, uint8_t pin,
+                      uint32_t numBuffers, uint32_t bufferFrames) {
+  #if USE_LEGACY_I2S
+    i2s_config_t i2s_config = {
+      .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX),
+      .sample_rate = sampleRate,
+      .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
+      .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
+      .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+      .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
+      .dma_buf_count = (int)numBuffers,
+      .dma_buf_len = (int)bufferFrames,
+      .use_apll = false,
+      .tx_desc_auto_clear = true,
+      .fixed_mclk = 0
+    };
+    
+    i2s_pin_config_t pin_config = {
+      .bck_io_num = I2S_PIN_NO_CHANGE,
+      .ws_io_num = I2S_PIN_NO_CHANGE,
+      .data_out_num = pin,
+      .data_in_num = I2S_PIN_NO_CHANGE
+    };
+    
+    esp_err_t err = i2s_driver_install(I2S_NUM_0, &i2s_config, I2S_EVENT_QUEUE_SIZE, &i2sEventQueue);
+    if (err != ESP_OK) {
+      Serial.printf("[ERROR] I2S driver install failed: %d\n", err);
+      return false;
+    }
+    
+    err = i2s_set_pin(I2S_NUM_0, &pin_config);
+    if (err != ESP_OK) {
+      Serial.printf("[ERROR] I2S set pin failed: %d\n", err);
+      i2s_driver_uninstall(I2S_NUM_0);
+      return false;
+    }
+    
+  #else
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    chan_cfg.dma_desc_num = numBuffers;
+    chan_cfg.dma_frame_num = bufferFrames;
+    chan_cfg.auto_clear = true;
+    
+    esp_err_t err = i2s_new_channel(&chan_cfg, &tx_handle, NULL);
+    if (err != ESP_OK) {
+      Serial.printf("[ERROR] I2S new channel failed: %d\n", err);
+      return false;
+    }
+    
+    i2s_std_config_t std_cfg = {
+      .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sampleRate),
+      .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
+      .gpio_cfg = {
+        .mclk = I2S_GPIO_UNUSED,
+        .bclk = I2S_GPIO_UNUSED,
+        .ws = I2S_GPIO_UNUSED,
+        .dout = (gpio_num_t)pin,
+        .din = I2S_GPIO_UNUSED,
+        .invert_flags = {
+          .mclk_inv = false,
+          .bclk_inv = false,
+          .ws_inv = false
+        }
+      }
+    };
+    
+    err = i2s_channel_init_std_mode(tx_handle, &std_cfg);
+    if (err != ESP_OK) {
+      Serial.printf("[ERROR] I2S init std mode failed: %d\n", err);
+      i2s_del_channel(tx_handle);
+      tx_handle = nullptr;
+      return false;
+    }
+    
+    i2s_event_callbacks_t callbacks = {};
+    callbacks.on_send_q_ovf = onI2SSendQueueOverflow;
+    err = i2s_channel_register_event_callback(tx_handle, &callbacks, NULL);
+    if (err != ESP_OK) {
+      Serial.printf("[WARN] I2S underrun callback not registered: %d\n", err);
+    }
+    
+    err = i2s_channel_enable(tx_handle);
+    if (err != ESP_OK) {
+      Serial.printf("[ERROR] I2S enable failed: %d\n", err);
+      i2s_del_channel(tx_handle);
+      tx_handle = nullptr;
+      return false;
+    }
+  #endif
+  
+  i2sInstalled = true;
+  return true;
+}
+
+void platformI2SEnd() {
+  if (!i2sInstalled) return;
+  
+  #if USE_LEGACY_I2S
+    i2s_driver_uninstall(I2S_NUM_0);
+    i2sEventQueue = nullptr;
+  #else
+    if (tx_handle) {
+      i2s_channel_disable(tx_handle);
+      i2s_del_channel(tx_handle);
+      tx_handle = nullptr;
+    }
+  #endif
+  
+  i2sInstalled = false;
+}
+
+size_t platformI2SWrite(const int16_t* frames, size_t bytes) {
+  size_t bytesWritten = 0;
+  #if USE_LEGACY_I2S
+    i2s_write(I2S_NUM_0, frames, bytes, &bytesWritten, portMAX_DELAY);
+  #else
+    i2s_channel_write(tx_handle, frames, bytes, &bytesWritten, portMAX_DELAY);
+  #endif
+  return bytesWritten;
+}
+
+uint32_t platformI2SUnderruns() {
+  #if USE_LEGACY_I2S
+    // The legacy driver reports through its event queue; drain it here
+    if (i2sEventQueue) {
+      i2s_event_t event;
+      while (xQueueReceive(i2sEventQueue, &event, 0) == pdTRUE) {
+        if (event.type == I2S_EVENT_TX_Q_OVF || event.type == I2S_EVENT_DMA_ERROR) {
+          i2sUnderruns = i2sUnderruns + 1;
+        }
+      }
+    }
+  #endif
+  return i2sUnderruns;
+}
+
+// ============================================================================
+// LEDC PWM OUTPUT
+// ============================================================================
+
+void platformPWMAttach(uint8_t pin, uint32_t frequency, uint8_t resolution) {
+  ledcAttach(pin, frequency, resolution);
+}
+
+void platformPWMWrite(uint8_t pin, uint32_t duty) {
+  ledcWrite(pin, duty);
+}
+
+void platformPWMDetach(uint8_t pin) {
+  ledcWrite(pin, 0);
+  ledcDetach(pin);
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, LOW);
+}
+
+// ============================================================================
+// AUDIO TASK
+// ============================================================================
+
+bool platformStartAudioTask(void (*task)(void*), void* arg, uint8_t core) {
+  BaseType_t result = xTaskCreatePinnedToCore(
+    task,
+    "AudioTask",
+    8192,
+    arg,
+    configMAX_PRIORITIES - 1,
+    &audioTaskHandle,
+    core
+  );
+  
+  if (result != pdPASS) {
+    audioTaskHandle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void platformStopAudioTask() {
+  if (audioTaskHandle) {
+    vTaskDelete(audioTaskHandle);
+    audioTaskHandle = nullptr;
+  }
+}
+
+bool platformHasAudioTask() {
+  return true;
+}
+
+#endif // !AUDIO_PLATFORM_HOST
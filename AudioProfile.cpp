@@ -158,8 +158,8 @@ void AudioProfile::showProfileInfo(const char* name) {
   Serial.printf("Description:   %s\n", temp.description);
   Serial.printf("Audio Mode:    %s\n", temp.getModeName());
   Serial.printf("Sample Rate:   %d Hz\n", temp.sampleRate);
-  Serial.printf("Voices:        %d\n", temp.voices);
-  Serial.printf("Volume:        %d/255\n", temp.volume);
+  Serial.printf("Voices:        %d (steal: %s)\n", temp.voices, temp.getVoiceStealName());
+  Serial.printf("Volume:        %d/255 (pan spread %u%%)\n", temp.volume, temp.panSpread);
 
   if (temp.mode == AUDIO_MODE_I2S) {
     Serial.printf("\nI2S Settings:\n");
@@ -177,15 +177,20 @@ void AudioProfile::showProfileInfo(const char* name) {
   }
 
   Serial.printf("\nEffects:\n");
-  Serial.printf("  EQ:          %s (Bass %+d, Mid %+d, Treble %+d dB)\n",
-                temp.eq.enabled ? "On" : "Off",
-                temp.eq.bass, temp.eq.mid, temp.eq.treble);
+  Serial.printf("  EQ:          %s\n", temp.eq.enabled ? "On" : "Off");
+  for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+    const EQBand& band = temp.eq.bands[b];
+    if (band.type == BIQUAD_OFF) continue;
+    Serial.printf("    Band %d:     %s %.0fHz %+.1fdB Q:%.2f\n",
+                  b, band.getTypeName(), band.freq, band.gain, band.q);
+  }
                 
-  Serial.printf("  Filter:      %s (%s, %.0fHz, Q:%.2f)\n",
+  Serial.printf("  Filter:      %s (%s, %.0fHz, Q:%.2f, %s)\n",
                 temp.filter.enabled ? "On" : "Off",
                 temp.filter.getTypeName(),
                 temp.filter.cutoff,
-                temp.filter.resonance);
+                temp.filter.resonance,
+                temp.filter.perVoice ? "per voice" : "bus");
                 
   Serial.printf("  Reverb:      %s (Room:%.2f, Damp:%.2f, Wet:%.2f)\n",
                 temp.reverb.enabled ? "On" : "Off",
@@ -198,11 +203,54 @@ void AudioProfile::showProfileInfo(const char* name) {
                 temp.lfo.rate,
                 temp.lfo.depth);
                 
-  Serial.printf("  Delay:       %s (%dms, FB:%d%%, Mix:%d%%)\n",
+  Serial.printf("  Envelope:    A:%ums D:%ums S:%u R:%ums (%s)\n",
+                temp.envelope.attackMs,
+                temp.envelope.decayMs,
+                temp.envelope.sustain,
+                temp.envelope.releaseMs,
+                temp.envelope.getCurveName());
+                
+  Serial.printf("  Delay:       %s (%dms, FB:%d%%, Mix:%d%%, Wow:%.1fms@%.1fHz)\n",
                 temp.delay.enabled ? "On" : "Off",
                 temp.delay.timeMs,
                 temp.delay.feedback,
-                temp.delay.mix);
+                temp.delay.mix,
+                temp.delay.modDepth,
+                temp.delay.modRate);
+                
+  Serial.printf("  Chorus:      %s (%u voices, %.1fms+-%.1fms@%.2fHz, Mix:%u%%)\n",
+                temp.chorus.enabled ? "On" : "Off",
+                temp.chorus.voices,
+                temp.chorus.delayMs,
+                temp.chorus.depthMs,
+                temp.chorus.rate,
+                temp.chorus.mix);
+                
+  Serial.printf("  Flanger:     %s (%.1fms+-%.1fms@%.2fHz, FB:%d%%, Mix:%u%%)\n",
+                temp.flanger.enabled ? "On" : "Off",
+                temp.flanger.delayMs,
+                temp.flanger.depthMs,
+                temp.flanger.rate,
+                temp.flanger.feedback,
+                temp.flanger.mix);
+                
+  Serial.printf("  Convolver:   %s (%s, Mix:%u%%)\n",
+                temp.convolver.enabled ? "On" : "Off",
+                temp.convolver.file[0] ? temp.convolver.file : "no IR",
+                temp.convolver.mix);
+                
+  Serial.printf("  Compressor:  %s (%.1fdB, %.1f:1, A:%.1fms R:%ums, Makeup:%+.1fdB)\n",
+                temp.compressor.enabled ? "On" : "Off",
+                temp.compressor.thresholdDb,
+                temp.compressor.ratio,
+                temp.compressor.attackMs,
+                temp.compressor.releaseMs,
+                temp.compressor.makeupDb);
+                
+  Serial.printf("  Limiter:     %s (Ceiling:%.1fdB, Release:%ums)\n",
+                temp.limiter.enabled ? "On" : "Off",
+                temp.limiter.ceilingDb,
+                temp.limiter.releaseMs);
 
   Serial.printf("\nResampling:    %s\n", temp.getResampleQualityName());
   Serial.println();
@@ -258,6 +306,13 @@ bool AudioProfile::loadFromJSON(const char* path, AudioSettings& settings) {
   settings.sampleRate = doc["audio"]["sampleRate"] | 22050;
   settings.voices = doc["audio"]["voices"] | 4;
   settings.volume = doc["audio"]["volume"] | 200;
+  settings.panSpread = doc["audio"]["panSpread"] | DEFAULT_PAN_SPREAD;
+  
+  const char* oscillator = doc["audio"]["oscillator"] | "wavetable";
+  settings.setOscillator(oscillator);
+  
+  const char* voiceSteal = doc["audio"]["voiceSteal"] | "samenote";
+  settings.setVoiceSteal(voiceSteal);
 
   settings.i2s.pin = doc["hardware"]["i2s"]["pin"] | 1;
   settings.i2s.bufferSize = doc["hardware"]["i2s"]["bufferSize"] | 128;
@@ -272,15 +327,39 @@ bool AudioProfile::loadFromJSON(const char* path, AudioSettings& settings) {
 
   JsonObject eqObj = doc["effects"]["eq"];
   settings.eq.enabled = eqObj["enabled"] | false;
-  settings.eq.bass = eqObj["bass"] | 0;
-  settings.eq.mid = eqObj["mid"] | 0;
-  settings.eq.treble = eqObj["treble"] | 0;
+  JsonArray eqBands = eqObj["bands"];
+  if (!eqBands.isNull()) {
+    // Positions count: missing entries past the end are off
+    for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+      JsonObject bandObj = eqBands[b];
+      EQBand& band = settings.eq.bands[b];
+      band.type = BIQUAD_OFF;
+      band.setType(bandObj["type"] | "off");
+      float freq = bandObj["freq"] | 1000.0f;
+      float gain = bandObj["gain"] | 0.0f;
+      float q = bandObj["q"] | EQ_Q_FACTOR;
+      band.freq = constrain(freq, (float)EQ_MIN_FREQ, settings.sampleRate * 0.45f);
+      band.gain = constrain(gain, (float)-EQ_MAX_GAIN_DB, (float)EQ_MAX_GAIN_DB);
+      band.q = constrain(q, EQ_MIN_Q, EQ_MAX_Q);
+    }
+  } else {
+    // Older profiles: bass/mid/treble gains on the default bands 0-2
+    int bass = eqObj["bass"] | 0;
+    int mid = eqObj["mid"] | 0;
+    int treble = eqObj["treble"] | 0;
+    settings.eq.bands[0].gain = constrain(bass, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+    settings.eq.bands[1].gain = constrain(mid, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+    settings.eq.bands[2].gain = constrain(treble, -EQ_MAX_GAIN_DB, EQ_MAX_GAIN_DB);
+  }
 
   JsonObject filterObj = doc["effects"]["filter"];
   settings.filter.enabled = filterObj["enabled"] | false;
   settings.filter.setType(filterObj["type"] | "lowpass");
   settings.filter.cutoff = filterObj["cutoff"] | 1000.0f;
   settings.filter.resonance = filterObj["resonance"] | 0.1f;
+  settings.filter.perVoice = filterObj["perVoice"] | DEFAULT_FILTER_PER_VOICE;
+  float envDepth = filterObj["envDepth"] | DEFAULT_FILTER_ENV_DEPTH;
+  settings.filter.envDepth = constrain(envDepth, -FILTER_ENV_DEPTH_MAX, FILTER_ENV_DEPTH_MAX);
 
   JsonObject reverbObj = doc["effects"]["reverb"];
   settings.reverb.enabled = reverbObj["enabled"] | false;
@@ -295,11 +374,75 @@ bool AudioProfile::loadFromJSON(const char* path, AudioSettings& settings) {
   settings.lfo.rate = lfoObj["rate"] | 5.0f;
   settings.lfo.depth = lfoObj["depth"] | 20.0f;
 
+  JsonObject envObj = doc["envelope"];
+  settings.envelope.attackMs = envObj["attackMs"] | DEFAULT_ENV_ATTACK_MS;
+  settings.envelope.decayMs = envObj["decayMs"] | DEFAULT_ENV_DECAY_MS;
+  settings.envelope.sustain = envObj["sustain"] | DEFAULT_ENV_SUSTAIN;
+  settings.envelope.releaseMs = envObj["releaseMs"] | DEFAULT_ENV_RELEASE_MS;
+  const char* curve = envObj["curve"] | "linear";
+  settings.envelope.setCurve(curve);
+
   JsonObject delayObj = doc["effects"]["delay"];
   settings.delay.enabled = delayObj["enabled"] | false;
   settings.delay.timeMs = delayObj["timeMs"] | 250;
   settings.delay.feedback = delayObj["feedback"] | 50;
   settings.delay.mix = delayObj["mix"] | 30;
+  float modRate = delayObj["modRate"] | DEFAULT_DELAY_MOD_RATE;
+  float modDepth = delayObj["modDepth"] | DEFAULT_DELAY_MOD_DEPTH;
+  settings.delay.modRate = constrain(modRate, DELAY_MOD_RATE_MIN, DELAY_MOD_RATE_MAX);
+  settings.delay.modDepth = constrain(modDepth, 0.0f, (float)DELAY_MOD_DEPTH_MAX);
+
+  JsonObject chorusObj = doc["effects"]["chorus"];
+  settings.chorus.enabled = chorusObj["enabled"] | DEFAULT_CHORUS_ENABLED;
+  uint8_t chorusVoices = chorusObj["voices"] | DEFAULT_CHORUS_VOICES;
+  float chorusRate = chorusObj["rate"] | DEFAULT_CHORUS_RATE;
+  float chorusDelay = chorusObj["delayMs"] | DEFAULT_CHORUS_DELAY_MS;
+  float chorusDepth = chorusObj["depthMs"] | DEFAULT_CHORUS_DEPTH_MS;
+  uint8_t chorusMix = chorusObj["mix"] | DEFAULT_CHORUS_MIX;
+  settings.chorus.voices = constrain(chorusVoices, CHORUS_VOICES_MIN, CHORUS_VOICES_MAX);
+  settings.chorus.rate = constrain(chorusRate, CHORUS_RATE_MIN, CHORUS_RATE_MAX);
+  settings.chorus.delayMs = constrain(chorusDelay, CHORUS_DELAY_MIN_MS, CHORUS_DELAY_MAX_MS);
+  settings.chorus.depthMs = constrain(chorusDepth, 0.0f, CHORUS_DEPTH_MAX_MS);
+  settings.chorus.mix = constrain(chorusMix, 0, 100);
+  
+  JsonObject flangerObj = doc["effects"]["flanger"];
+  settings.flanger.enabled = flangerObj["enabled"] | DEFAULT_FLANGER_ENABLED;
+  float flangerRate = flangerObj["rate"] | DEFAULT_FLANGER_RATE;
+  float flangerDelay = flangerObj["delayMs"] | DEFAULT_FLANGER_DELAY_MS;
+  float flangerDepth = flangerObj["depthMs"] | DEFAULT_FLANGER_DEPTH_MS;
+  int flangerFeedback = flangerObj["feedback"] | DEFAULT_FLANGER_FEEDBACK;
+  uint8_t flangerMix = flangerObj["mix"] | DEFAULT_FLANGER_MIX;
+  settings.flanger.rate = constrain(flangerRate, FLANGER_RATE_MIN, FLANGER_RATE_MAX);
+  settings.flanger.delayMs = constrain(flangerDelay, FLANGER_DELAY_MIN_MS, FLANGER_DELAY_MAX_MS);
+  settings.flanger.depthMs = constrain(flangerDepth, 0.0f, FLANGER_DEPTH_MAX_MS);
+  settings.flanger.feedback = constrain(flangerFeedback, -FLANGER_FEEDBACK_MAX, FLANGER_FEEDBACK_MAX);
+  settings.flanger.mix = constrain(flangerMix, 0, 100);
+  
+  JsonObject convObj = doc["effects"]["convolver"];
+  settings.convolver.enabled = convObj["enabled"] | DEFAULT_CONV_ENABLED;
+  uint8_t convMix = convObj["mix"] | DEFAULT_CONV_MIX;
+  settings.convolver.mix = constrain(convMix, 0, 100);
+  strncpy(settings.convolver.file, convObj["file"] | "", sizeof(settings.convolver.file) - 1);
+  
+  JsonObject compObj = doc["effects"]["compressor"];
+  settings.compressor.enabled = compObj["enabled"] | DEFAULT_COMP_ENABLED;
+  float compThreshold = compObj["thresholdDb"] | DEFAULT_COMP_THRESHOLD_DB;
+  float compRatio = compObj["ratio"] | DEFAULT_COMP_RATIO;
+  float compAttack = compObj["attackMs"] | DEFAULT_COMP_ATTACK_MS;
+  uint16_t compRelease = compObj["releaseMs"] | DEFAULT_COMP_RELEASE_MS;
+  float compMakeup = compObj["makeupDb"] | DEFAULT_COMP_MAKEUP_DB;
+  settings.compressor.thresholdDb = constrain(compThreshold, COMP_THRESHOLD_MIN_DB, COMP_THRESHOLD_MAX_DB);
+  settings.compressor.ratio = constrain(compRatio, COMP_RATIO_MIN, COMP_RATIO_MAX);
+  settings.compressor.attackMs = constrain(compAttack, COMP_ATTACK_MIN_MS, COMP_ATTACK_MAX_MS);
+  settings.compressor.releaseMs = constrain(compRelease, COMP_RELEASE_MIN_MS, COMP_RELEASE_MAX_MS);
+  settings.compressor.makeupDb = constrain(compMakeup, 0.0f, COMP_MAKEUP_MAX_DB);
+  
+  JsonObject limiterObj = doc["effects"]["limiter"];
+  settings.limiter.enabled = limiterObj["enabled"] | DEFAULT_LIMITER_ENABLED;
+  float ceilingDb = limiterObj["ceilingDb"] | DEFAULT_LIMITER_CEILING_DB;
+  uint16_t releaseMs = limiterObj["releaseMs"] | DEFAULT_LIMITER_RELEASE_MS;
+  settings.limiter.ceilingDb = constrain(ceilingDb, LIMITER_CEILING_MIN_DB, LIMITER_CEILING_MAX_DB);
+  settings.limiter.releaseMs = constrain(releaseMs, LIMITER_RELEASE_MIN_MS, LIMITER_RELEASE_MAX_MS);
 
   const char* resample = doc["resample"]["quality"] | "best";
   settings.setResampleQuality(resample);
@@ -319,6 +462,9 @@ bool AudioProfile::saveToJSON(const char* path, const AudioSettings& settings) {
   doc["audio"]["sampleRate"] = settings.sampleRate;
   doc["audio"]["voices"] = settings.voices;
   doc["audio"]["volume"] = settings.volume;
+  doc["audio"]["panSpread"] = settings.panSpread;
+  doc["audio"]["oscillator"] = settings.getOscillatorName();
+  doc["audio"]["voiceSteal"] = settings.getVoiceStealName();
 
   doc["hardware"]["i2s"]["pin"] = settings.i2s.pin;
   doc["hardware"]["i2s"]["bufferSize"] = settings.i2s.bufferSize;
@@ -333,15 +479,24 @@ bool AudioProfile::saveToJSON(const char* path, const AudioSettings& settings) {
 
   JsonObject eqObj = doc["effects"].createNestedObject("eq");
   eqObj["enabled"] = settings.eq.enabled;
-  eqObj["bass"] = settings.eq.bass;
-  eqObj["mid"] = settings.eq.mid;
-  eqObj["treble"] = settings.eq.treble;
+  JsonArray eqBands = eqObj.createNestedArray("bands");
+  for (uint8_t b = 0; b < EQ_MAX_BANDS; b++) {
+    const EQBand& band = settings.eq.bands[b];
+    JsonObject bandObj = eqBands.createNestedObject();
+    bandObj["type"] = band.getTypeName();
+    if (band.type == BIQUAD_OFF) continue;
+    bandObj["freq"] = band.freq;
+    bandObj["gain"] = band.gain;
+    bandObj["q"] = band.q;
+  }
 
   JsonObject filterObj = doc["effects"].createNestedObject("filter");
   filterObj["enabled"] = settings.filter.enabled;
   filterObj["type"] = settings.filter.getTypeName();
   filterObj["cutoff"] = settings.filter.cutoff;
   filterObj["resonance"] = settings.filter.resonance;
+  filterObj["perVoice"] = settings.filter.perVoice;
+  filterObj["envDepth"] = settings.filter.envDepth;
 
   JsonObject reverbObj = doc["effects"].createNestedObject("reverb");
   reverbObj["enabled"] = settings.reverb.enabled;
@@ -361,6 +516,49 @@ bool AudioProfile::saveToJSON(const char* path, const AudioSettings& settings) {
   delayObj["timeMs"] = settings.delay.timeMs;
   delayObj["feedback"] = settings.delay.feedback;
   delayObj["mix"] = settings.delay.mix;
+  delayObj["modRate"] = settings.delay.modRate;
+  delayObj["modDepth"] = settings.delay.modDepth;
+
+  JsonObject chorusObj = doc["effects"].createNestedObject("chorus");
+  chorusObj["enabled"] = settings.chorus.enabled;
+  chorusObj["voices"] = settings.chorus.voices;
+  chorusObj["rate"] = settings.chorus.rate;
+  chorusObj["delayMs"] = settings.chorus.delayMs;
+  chorusObj["depthMs"] = settings.chorus.depthMs;
+  chorusObj["mix"] = settings.chorus.mix;
+  
+  JsonObject flangerObj = doc["effects"].createNestedObject("flanger");
+  flangerObj["enabled"] = settings.flanger.enabled;
+  flangerObj["rate"] = settings.flanger.rate;
+  flangerObj["delayMs"] = settings.flanger.delayMs;
+  flangerObj["depthMs"] = settings.flanger.depthMs;
+  flangerObj["feedback"] = settings.flanger.feedback;
+  flangerObj["mix"] = settings.flanger.mix;
+  
+  JsonObject convObj = doc["effects"].createNestedObject("convolver");
+  convObj["enabled"] = settings.convolver.enabled;
+  convObj["mix"] = settings.convolver.mix;
+  convObj["file"] = settings.convolver.file;
+  
+  JsonObject compObj = doc["effects"].createNestedObject("compressor");
+  compObj["enabled"] = settings.compressor.enabled;
+  compObj["thresholdDb"] = settings.compressor.thresholdDb;
+  compObj["ratio"] = settings.compressor.ratio;
+  compObj["attackMs"] = settings.compressor.attackMs;
+  compObj["releaseMs"] = settings.compressor.releaseMs;
+  compObj["makeupDb"] = settings.compressor.makeupDb;
+  
+  JsonObject limiterObj = doc["effects"].createNestedObject("limiter");
+  limiterObj["enabled"] = settings.limiter.enabled;
+  limiterObj["ceilingDb"] = settings.limiter.ceilingDb;
+  limiterObj["releaseMs"] = settings.limiter.releaseMs;
+
+  JsonObject envObj = doc.createNestedObject("envelope");
+  envObj["attackMs"] = settings.envelope.attackMs;
+  envObj["decayMs"] = settings.envelope.decayMs;
+  envObj["sustain"] = settings.envelope.sustain;
+  envObj["releaseMs"] = settings.envelope.releaseMs;
+  envObj["curve"] = settings.envelope.getCurveName();
 
   doc["resample"]["quality"] = settings.getResampleQualityName();
 
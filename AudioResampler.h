@@ -7,7 +7,7 @@
 #ifndef AUDIO_RESAMPLER_H
 #define AUDIO_RESAMPLER_H
 
-#include <Arduino.h>
+#include "AudioPlatform.h"
 #include "AudioConfig.h"
 #include "AudioSettings.h"
 
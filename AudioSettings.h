@@ -3,7 +3,7 @@
 #ifndef AUDIO_SETTINGS_H
 #define AUDIO_SETTINGS_H
 
-#include <Arduino.h>
+#include "AudioPlatform.h"
 #include "AudioConfig.h"
 
 // Forward declaration from AudioEngine.h
@@ -22,6 +22,17 @@ enum FilterType {
   FILTER_BANDPASS
 };
 
+// EQ section types (one biquad each)
+enum BiquadType {
+  BIQUAD_OFF,
+  BIQUAD_PEAK,
+  BIQUAD_LOWSHELF,
+  BIQUAD_HIGHSHELF,
+  BIQUAD_NOTCH,
+  BIQUAD_LOWPASS,
+  BIQUAD_HIGHPASS
+};
+
 // ============================================================================
 // ENUMS
 // ============================================================================
@@ -31,6 +42,24 @@ enum AudioMode {
   MODE_PWM
 };
 
+enum OscillatorMode {
+  OSC_NAIVE,          // Direct waveform math (aliases above a few hundred Hz)
+  OSC_WAVETABLE,      // Band-limited mip-mapped tables (flash)
+  OSC_POLYBLEP        // PolyBLEP-corrected square/saw, no tables
+};
+
+enum EnvelopeCurve {
+  ENV_CURVE_LINEAR,       // Constant slope per stage
+  ENV_CURVE_EXPONENTIAL   // RC-style: fast start, slow approach
+};
+
+enum VoiceStealPolicy {
+  STEAL_OLDEST,       // Longest-sounding voice
+  STEAL_QUIETEST,     // Lowest envelope * velocity
+  STEAL_RELEASING,    // Oldest released voice, else oldest
+  STEAL_SAME_NOTE     // Retrigger a voice already on the note, else as releasing
+};
+
 enum ResampleQuality {
   RESAMPLE_NONE,
   RESAMPLE_FAST,
@@ -123,28 +152,76 @@ struct PWMConfig {
 };
 
 // ============================================================================
-// EQ CONFIGURATION (BIQUAD)
+// EQ CONFIGURATION (BIQUAD CASCADE)
 // ============================================================================
+struct EQBand {
+  BiquadType type;
+  float freq;               // Hz: centre, corner or shelf midpoint
+  float gain;               // dB, peak and shelves only
+  float q;                  // Shelves: 0.707 is the steepest without overshoot
+  
+  const char* getTypeName() const {
+    switch(type) {
+      case BIQUAD_OFF: return "Off";
+      case BIQUAD_PEAK: return "Peak";
+      case BIQUAD_LOWSHELF: return "Lowshelf";
+      case BIQUAD_HIGHSHELF: return "Highshelf";
+      case BIQUAD_NOTCH: return "Notch";
+      case BIQUAD_LOWPASS: return "Lowpass";
+      case BIQUAD_HIGHPASS: return "Highpass";
+      default: return "Unknown";
+    }
+  }
+  
+  // Any case, so profiles can store getTypeName(). False (type unchanged)
+  // for an unknown name.
+  bool setType(const char* typeName) {
+    if (strcasecmp(typeName, "off") == 0) type = BIQUAD_OFF;
+    else if (strcasecmp(typeName, "peak") == 0 || strcasecmp(typeName, "bell") == 0) type = BIQUAD_PEAK;
+    else if (strcasecmp(typeName, "lowshelf") == 0 || strcasecmp(typeName, "ls") == 0) type = BIQUAD_LOWSHELF;
+    else if (strcasecmp(typeName, "highshelf") == 0 || strcasecmp(typeName, "hs") == 0) type = BIQUAD_HIGHSHELF;
+    else if (strcasecmp(typeName, "notch") == 0) type = BIQUAD_NOTCH;
+    else if (strcasecmp(typeName, "lowpass") == 0 || strcasecmp(typeName, "lp") == 0) type = BIQUAD_LOWPASS;
+    else if (strcasecmp(typeName, "highpass") == 0 || strcasecmp(typeName, "hp") == 0) type = BIQUAD_HIGHPASS;
+    else return false;
+    return true;
+  }
+  
+  void set(BiquadType t, float f, float g, float qFactor) {
+    type = t;
+    freq = f;
+    gain = g;
+    q = qFactor;
+  }
+};
+
 struct EQConfig {
   bool enabled;
-  int8_t bass;
-  int8_t mid;
-  int8_t treble;
-  
-  uint16_t bassFreq;
-  uint16_t midFreq;
-  uint16_t trebleFreq;
-  float q;
+  EQBand bands[EQ_MAX_BANDS];   // Run in order. 0-2 are bass/mid/treble.
   
   EQConfig() {
     enabled = DEFAULT_EQ_ENABLED;
-    bass = DEFAULT_EQ_BASS;
-    mid = DEFAULT_EQ_MID;
-    treble = DEFAULT_EQ_TREBLE;
-    bassFreq = EQ_BASS_FREQ;
-    midFreq = EQ_MID_FREQ;
-    trebleFreq = EQ_TREBLE_FREQ;
-    q = EQ_Q_FACTOR;
+    bands[0].set(BIQUAD_LOWSHELF, EQ_BASS_FREQ, DEFAULT_EQ_BASS, EQ_Q_FACTOR);
+    bands[1].set(BIQUAD_PEAK, EQ_MID_FREQ, DEFAULT_EQ_MID, EQ_Q_FACTOR);
+    bands[2].set(BIQUAD_HIGHSHELF, EQ_TREBLE_FREQ, DEFAULT_EQ_TREBLE, EQ_Q_FACTOR);
+    for (uint8_t b = 3; b < EQ_MAX_BANDS; b++) {
+      bands[b].set(BIQUAD_OFF, 1000.0f, 0.0f, EQ_Q_FACTOR);
+    }
+  }
+};
+
+// ============================================================================
+// CONVOLVER CONFIGURATION
+// ============================================================================
+struct ConvolverConfig {
+  bool enabled;
+  uint8_t mix;                  // 0-100 %, wet share
+  char file[CONV_FILE_MAX];     // Impulse response WAV, "" = none
+  
+  ConvolverConfig() {
+    enabled = DEFAULT_CONV_ENABLED;
+    mix = DEFAULT_CONV_MIX;
+    memset(file, 0, sizeof(file));   // strncpy callers rely on the terminator
   }
 };
 
@@ -156,12 +233,16 @@ struct FilterConfig {
   FilterType type;
   float cutoff;
   float resonance;
+  bool perVoice;            // One filter per voice instead of one on the mix
+  float envDepth;           // Per voice: octaves added at full envelope * velocity
   
   FilterConfig() {
     enabled = DEFAULT_FILTER_ENABLED;
     type = (FilterType)DEFAULT_FILTER_TYPE;
     cutoff = DEFAULT_FILTER_CUTOFF;
     resonance = DEFAULT_FILTER_RESONANCE;
+    perVoice = DEFAULT_FILTER_PER_VOICE;
+    envDepth = DEFAULT_FILTER_ENV_DEPTH;
   }
   
   const char* getTypeName() const {
@@ -185,7 +266,7 @@ struct FilterConfig {
 };
 
 // ============================================================================
-// SCHROEDER REVERB CONFIGURATION
+// REVERB CONFIGURATION
 // ============================================================================
 struct ReverbConfig {
   bool enabled;
@@ -220,6 +301,41 @@ struct LFOConfig {
   }
 };
 
+// ============================================================================
+// ENVELOPE CONFIGURATION (ADSR shared by all voices)
+// ============================================================================
+struct EnvelopeConfig {
+  uint16_t attackMs;
+  uint16_t decayMs;
+  uint8_t sustain;        // 0-255
+  uint16_t releaseMs;
+  EnvelopeCurve curve;
+  
+  EnvelopeConfig() {
+    attackMs = DEFAULT_ENV_ATTACK_MS;
+    decayMs = DEFAULT_ENV_DECAY_MS;
+    sustain = DEFAULT_ENV_SUSTAIN;
+    releaseMs = DEFAULT_ENV_RELEASE_MS;
+    curve = (EnvelopeCurve)DEFAULT_ENV_CURVE;
+  }
+  
+  const char* getCurveName() const {
+    switch(curve) {
+      case ENV_CURVE_LINEAR: return "linear";
+      case ENV_CURVE_EXPONENTIAL: return "exponential";
+      default: return "unknown";
+    }
+  }
+  
+  void setCurve(const char* curveName) {
+    if (strcmp(curveName, "linear") == 0 || strcmp(curveName, "lin") == 0) {
+      curve = ENV_CURVE_LINEAR;
+    } else if (strcmp(curveName, "exponential") == 0 || strcmp(curveName, "exp") == 0) {
+      curve = ENV_CURVE_EXPONENTIAL;
+    }
+  }
+};
+
 // ============================================================================
 // DELAY CONFIGURATION
 // ============================================================================
@@ -228,15 +344,96 @@ struct DelayConfig {
   uint16_t timeMs;
   uint8_t feedback;
   uint8_t mix;
+  float modRate;          // Hz, tape wow
+  float modDepth;         // ms, 0 = off
   
   DelayConfig() {
     enabled = DEFAULT_DELAY_ENABLED;
     timeMs = DEFAULT_DELAY_TIME;
     feedback = DEFAULT_DELAY_FEEDBACK;
     mix = DEFAULT_DELAY_MIX;
+    modRate = DEFAULT_DELAY_MOD_RATE;
+    modDepth = DEFAULT_DELAY_MOD_DEPTH;
+  }
+};
+
+// ============================================================================
+// CHORUS CONFIGURATION
+// ============================================================================
+struct ChorusConfig {
+  bool enabled;
+  uint8_t voices;         // CHORUS_VOICES_MIN..CHORUS_VOICES_MAX
+  float rate;             // Hz
+  float delayMs;          // Center of the sweep
+  float depthMs;          // Sweep either side of the center
+  uint8_t mix;            // % wet
+  
+  ChorusConfig() {
+    enabled = DEFAULT_CHORUS_ENABLED;
+    voices = DEFAULT_CHORUS_VOICES;
+    rate = DEFAULT_CHORUS_RATE;
+    delayMs = DEFAULT_CHORUS_DELAY_MS;
+    depthMs = DEFAULT_CHORUS_DEPTH_MS;
+    mix = DEFAULT_CHORUS_MIX;
+  }
+};
+
+// ============================================================================
+// FLANGER CONFIGURATION
+// ============================================================================
+struct FlangerConfig {
+  bool enabled;
+  float rate;             // Hz
+  float delayMs;          // Center of the sweep
+  float depthMs;          // Sweep either side of the center
+  int8_t feedback;        // %, -FLANGER_FEEDBACK_MAX..FLANGER_FEEDBACK_MAX
+  uint8_t mix;            // % wet
+  
+  FlangerConfig() {
+    enabled = DEFAULT_FLANGER_ENABLED;
+    rate = DEFAULT_FLANGER_RATE;
+    delayMs = DEFAULT_FLANGER_DELAY_MS;
+    depthMs = DEFAULT_FLANGER_DEPTH_MS;
+    feedback = DEFAULT_FLANGER_FEEDBACK;
+    mix = DEFAULT_FLANGER_MIX;
+  }
+};
+
+// ============================================================================
+// COMPRESSOR CONFIGURATION
+// ============================================================================
+struct CompressorConfig {
+  bool enabled;
+  float thresholdDb;      // dBFS
+  float ratio;            // n:1 above the threshold
+  float attackMs;
+  uint16_t releaseMs;
+  float makeupDb;
+  
+  CompressorConfig() {
+    enabled = DEFAULT_COMP_ENABLED;
+    thresholdDb = DEFAULT_COMP_THRESHOLD_DB;
+    ratio = DEFAULT_COMP_RATIO;
+    attackMs = DEFAULT_COMP_ATTACK_MS;
+    releaseMs = DEFAULT_COMP_RELEASE_MS;
+    makeupDb = DEFAULT_COMP_MAKEUP_DB;
   }
 };
 
+// ============================================================================
+// OUTPUT LIMITER CONFIGURATION
+// ============================================================================
+struct LimiterConfig {
+  bool enabled;
+  float ceilingDb;        // dBFS, LIMITER_CEILING_MIN_DB..LIMITER_CEILING_MAX_DB
+  uint16_t releaseMs;
+  
+  LimiterConfig() {
+    enabled = DEFAULT_LIMITER_ENABLED;
+    ceilingDb = DEFAULT_LIMITER_CEILING_DB;
+    releaseMs = DEFAULT_LIMITER_RELEASE_MS;
+  }
+};
 
 // ============================================================================
 // MAIN SETTINGS STRUCTURE
@@ -248,18 +445,27 @@ struct AudioSettings {
   AudioMode mode;
   uint32_t sampleRate;
   uint8_t voices;
+  VoiceStealPolicy voiceSteal;
   uint8_t volume;
+  uint8_t panSpread;      // 0-100 %, keyboard pan width
   
   WaveformType waveform;
+  OscillatorMode oscillator;
+  EnvelopeConfig envelope;
   
   I2SConfig i2s;
   PWMConfig pwm;
   
   EQConfig eq;
+  ConvolverConfig convolver;
   FilterConfig filter;
   ReverbConfig reverb;
   LFOConfig lfo;
   DelayConfig delay;
+  ChorusConfig chorus;
+  FlangerConfig flanger;
+  CompressorConfig compressor;
+  LimiterConfig limiter;
   
   ResampleQuality resampleQuality;
   MultiCoreConfig multiCore;
@@ -272,9 +478,12 @@ struct AudioSettings {
     mode = MODE_I2S;
     sampleRate = DEFAULT_SAMPLE_RATE;
     voices = DEFAULT_MAX_VOICES;
+    voiceSteal = (VoiceStealPolicy)DEFAULT_VOICE_STEAL;
     volume = DEFAULT_VOLUME;
+    panSpread = DEFAULT_PAN_SPREAD;
     
     waveform = WAVE_SINE;
+    oscillator = USE_BANDLIMITED_TABLES ? OSC_WAVETABLE : OSC_POLYBLEP;
     resampleQuality = RESAMPLE_BEST;
   }
   
@@ -309,6 +518,38 @@ struct AudioSettings {
     else if (strcmp(qualityName, "best") == 0) resampleQuality = RESAMPLE_BEST;
   }
   
+  const char* getOscillatorName() const {
+    switch(oscillator) {
+      case OSC_NAIVE: return "naive";
+      case OSC_WAVETABLE: return "wavetable";
+      case OSC_POLYBLEP: return "polyblep";
+      default: return "unknown";
+    }
+  }
+  
+  void setOscillator(const char* oscillatorName) {
+    if (strcmp(oscillatorName, "naive") == 0) oscillator = OSC_NAIVE;
+    else if (strcmp(oscillatorName, "wavetable") == 0 || strcmp(oscillatorName, "table") == 0) oscillator = OSC_WAVETABLE;
+    else if (strcmp(oscillatorName, "polyblep") == 0 || strcmp(oscillatorName, "blep") == 0) oscillator = OSC_POLYBLEP;
+  }
+  
+  const char* getVoiceStealName() const {
+    switch(voiceSteal) {
+      case STEAL_OLDEST: return "oldest";
+      case STEAL_QUIETEST: return "quietest";
+      case STEAL_RELEASING: return "releasing";
+      case STEAL_SAME_NOTE: return "samenote";
+      default: return "unknown";
+    }
+  }
+  
+  void setVoiceSteal(const char* policyName) {
+    if (strcmp(policyName, "oldest") == 0) voiceSteal = STEAL_OLDEST;
+    else if (strcmp(policyName, "quietest") == 0) voiceSteal = STEAL_QUIETEST;
+    else if (strcmp(policyName, "releasing") == 0) voiceSteal = STEAL_RELEASING;
+    else if (strcmp(policyName, "samenote") == 0 || strcmp(policyName, "same") == 0) voiceSteal = STEAL_SAME_NOTE;
+  }
+  
   const char* getWaveformName() const {
     switch(waveform) {
       case WAVE_SINE: return "sine";
@@ -0,0 +1,677 @@
+// AudioVoiceBank.cpp - ESP32 Audio OS v2.0
+// Structure-of-arrays voice bank with branch-free block rendering
+
+#include "AudioVoiceBank.h"
+#include <math.h>
+
+// ============================================================================
+// OSCILLATORS (32-bit phase -> -32768..32767)
+// ============================================================================
+
+struct OscSine {
+  static inline int32_t sample(uint32_t phase) {
+    return sineFromPhase(phase);
+  }
+};
+
+struct OscSquare {
+  static inline int32_t sample(uint32_t phase) {
+    return (phase >> (VOICE_PHASE_BITS - 1)) ? -32767 : 32767;
+  }
+};
+
+struct OscSawtooth {
+  static inline int32_t sample(uint32_t phase) {
+    return (int32_t)(phase >> 16) - 32768;
+  }
+};
+
+struct OscTriangle {
+  static inline int32_t sample(uint32_t phase) {
+    // Fold the second half back down, then scale to full range
+    uint32_t folded = phase ^ (0 - (phase >> (VOICE_PHASE_BITS - 1)));
+    return (int32_t)((folded << 1) >> 16) - 32768;
+  }
+};
+
+// Band-limited table for one octave level, linear interpolation
+struct OscTable {
+  const int16_t* table;
+
+  explicit OscTable(const int16_t* t) : table(t) {}
+
+  inline int32_t sample(uint32_t phase) const {
+    uint32_t index = phase >> (VOICE_PHASE_BITS - BL_TABLE_BITS);
+    int32_t frac = (phase >> (VOICE_PHASE_BITS - BL_TABLE_BITS - OSC_FRAC_BITS)) & 0x7FFF;
+    int32_t s0 = table[index];
+    int32_t s1 = table[(index + 1) & (BL_TABLE_SIZE - 1)];
+    return s0 + (((s1 - s0) * frac) >> OSC_FRAC_BITS);
+  }
+};
+
+// PolyBLEP: naive square/saw with a two-sample polynomial residual subtracted
+// around each discontinuity. Works on the top 16 phase bits: t = distance to
+// the edge in units of the phase increment (Q15 via the per-voice reciprocal
+// invInc = 2^31 / inc16); the residual is (1 - t)^2 on either side of an
+// upward unit step.
+static inline int32_t polyBlep(uint32_t phase16, uint32_t inc16, uint32_t invInc) {
+  if (phase16 < inc16) {
+    int32_t r = 32768 - (int32_t)((phase16 * invInc) >> 16);
+    return -((r * r) >> 15);
+  }
+  uint32_t d = 0x10000 - phase16;
+  if (d <= inc16) {
+    int32_t r = 32768 - (int32_t)((d * invInc) >> 16);
+    return (r * r) >> 15;
+  }
+  return 0;
+}
+
+struct OscBlepSawtooth {
+  uint32_t inc16, invInc;
+
+  OscBlepSawtooth(uint32_t i, uint32_t inv) : inc16(i), invInc(inv) {}
+
+  inline int32_t sample(uint32_t phase) const {
+    // Falling edge at the wrap
+    return OscSawtooth::sample(phase) - polyBlep(phase >> 16, inc16, invInc);
+  }
+};
+
+struct OscBlepSquare {
+  uint32_t inc16, invInc;
+
+  OscBlepSquare(uint32_t i, uint32_t inv) : inc16(i), invInc(inv) {}
+
+  inline int32_t sample(uint32_t phase) const {
+    // Rising edge at the wrap, falling edge half a cycle later
+    return OscSquare::sample(phase) + polyBlep(phase >> 16, inc16, invInc)
+                                    - polyBlep((phase + VOICE_PHASE_HALF) >> 16, inc16, invInc);
+  }
+};
+
+// Where a voice's samples go: gain and pan straight into the stereo mix,
+// or unscaled into a mono block for the voice filter (gain and pan follow
+// it, see filterVoice). Passed by value, so the stores into mix cannot
+// alias the pan gains and force reloads.
+struct PanOut {
+  const int32_t* gain;
+  int32_t panL, panR;
+  int32_t* mix;
+
+  PanOut(const int32_t* g, int32_t l, int32_t r, int32_t* m)
+    : gain(g), panL(l), panR(r), mix(m) {}
+
+  inline void put(uint32_t i, int32_t s) const {
+    s = (s * gain[i]) >> 15;
+    mix[i * 2] += (s * panL) >> 15;
+    mix[i * 2 + 1] += (s * panR) >> 15;
+  }
+};
+
+struct MonoOut {
+  int32_t* out;
+
+  explicit MonoOut(int32_t* o) : out(o) {}
+
+  inline void put(uint32_t i, int32_t s) const { out[i] = s; }
+};
+
+// One voice, one block: no per-sample dispatch, the oscillator is inlined.
+// Vibrato changes the step once per LFO_CONTROL_FRAMES segment, so the
+// sample loop is the same with or without it.
+template <class Osc, class Out>
+static uint32_t renderOscillator(const Osc& osc, uint32_t phase, uint32_t inc,
+                                 const int32_t* vibrato, Out out,
+                                 uint32_t frames) {
+  uint32_t i = 0;
+  while (i < frames) {
+    uint32_t end = frames;
+    uint32_t step = inc;
+    if (vibrato) {
+      step += (int32_t)(inc >> 15) * vibrato[i / LFO_CONTROL_FRAMES];
+      if (end > i + LFO_CONTROL_FRAMES) end = i + LFO_CONTROL_FRAMES;
+    }
+
+    for (; i < end; i++) {
+      out.put(i, osc.sample(phase));
+      phase += step;
+    }
+  }
+  return phase;
+}
+
+// ============================================================================
+// CONSTRUCTION / BUFFERS
+// ============================================================================
+
+VoiceBank::VoiceBank()
+  : count(0), activeMask(0), releaseMask(0), fadeMask(0), pendingMask(0),
+    noiseState(0xACE1u), waveform(WAVE_SINE), oscMode(OSC_WAVETABLE),
+    stealPolicy((VoiceStealPolicy)DEFAULT_VOICE_STEAL), noteCounter(0), stealCount(0),
+    busGain(32768), sampleRate(DEFAULT_SAMPLE_RATE),
+    envAttackMs(DEFAULT_ENV_ATTACK_MS), envDecayMs(DEFAULT_ENV_DECAY_MS),
+    envReleaseMs(DEFAULT_ENV_RELEASE_MS), envSustainLevel(DEFAULT_ENV_SUSTAIN),
+    envCurve(ENV_CURVE_LINEAR),
+    gainBuffer(nullptr), voiceBuffer(nullptr), maxFrames(0) {
+  // MIDI RP-036 law scaled by sqrt(2): 1 and 127 are hard left/right, 64 is
+  // unity on both sides, so a centered voice sums exactly as in mono
+  for (int p = 0; p <= MIDI_NOTE_COUNT; p++) {
+    float x = (p <= 1) ? 0.0f : (p >= 127) ? 1.0f : (float)(p - 1) / 126.0f;
+    panGain[p] = (int32_t)lroundf(cosf(x * (PI / 2.0f)) * 1.41421356f * 32768.0f);
+  }
+  
+  reset(0, WAVE_SINE);
+  setSampleRate(DEFAULT_SAMPLE_RATE);
+}
+
+VoiceBank::~VoiceBank() {
+  deallocate();
+}
+
+bool VoiceBank::allocate(uint32_t frames) {
+  deallocate();
+
+  gainBuffer = (int32_t*)malloc(frames * sizeof(int32_t));
+  voiceBuffer = (int32_t*)malloc(frames * sizeof(int32_t));
+  if (!gainBuffer || !voiceBuffer) {
+    deallocate();
+    return false;
+  }
+
+  maxFrames = frames;
+  return true;
+}
+
+void VoiceBank::deallocate() {
+  if (gainBuffer) {
+    free(gainBuffer);
+    gainBuffer = nullptr;
+  }
+  if (voiceBuffer) {
+    free(voiceBuffer);
+    voiceBuffer = nullptr;
+  }
+  maxFrames = 0;
+}
+
+void VoiceBank::reset(uint8_t voiceCount, WaveformType wave) {
+  count = (voiceCount > MAX_VOICES) ? MAX_VOICES : voiceCount;
+  waveform = wave;
+  activeMask = 0;
+  releaseMask = 0;
+  fadeMask = 0;
+  pendingMask = 0;
+  noteCounter = 0;
+  stealCount = 0;
+
+  for (int v = 0; v < MAX_VOICES; v++) {
+    phase[v] = 0;
+    phaseInc[v] = 0;
+    velocity[v] = 0;
+    tableLevel[v] = BL_TABLE_LEVELS - 1;
+    note[v] = 0;
+    noteStart[v] = 0;
+    pendingNote[v] = 0;
+    pendingVel[v] = 0;
+    pendingPan[v] = PAN_CENTER;
+    panLeft[v] = panRight[v] = 32768;
+    envStage[v] = ENV_OFF;
+    envLevel[v] = 0;
+    envStep[v] = 0;
+    envTarget[v] = 0;
+    envRemain[v] = 0;
+    voiceFilter[v].reset();
+  }
+}
+
+// ============================================================================
+// NOTE CONTROL
+// ============================================================================
+
+void VoiceBank::setSampleRate(uint32_t rate) {
+  sampleRate = rate;
+
+  for (int n = 0; n < MIDI_NOTE_COUNT; n++) {
+    double cycles = 440.0 * pow(2.0, (n - 69) / 12.0) / (double)sampleRate;
+    cycles -= floor(cycles);   // Above the sample rate the phase aliases anyway
+    noteInc[n] = (uint32_t)(cycles * 4294967296.0);
+    noteLevel[n] = blTableLevel(noteInc[n], VOICE_PHASE_BITS);
+  }
+
+  updateEnvelopeRates();
+}
+
+void VoiceBank::noteOn(uint8_t v, uint8_t midiNote, uint8_t vel, uint8_t pan) {
+  if (v >= count) return;
+  midiNote &= MIDI_NOTE_COUNT - 1;
+  if (pan < 1) pan = 1;
+  if (pan > 127) pan = 127;
+
+  // A sounding voice keeps its phase (and filter) and attacks from its
+  // current level
+  if (!isOn(v)) {
+    phase[v] = 0;
+    voiceFilter[v].reset();
+  }
+  note[v] = midiNote;
+  velocity[v] = ((int32_t)vel * 32767) / 127;
+  phaseInc[v] = noteInc[midiNote];
+  tableLevel[v] = noteLevel[midiNote];
+  panLeft[v] = (panGain[pan] * busGain) >> 15;
+  panRight[v] = (panGain[MIDI_NOTE_COUNT - pan] * busGain) >> 15;
+  noteStart[v] = noteCounter++;
+
+  enterStage(v, ENV_ATTACK);
+  activeMask |= (1UL << v);
+  pendingMask &= ~(1UL << v);
+}
+
+void VoiceBank::noteOff(uint8_t v) {
+  if (v >= count) return;
+  if (envStage[v] != ENV_OFF && envStage[v] != ENV_RELEASE && envStage[v] != ENV_FADE) {
+    enterStage(v, ENV_RELEASE);
+  }
+}
+
+void VoiceBank::allNotesOff() {
+  pendingMask = 0;
+  for (uint8_t v = 0; v < count; v++) {
+    noteOff(v);
+  }
+}
+
+void VoiceBank::setWaveform(WaveformType wave) {
+  waveform = wave;
+}
+
+void VoiceBank::setOscillatorMode(OscillatorMode mode) {
+  oscMode = availableMode(mode);
+}
+
+OscillatorMode VoiceBank::availableMode(OscillatorMode mode) {
+  #if !USE_BANDLIMITED_TABLES
+    if (mode == OSC_WAVETABLE) return OSC_POLYBLEP;
+  #endif
+  return mode;
+}
+
+uint8_t VoiceBank::getActiveCount() const {
+  return (uint8_t)__builtin_popcount(activeMask);
+}
+
+// ============================================================================
+// ALLOCATION (bit scans over the voice masks; a full scan only when stealing)
+// ============================================================================
+
+void VoiceBank::play(uint8_t midiNote, uint8_t vel, uint8_t pan) {
+  midiNote &= MIDI_NOTE_COUNT - 1;
+  int v = pickVoice(midiNote);
+  if (v < 0) return;
+
+  bool retrigger = (stealPolicy == STEAL_SAME_NOTE) && note[v] == midiNote &&
+                   envStage[v] != ENV_FADE;
+  if (!isOn(v) || retrigger) {
+    noteOn(v, midiNote, vel, pan);
+    return;
+  }
+
+  // Steal: fade the old note out, render() starts the queued one after it
+  if (envStage[v] != ENV_FADE) {
+    enterStage(v, ENV_FADE);
+    stealCount++;
+  }
+  pendingNote[v] = midiNote;
+  pendingVel[v] = vel;
+  pendingPan[v] = pan;
+  pendingMask |= (1UL << v);
+}
+
+void VoiceBank::release(uint8_t midiNote) {
+  uint32_t mask = activeMask & ~(releaseMask | fadeMask);
+  while (mask) {
+    uint8_t v = (uint8_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    if (note[v] == midiNote) enterStage(v, ENV_RELEASE);
+  }
+
+  // Released before its fade finished: it never starts
+  mask = pendingMask;
+  while (mask) {
+    uint8_t v = (uint8_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    if (pendingNote[v] == midiNote) pendingMask &= ~(1UL << v);
+  }
+}
+
+uint32_t VoiceBank::usableMask() const {
+  return (count >= 32) ? 0xFFFFFFFFUL : ((1UL << count) - 1);
+}
+
+int VoiceBank::pickVoice(uint8_t midiNote) const {
+  const uint32_t usable = usableMask();
+  if (usable == 0) return -1;
+
+  if (stealPolicy == STEAL_SAME_NOTE) {
+    uint32_t mask = activeMask & ~fadeMask;
+    while (mask) {
+      uint8_t v = (uint8_t)__builtin_ctz(mask);
+      mask &= mask - 1;
+      if (note[v] == midiNote) return v;
+    }
+  }
+
+  // A voice whose fade has finished still owns its queued note until render()
+  uint32_t freeMask = usable & ~(activeMask | pendingMask);
+  if (freeMask) return __builtin_ctz(freeMask);
+
+  // Every voice is already being stolen: only one queued note changes
+  uint32_t busy = usable & activeMask & ~fadeMask;
+  if (busy == 0) {
+    uint32_t queued = usable & (fadeMask | pendingMask);
+    return queued ? __builtin_ctz(queued) : -1;
+  }
+
+  switch (stealPolicy) {
+    case STEAL_QUIETEST:
+      return quietestOf(busy);
+    case STEAL_RELEASING:
+    case STEAL_SAME_NOTE:
+      if (busy & releaseMask) busy &= releaseMask;
+      return oldestOf(busy);
+    default:
+      return oldestOf(busy);
+  }
+}
+
+int VoiceBank::oldestOf(uint32_t mask) const {
+  int best = -1;
+  uint32_t bestAge = 0;
+  while (mask) {
+    uint8_t v = (uint8_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    uint32_t age = noteCounter - noteStart[v];
+    if (best < 0 || age > bestAge) {
+      best = v;
+      bestAge = age;
+    }
+  }
+  return best;
+}
+
+int VoiceBank::quietestOf(uint32_t mask) const {
+  int best = -1;
+  int32_t bestGain = 0;
+  while (mask) {
+    uint8_t v = (uint8_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    int32_t gain = ((envLevel[v] >> 9) * velocity[v]) >> 15;
+    if (best < 0 || gain < bestGain) {
+      best = v;
+      bestGain = gain;
+    }
+  }
+  return best;
+}
+
+// ============================================================================
+// ENVELOPE (additive Q24 steps; exponential as one chord per segment)
+// ============================================================================
+
+void VoiceBank::setEnvelope(uint16_t attackMs, uint16_t decayMs, uint8_t sustain,
+                            uint16_t releaseMs, EnvelopeCurve curve) {
+  envAttackMs = attackMs;
+  envDecayMs = decayMs;
+  envSustainLevel = sustain;
+  envReleaseMs = releaseMs;
+  envCurve = curve;
+  updateEnvelopeRates();
+}
+
+// A stage from L0 to L1 over S samples aims at T = L1 + (L1 - L0) * r and
+// shrinks the distance to T by c = (r / (1 + r))^(1 / S) per sample, so it
+// lands on L1 after exactly S samples whatever L0 is. envSegCoef holds
+// c^ENV_CONTROL_FRAMES.
+void VoiceBank::updateEnvelopeRates() {
+  const uint16_t ms[ENV_STAGE_COUNT] = { 0, envAttackMs, envDecayMs, 0, envReleaseMs,
+                                         VOICE_STEAL_FADE_MS };
+
+  envSustain = (int32_t)envSustainLevel * (ENV_LEVEL_ONE / 255);
+
+  for (int stage = 0; stage < ENV_STAGE_COUNT; stage++) {
+    uint32_t samples = (uint32_t)(((uint64_t)ms[stage] * sampleRate) / 1000);
+    if (samples == 0) samples = 1;
+    envSamples[stage] = samples;
+
+    float r = (stage == ENV_ATTACK) ? ENV_ATTACK_OVERSHOOT : ENV_DECAY_OVERSHOOT;
+    float perSegment = powf(r / (1.0f + r), (float)ENV_CONTROL_FRAMES / (float)samples);
+    envSegCoef[stage] = (int32_t)(perSegment * (float)(1L << 30));
+  }
+}
+
+void VoiceBank::enterStage(uint8_t v, EnvStage stage) {
+  int32_t end;
+  const uint32_t bit = 1UL << v;
+
+  envStage[v] = stage;
+  releaseMask = (stage == ENV_RELEASE) ? (releaseMask | bit) : (releaseMask & ~bit);
+  fadeMask = (stage == ENV_FADE) ? (fadeMask | bit) : (fadeMask & ~bit);
+
+  switch (stage) {
+    case ENV_ATTACK:
+      // Retriggered voices rise from where they are instead of jumping to 0
+      if (!isOn(v)) envLevel[v] = 0;
+      end = ENV_LEVEL_ONE;
+      break;
+
+    case ENV_DECAY:
+      envLevel[v] = ENV_LEVEL_ONE;
+      end = envSustain;
+      break;
+
+    case ENV_RELEASE:
+    case ENV_FADE:
+      // Ramps down from wherever the note is (no jump when released early)
+      end = 0;
+      break;
+
+    case ENV_SUSTAIN:
+      envLevel[v] = envSustain;
+      envRemain[v] = 0;
+      envStep[v] = 0;
+      return;
+
+    default:
+      envLevel[v] = 0;
+      envStep[v] = 0;
+      envRemain[v] = 0;
+      activeMask &= ~bit;
+      return;
+  }
+
+  int32_t range = end - envLevel[v];
+  float r = (stage == ENV_ATTACK) ? ENV_ATTACK_OVERSHOOT : ENV_DECAY_OVERSHOOT;
+
+  envRemain[v] = envSamples[stage];
+  envStep[v] = range / (int32_t)envRemain[v];
+  envTarget[v] = end + (int32_t)(range * r);
+}
+
+// Fills gainBuffer with envelope * velocity (Q15) and returns how many
+// samples the voice sounds in this block (< frames when it finishes)
+uint32_t VoiceBank::renderEnvelope(uint8_t v, uint32_t frames) {
+  const int32_t vel = velocity[v];
+  const bool exponential = (envCurve == ENV_CURVE_EXPONENTIAL);
+  uint32_t i = 0;
+
+  while (i < frames && envStage[v] != ENV_OFF) {
+    uint32_t run = frames - i;
+    bool timed = envStage[v] != ENV_SUSTAIN;
+    if (timed && envRemain[v] < run) run = envRemain[v];
+
+    int32_t level = envLevel[v];
+    int32_t step = envStep[v];
+    if (exponential && timed && envStage[v] != ENV_FADE) {
+      // One segment at a time, along the chord to the curve's next point
+      if (run > ENV_CONTROL_FRAMES) run = ENV_CONTROL_FRAMES;
+      int32_t target = envTarget[v];
+      int32_t next = target + (int32_t)(((int64_t)(level - target) * envSegCoef[envStage[v]]) >> 30);
+      if (next < 0) next = 0;
+      if (next > ENV_LEVEL_ONE) next = ENV_LEVEL_ONE;
+      step = (next - level) >> ENV_CONTROL_SHIFT;
+    }
+
+    int32_t* gain = gainBuffer + i;
+    for (uint32_t k = 0; k < run; k++) {
+      level += step;
+      gain[k] = ((level >> 9) * vel) >> 15;
+    }
+    envLevel[v] = level;
+    i += run;
+
+    if (timed) {
+      envRemain[v] -= run;
+      if (envRemain[v] == 0) {
+        switch (envStage[v]) {
+          case ENV_ATTACK:  enterStage(v, ENV_DECAY); break;
+          case ENV_DECAY:   enterStage(v, ENV_SUSTAIN); break;
+          default:          enterStage(v, ENV_OFF); break;
+        }
+      }
+    }
+  }
+
+  return i;
+}
+
+// ============================================================================
+// BLOCK RENDERING
+// ============================================================================
+
+template <class Out>
+void VoiceBank::renderVoice(WaveformType wave, uint8_t v, const Out& out,
+                            uint32_t len, const int32_t* vibrato) {
+  switch (wave) {
+    case WAVE_SINE:
+      phase[v] = renderOscillator(OscSine(), phase[v], phaseInc[v], vibrato, out, len);
+      break;
+
+    case WAVE_SQUARE:
+    case WAVE_SAWTOOTH:
+    case WAVE_TRIANGLE:
+      phase[v] = renderShape(wave, v, out, len, vibrato);
+      break;
+
+    case WAVE_NOISE:
+      {
+        // Pitchless: one shared LFSR, vibrato has no effect
+        uint32_t lfsr = noiseState;
+        for (uint32_t i = 0; i < len; i++) {
+          uint32_t bit = ((lfsr >> 0) ^ (lfsr >> 2) ^ (lfsr >> 22) ^ (lfsr >> 31)) & 1;
+          lfsr = (lfsr >> 1) | (bit << 31);
+          out.put(i, (int32_t)(lfsr & 0xFFFF) - 32768);
+        }
+        noiseState = lfsr;
+      }
+      break;
+  }
+}
+
+// Square, saw and triangle in the selected oscillator mode. PolyBLEP only
+// corrects step discontinuities, so its triangle (slope corners, harmonics
+// falling at 12 dB/octave) stays naive.
+template <class Out>
+uint32_t VoiceBank::renderShape(WaveformType wave, uint8_t v, const Out& out,
+                                uint32_t len, const int32_t* vibrato) {
+  const uint32_t inc = phaseInc[v];
+
+  #if USE_BANDLIMITED_TABLES
+    if (oscMode == OSC_WAVETABLE) {
+      BLWave bl = (wave == WAVE_SQUARE) ? BL_SQUARE :
+                  (wave == WAVE_SAWTOOTH) ? BL_SAWTOOTH : BL_TRIANGLE;
+      OscTable osc(blWavetables[bl][tableLevel[v]]);
+      return renderOscillator(osc, phase[v], inc, vibrato, out, len);
+    }
+  #endif
+
+  if (oscMode == OSC_POLYBLEP && wave != WAVE_TRIANGLE) {
+    uint32_t inc16 = inc >> 16;
+    uint32_t invInc = inc16 ? (1UL << 31) / inc16 : 0;
+    if (wave == WAVE_SQUARE) {
+      return renderOscillator(OscBlepSquare(inc16, invInc), phase[v], inc, vibrato, out, len);
+    }
+    return renderOscillator(OscBlepSawtooth(inc16, invInc), phase[v], inc, vibrato, out, len);
+  }
+
+  switch (wave) {
+    case WAVE_SQUARE:
+      return renderOscillator(OscSquare(), phase[v], inc, vibrato, out, len);
+    case WAVE_SAWTOOTH:
+      return renderOscillator(OscSawtooth(), phase[v], inc, vibrato, out, len);
+    default:
+      return renderOscillator(OscTriangle(), phase[v], inc, vibrato, out, len);
+  }
+}
+
+// voiceBuffer (one voice, unscaled) through the voice's filter, then gain
+// and pan into the mix. The cutoff follows the envelope once per
+// SVF_CONTROL_FRAMES: one coefficient set (one divide) per segment. The
+// filter can ring up to 1 / SVF_MIN_DAMPING above full scale, so the last
+// products are 64-bit.
+void VoiceBank::filterVoice(uint8_t v, int32_t* mix, uint32_t len, uint32_t frames,
+                            const SvfControl& filter) {
+  StateVariableFilter& svf = voiceFilter[v];
+  for (uint32_t i = 0; i < len; i += SVF_CONTROL_FRAMES) {
+    uint32_t run = len - i;
+    if (run > SVF_CONTROL_FRAMES) run = SVF_CONTROL_FRAMES;
+    int32_t pitch = filter.pitchAt(i, frames) + ((filter.envDepth * gainBuffer[i]) >> 15);
+    SvfCoefficients c = SvfCoefficients::fromPitch(pitch, filter.dampingAt(i, frames));
+    svf.process(filter.type, c, voiceBuffer + i, run, 1, SVF_VOICE_GUARD_BITS);
+  }
+
+  const int32_t panL = panLeft[v];
+  const int32_t panR = panRight[v];
+  for (uint32_t i = 0; i < len; i++) {
+    int32_t s = voiceBuffer[i];
+    int32_t gainL = (gainBuffer[i] * panL) >> 15;
+    int32_t gainR = (gainBuffer[i] * panR) >> 15;
+    mix[i * 2] += (int32_t)(((int64_t)s * gainL) >> 15);
+    mix[i * 2 + 1] += (int32_t)(((int64_t)s * gainR) >> 15);
+  }
+}
+
+void VoiceBank::resetFilters() {
+  for (int v = 0; v < MAX_VOICES; v++) voiceFilter[v].reset();
+}
+
+bool VoiceBank::render(int32_t* mix, uint32_t frames, const int32_t* vibrato,
+                       const SvfControl* filter) {
+  // Stolen voices whose fade has finished start their queued note
+  uint32_t ready = pendingMask & ~activeMask;
+  while (ready) {
+    uint8_t v = (uint8_t)__builtin_ctz(ready);
+    ready &= ready - 1;
+    noteOn(v, pendingNote[v], pendingVel[v], pendingPan[v]);
+  }
+
+  if (activeMask == 0 || frames == 0) return false;
+  if (frames > maxFrames) frames = maxFrames;
+
+  // Voice by voice: the mix stays in cache and each voice keeps its phase,
+  // increment and pan in registers for the whole block
+  uint32_t mask = activeMask;
+  while (mask) {
+    uint8_t v = (uint8_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    uint32_t len = renderEnvelope(v, frames);
+
+    if (filter) {
+      renderVoice(waveform, v, MonoOut(voiceBuffer), len, vibrato);
+      filterVoice(v, mix, len, frames, *filter);
+    } else {
+      renderVoice(waveform, v, PanOut(gainBuffer, panLeft[v], panRight[v], mix), len, vibrato);
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,214 @@
+// AudioVoiceBank.h - ESP32 Audio OS v2.0
+// Structure-of-arrays voice bank with branch-free block rendering
+//
+// Voice state lives in parallel arrays (phase, increment, envelope, velocity)
+// instead of one struct per voice. All voices share one waveform, so render()
+// runs one tight loop per voice and block with the waveform switch hoisted
+// out: the per-sample cost is an oscillator read, a gain multiply and a
+// panned add into the interleaved stereo mix. With the
+// per-voice filter on, a voice renders into a mono scratch block instead,
+// runs through its own state-variable filter and is then panned in.
+
+#ifndef AUDIO_VOICE_BANK_H
+#define AUDIO_VOICE_BANK_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+#include "AudioSettings.h"
+#include "AudioWavetables.h"
+#include "AudioEffects.h"
+
+// Envelope stages, see EnvStage
+#define ENV_STAGE_COUNT         6
+
+// Oscillator phase: a full uint32_t is one cycle, unsigned overflow is the wrap
+#define VOICE_PHASE_BITS        32
+#define VOICE_PHASE_HALF        ((uint32_t)1 << 31)
+
+#define MIDI_NOTE_COUNT         128
+
+// Pan: MIDI 0-127, 64 = center
+#define PAN_CENTER              64
+
+// Envelope level: Q24, 1.0 = ENV_LEVEL_ONE
+#define ENV_LEVEL_ONE           (1L << 24)
+
+// Table reads index from the top phase bits and interpolate on the next 15
+#define OSC_FRAC_BITS           15
+
+#if USE_WAVETABLE_LOOKUP
+  extern int16_t sineTable[WAVETABLE_SIZE];
+#endif
+
+// Sine of a 32-bit phase (one cycle = 2^32), -32767..32767. Shared by the
+// voice oscillators and the LFO.
+static inline int32_t sineFromPhase(uint32_t phase) {
+  #if USE_WAVETABLE_LOOKUP
+    uint32_t index = phase >> (VOICE_PHASE_BITS - WAVETABLE_BITS);
+    int32_t frac = (phase >> (VOICE_PHASE_BITS - WAVETABLE_BITS - OSC_FRAC_BITS)) & 0x7FFF;
+    int32_t s0 = sineTable[index];
+    int32_t s1 = sineTable[(index + 1) & (WAVETABLE_SIZE - 1)];
+    return s0 + (((s1 - s0) * frac) >> OSC_FRAC_BITS);
+  #else
+    return (int32_t)(sinf(phase * (2.0f * PI / 4294967296.0f)) * 32767.0f);
+  #endif
+}
+
+// ============================================================================
+// ENVELOPE STAGES (linear, or exponential as per-segment chords)
+// ============================================================================
+enum EnvStage : uint8_t {
+  ENV_OFF,
+  ENV_ATTACK,
+  ENV_DECAY,
+  ENV_SUSTAIN,
+  ENV_RELEASE,
+  ENV_FADE          // Stolen: short linear fade, then the queued note starts
+};
+
+// ============================================================================
+// VOICE BANK
+// ============================================================================
+class VoiceBank {
+public:
+  VoiceBank();
+  ~VoiceBank();
+
+  // Scratch buffers for blocks of up to maxFrames
+  bool allocate(uint32_t maxFrames);
+  void deallocate();
+
+  // Silences everything and sets the number of usable voices
+  void reset(uint8_t voiceCount, WaveformType wave);
+
+  // Rebuilds the note-to-increment table (the only place pitch math runs)
+  // and the envelope rates
+  void setSampleRate(uint32_t sampleRate);
+
+  // ADSR shared by every voice. Times are converted to stage lengths and
+  // per-segment coefficients here, never in the render loop. sustain 0-255.
+  void setEnvelope(uint16_t attackMs, uint16_t decayMs, uint8_t sustain,
+                   uint16_t releaseMs, EnvelopeCurve curve);
+
+  // Allocates a voice for the note under the steal policy. A free voice is
+  // one bit scan; when all are busy the victim fades out over
+  // VOICE_STEAL_FADE_MS and the note starts on it at the next block.
+  void play(uint8_t midiNote, uint8_t vel, uint8_t pan = PAN_CENTER);
+  // Releases every voice playing the note (and drops it if still queued)
+  void release(uint8_t midiNote);
+
+  // Direct per-voice control, no allocation
+  void noteOn(uint8_t v, uint8_t midiNote, uint8_t vel, uint8_t pan = PAN_CENTER);
+  void noteOff(uint8_t v);
+  void allNotesOff();
+  void setWaveform(WaveformType wave);
+
+  // Naive, band-limited table or PolyBLEP square/saw/triangle. Wavetable
+  // falls back to PolyBLEP when the tables are not compiled in.
+  void setOscillatorMode(OscillatorMode mode);
+  OscillatorMode getOscillatorMode() const { return oscMode; }
+  static OscillatorMode availableMode(OscillatorMode mode);
+
+  void setStealPolicy(VoiceStealPolicy policy) { stealPolicy = policy; }
+  VoiceStealPolicy getStealPolicy() const { return stealPolicy; }
+  uint32_t getStealCount() const { return stealCount; }
+
+  bool isOn(uint8_t v) const { return (activeMask >> v) & 1; }
+  uint8_t getNote(uint8_t v) const { return note[v]; }
+  uint8_t getCount() const { return count; }
+  uint8_t getActiveCount() const;
+
+  // Fixed mix bus gain (Q15, unity = 32768), folded into the pan gains of
+  // notes started from here on. Voices are summed, never averaged.
+  void setBusGain(int32_t gain) { busGain = gain; }
+
+  // Adds every sounding voice into mix[] (interleaved L/R, frames * 2).
+  // vibrato is a Q15 pitch offset (fraction of the frequency) per
+  // LFO_CONTROL_FRAMES segment, or nullptr. filter runs one filter per
+  // voice (cutoff + envDepth * envelope * velocity), or nullptr. Returns
+  // true if any voice sounded.
+  bool render(int32_t* mix, uint32_t frames, const int32_t* vibrato,
+              const SvfControl* filter = nullptr);
+
+  // Clears every voice filter (new notes start from a clear one anyway)
+  void resetFilters();
+
+private:
+  uint8_t count;
+  uint32_t activeMask;            // Bit v set while voice v sounds
+  uint32_t releaseMask;           // Bit v set while voice v is in ENV_RELEASE
+  uint32_t fadeMask;              // Bit v set while voice v is in ENV_FADE
+  uint32_t pendingMask;           // Bit v set while voice v has a note queued
+  uint32_t noiseState;            // Shared LFSR for WAVE_NOISE
+  WaveformType waveform;          // Common to every voice
+  OscillatorMode oscMode;
+
+  // Allocation
+  VoiceStealPolicy stealPolicy;
+  uint32_t noteCounter;           // Stamps noteStart[] (wraps; compared by difference)
+  uint32_t stealCount;
+
+  // Constant-power pan gain (Q15, center = unity) per MIDI pan; right is
+  // panGain[128 - pan]
+  int32_t panGain[MIDI_NOTE_COUNT + 1];
+  int32_t busGain;                // Q15, see setBusGain()
+
+  // Phase increment and band-limited table level per MIDI note
+  uint32_t sampleRate;
+  uint32_t noteInc[MIDI_NOTE_COUNT];
+  uint8_t noteLevel[MIDI_NOTE_COUNT];
+
+  // Envelope shape (setEnvelope) and its per-sample-rate form
+  uint16_t envAttackMs, envDecayMs, envReleaseMs;
+  uint8_t envSustainLevel;
+  EnvelopeCurve envCurve;
+  int32_t envSustain;                     // Q24
+  uint32_t envSamples[ENV_STAGE_COUNT];   // Stage length
+  int32_t envSegCoef[ENV_STAGE_COUNT];    // Q30 exponential decay per ENV_CONTROL_FRAMES
+
+  // Oscillator arrays
+  uint32_t phase[MAX_VOICES];
+  uint32_t phaseInc[MAX_VOICES];
+  int32_t velocity[MAX_VOICES];   // Q15
+  int32_t panLeft[MAX_VOICES];    // Q15 pan * bus gain, set at noteOn
+  int32_t panRight[MAX_VOICES];
+  uint8_t tableLevel[MAX_VOICES]; // Band-limited table octave, set at noteOn
+  uint8_t note[MAX_VOICES];
+  uint32_t noteStart[MAX_VOICES];     // noteCounter at noteOn (age for stealing)
+  uint8_t pendingNote[MAX_VOICES];    // Note queued behind the fade (pendingMask)
+  uint8_t pendingVel[MAX_VOICES];
+  uint8_t pendingPan[MAX_VOICES];
+
+  // Envelope arrays
+  EnvStage envStage[MAX_VOICES];
+  int32_t envLevel[MAX_VOICES];   // Q24
+  int32_t envStep[MAX_VOICES];    // Q24 per sample (linear)
+  int32_t envTarget[MAX_VOICES];  // Q24 asymptote (exponential)
+  uint32_t envRemain[MAX_VOICES]; // Samples left in the current segment
+
+  // Per-voice filter memory (render() with a filter)
+  StateVariableFilter voiceFilter[MAX_VOICES];
+
+  // Per-block scratch
+  int32_t* gainBuffer;            // Q15 envelope * velocity of one voice
+  int32_t* voiceBuffer;           // One voice's oscillator, before its filter
+  uint32_t maxFrames;
+
+  uint32_t usableMask() const;
+  int pickVoice(uint8_t midiNote) const;
+  int oldestOf(uint32_t mask) const;
+  int quietestOf(uint32_t mask) const;
+  void updateEnvelopeRates();
+  void enterStage(uint8_t v, EnvStage stage);
+  uint32_t renderEnvelope(uint8_t v, uint32_t frames);
+  template <class Out>
+  void renderVoice(WaveformType wave, uint8_t v, const Out& out,
+                   uint32_t len, const int32_t* vibrato);
+  template <class Out>
+  uint32_t renderShape(WaveformType wave, uint8_t v, const Out& out,
+                       uint32_t len, const int32_t* vibrato);
+  void filterVoice(uint8_t v, int32_t* mix, uint32_t len, uint32_t frames,
+                   const SvfControl& filter);
+};
+
+#endif // AUDIO_VOICE_BANK_H
@@ -0,0 +1,1234 @@
+// AudioWavetables.cpp - ESP32 Audio OS v2.0
+// Band-limited mip-mapped wavetables
+//
+// GENERATED by host/gen_wavetables - do not edit ('make -C host wavetables')
+
+#include "AudioWavetables.h"
+
+#if USE_BANDLIMITED_TABLES
+
+const int16_t blWavetables[BL_WAVE_COUNT][BL_TABLE_LEVELS][BL_TABLE_SIZE] = {
+  { // sawtooth
+    { // level 0, 1 harmonic
+           0,   -218,   -436,   -653,   -871,  -1089,  -1306,  -1523,  -1740,  -1957,  -2173,  -2389,
+       -2605,  -2820,  -3035,  -3249,  -3463,  -3677,  -3890,  -4102,  -4313,  -4524,  -4735,  -4944,
+       -5153,  -5361,  -5569,  -5775,  -5981,  -6185,  -6389,  -6592,  -6793,  -6994,  -7194,  -7393,
+       -7590,  -7786,  -7982,  -8176,  -8368,  -8560,  -8750,  -8939,  -9126,  -9313,  -9497,  -9681,
+       -9863, -10043, -10222, -10399, -10575, -10749, -10922, -11093, -11262, -11429, -11595, -11759,
+      -11922, -12082, -12241, -12398, -12553, -12706, -12857, -13006, -13154, -13299, -13442, -13583,
+      -13723, -13860, -13995, -14128, -14259, -14387, -14514, -14638, -14760, -14880, -14998, -15113,
+      -15227, -15337, -15446, -15552, -15656, -15758, -15857, -15953, -16048, -16140, -16229, -16316,
+      -16401, -16483, -16563, -16640, -16714, -16787, -16856, -16923, -16988, -17050, -17109, -17166,
+      -17220, -17272, -17321, -17367, -17411, -17452, -17491, -17527, -17560, -17591, -17619, -17644,
+      -17667, -17687, -17704, -17719, -17731, -17740, -17747, -17751, -17752, -17751, -17747, -17740,
+      -17731, -17719, -17704, -17687, -17667, -17644, -17619, -17591, -17560, -17527, -17491, -17452,
+      -17411, -17367, -17321, -17272, -17220, -17166, -17109, -17050, -16988, -16923, -16856, -16787,
+      -16714, -16640, -16563, -16483, -16401, -16316, -16229, -16140, -16048, -15953, -15857, -15758,
+      -15656, -15552, -15446, -15337, -15227, -15113, -14998, -14880, -14760, -14638, -14514, -14387,
+      -14259, -14128, -13995, -13860, -13723, -13583, -13442, -13299, -13154, -13006, -12857, -12706,
+      -12553, -12398, -12241, -12082, -11922, -11759, -11595, -11429, -11262, -11093, -10922, -10749,
+      -10575, -10399, -10222, -10043,  -9863,  -9681,  -9497,  -9313,  -9126,  -8939,  -8750,  -8560,
+       -8368,  -8176,  -7982,  -7786,  -7590,  -7393,  -7194,  -6994,  -6793,  -6592,  -6389,  -6185,
+       -5981,  -5775,  -5569,  -5361,  -5153,  -4944,  -4735,  -4524,  -4313,  -4102,  -3890,  -3677,
+       -3463,  -3249,  -3035,  -2820,  -2605,  -2389,  -2173,  -1957,  -1740,  -1523,  -1306,  -1089,
+        -871,   -653,   -436,   -218,      0,    218,    436,    653,    871,   1089,   1306,   1523,
+        1740,   1957,   2173,   2389,   2605,   2820,   3035,   3249,   3463,   3677,   3890,   4102,
+        4313,   4524,   4735,   4944,   5153,   5361,   5569,   5775,   5981,   6185,   6389,   6592,
+        6793,   6994,   7194,   7393,   7590,   7786,   7982,   8176,   8368,   8560,   8750,   8939,
+        9126,   9313,   9497,   9681,   9863,  10043,  10222,  10399,  10575,  10749,  10922,  11093,
+       11262,  11429,  11595,  11759,  11922,  12082,  12241,  12398,  12553,  12706,  12857,  13006,
+       13154,  13299,  13442,  13583,  13723,  13860,  13995,  14128,  14259,  14387,  14514,  14638,
+       14760,  14880,  14998,  15113,  15227,  15337,  15446,  15552,  15656,  15758,  15857,  15953,
+       16048,  16140,  16229,  16316,  16401,  16483,  16563,  16640,  16714,  16787,  16856,  16923,
+       16988,  17050,  17109,  17166,  17220,  17272,  17321,  17367,  17411,  17452,  17491,  17527,
+       17560,  17591,  17619,  17644,  17667,  17687,  17704,  17719,  17731,  17740,  17747,  17751,
+       17752,  17751,  17747,  17740,  17731,  17719,  17704,  17687,  17667,  17644,  17619,  17591,
+       17560,  17527,  17491,  17452,  17411,  17367,  17321,  17272,  17220,  17166,  17109,  17050,
+       16988,  16923,  16856,  16787,  16714,  16640,  16563,  16483,  16401,  16316,  16229,  16140,
+       16048,  15953,  15857,  15758,  15656,  15552,  15446,  15337,  15227,  15113,  14998,  14880,
+       14760,  14638,  14514,  14387,  14259,  14128,  13995,  13860,  13723,  13583,  13442,  13299,
+       13154,  13006,  12857,  12706,  12553,  12398,  12241,  12082,  11922,  11759,  11595,  11429,
+       11262,  11093,  10922,  10749,  10575,  10399,  10222,  10043,   9863,   9681,   9497,   9313,
+        9126,   8939,   8750,   8560,   8368,   8176,   7982,   7786,   7590,   7393,   7194,   6994,
+        6793,   6592,   6389,   6185,   5981,   5775,   5569,   5361,   5153,   4944,   4735,   4524,
+        4313,   4102,   3890,   3677,   3463,   3249,   3035,   2820,   2605,   2389,   2173,   1957,
+        1740,   1523,   1306,   1089,    871,    653,    436,    218,
+    },
+    { // level 1, 2 harmonics
+           0,   -436,   -871,  -1306,  -1741,  -2175,  -2608,  -3041,  -3472,  -3901,  -4330,  -4756,
+       -5181,  -5604,  -6025,  -6444,  -6860,  -7274,  -7685,  -8093,  -8498,  -8899,  -9298,  -9693,
+      -10085, -10472, -10856, -11236, -11611, -11983, -12350, -12712, -13070, -13423, -13771, -14114,
+      -14451, -14784, -15111, -15433, -15749, -16059, -16363, -16662, -16954, -17241, -17521, -17795,
+      -18063, -18324, -18579, -18827, -19069, -19304, -19532, -19753, -19967, -20175, -20375, -20569,
+      -20755, -20934, -21106, -21271, -21429, -21579, -21722, -21858, -21987, -22108, -22222, -22329,
+      -22428, -22520, -22605, -22682, -22753, -22816, -22871, -22920, -22961, -22995, -23022, -23042,
+      -23055, -23060, -23059, -23051, -23036, -23015, -22986, -22951, -22909, -22861, -22806, -22745,
+      -22677, -22603, -22524, -22437, -22345, -22247, -22144, -22034, -21919, -21798, -21672, -21541,
+      -21404, -21263, -21116, -20964, -20808, -20647, -20481, -20311, -20137, -19958, -19775, -19589,
+      -19398, -19204, -19007, -18805, -18601, -18393, -18182, -17969, -17752, -17533, -17311, -17087,
+      -16861, -16632, -16402, -16169, -15935, -15699, -15462, -15223, -14983, -14743, -14501, -14258,
+      -14014, -13770, -13526, -13281, -13036, -12791, -12546, -12301, -12057, -11812, -11569, -11326,
+      -11084, -10842, -10602, -10363, -10125,  -9888,  -9652,  -9419,  -9186,  -8956,  -8727,  -8501,
+       -8276,  -8053,  -7833,  -7614,  -7399,  -7185,  -6974,  -6766,  -6560,  -6357,  -6157,  -5959,
+       -5765,  -5573,  -5385,  -5199,  -5017,  -4838,  -4662,  -4489,  -4320,  -4154,  -3992,  -3832,
+       -3677,  -3524,  -3375,  -3230,  -3088,  -2950,  -2815,  -2684,  -2556,  -2432,  -2312,  -2195,
+       -2081,  -1971,  -1865,  -1762,  -1662,  -1566,  -1473,  -1384,  -1298,  -1216,  -1137,  -1061,
+        -988,   -919,   -852,   -789,   -729,   -671,   -617,   -566,   -517,   -471,   -428,   -388,
+        -350,   -314,   -281,   -250,   -222,   -196,   -172,   -149,   -129,   -111,    -95,    -80,
+         -67,    -55,    -45,    -36,    -28,    -22,    -16,    -12,     -8,     -6,     -4,     -2,
+          -1,      0,      0,      0,      0,      0,      0,      0,      1,      2,      4,      6,
+           8,     12,     16,     22,     28,     36,     45,     55,     67,     80,     95,    111,
+         129,    149,    172,    196,    222,    250,    281,    314,    350,    388,    428,    471,
+         517,    566,    617,    671,    729,    789,    852,    919,    988,   1061,   1137,   1216,
+        1298,   1384,   1473,   1566,   1662,   1762,   1865,   1971,   2081,   2195,   2312,   2432,
+        2556,   2684,   2815,   2950,   3088,   3230,   3375,   3524,   3677,   3832,   3992,   4154,
+        4320,   4489,   4662,   4838,   5017,   5199,   5385,   5573,   5765,   5959,   6157,   6357,
+        6560,   6766,   6974,   7185,   7399,   7614,   7833,   8053,   8276,   8501,   8727,   8956,
+        9186,   9419,   9652,   9888,  10125,  10363,  10602,  10842,  11084,  11326,  11569,  11812,
+       12057,  12301,  12546,  12791,  13036,  13281,  13526,  13770,  14014,  14258,  14501,  14743,
+       14983,  15223,  15462,  15699,  15935,  16169,  16402,  16632,  16861,  17087,  17311,  17533,
+       17752,  17969,  18182,  18393,  18601,  18805,  19007,  19204,  19398,  19589,  19775,  19958,
+       20137,  20311,  20481,  20647,  20808,  20964,  21116,  21263,  21404,  21541,  21672,  21798,
+       21919,  22034,  22144,  22247,  22345,  22437,  22524,  22603,  22677,  22745,  22806,  22861,
+       22909,  22951,  22986,  23015,  23036,  23051,  23059,  23060,  23055,  23042,  23022,  22995,
+       22961,  22920,  22871,  22816,  22753,  22682,  22605,  22520,  22428,  22329,  22222,  22108,
+       21987,  21858,  21722,  21579,  21429,  21271,  21106,  20934,  20755,  20569,  20375,  20175,
+       19967,  19753,  19532,  19304,  19069,  18827,  18579,  18324,  18063,  17795,  17521,  17241,
+       16954,  16662,  16363,  16059,  15749,  15433,  15111,  14784,  14451,  14114,  13771,  13423,
+       13070,  12712,  12350,  11983,  11611,  11236,  10856,  10472,  10085,   9693,   9298,   8899,
+        8498,   8093,   7685,   7274,   6860,   6444,   6025,   5604,   5181,   4756,   4330,   3901,
+        3472,   3041,   2608,   2175,   1741,   1306,    871,    436,
+    },
+    { // level 2, 4 harmonics
+           0,   -871,  -1742,  -2610,  -3475,  -4337,  -5193,  -6044,  -6888,  -7724,  -8552,  -9370,
+      -10177, -10973, -11757, -12528, -13286, -14028, -14756, -15467, -16162, -16839, -17498, -18138,
+      -18759, -19360, -19941, -20501, -21040, -21557, -22052, -22525, -22975, -23402, -23806, -24187,
+      -24544, -24878, -25188, -25475, -25738, -25977, -26193, -26386, -26555, -26701, -26825, -26926,
+      -27005, -27062, -27098, -27112, -27106, -27080, -27034, -26968, -26885, -26782, -26663, -26527,
+      -26374, -26205, -26022, -25824, -25613, -25389, -25152, -24905, -24646, -24377, -24100, -23813,
+      -23519, -23218, -22911, -22598, -22280, -21959, -21634, -21306, -20977, -20647, -20316, -19985,
+      -19655, -19326, -19000, -18676, -18356, -18040, -17727, -17420, -17119, -16823, -16533, -16250,
+      -15975, -15707, -15446, -15194, -14951, -14716, -14489, -14273, -14065, -13867, -13678, -13499,
+      -13330, -13170, -13020, -12880, -12750, -12629, -12517, -12415, -12322, -12238, -12162, -12096,
+      -12037, -11987, -11945, -11910, -11882, -11861, -11846, -11838, -11835, -11837, -11845, -11857,
+      -11873, -11893, -11916, -11942, -11971, -12001, -12033, -12066, -12100, -12134, -12167, -12200,
+      -12232, -12263, -12292, -12318, -12342, -12362, -12380, -12393, -12403, -12408, -12408, -12404,
+      -12394, -12379, -12358, -12331, -12298, -12259, -12213, -12161, -12101, -12036, -11963, -11883,
+      -11796, -11702, -11601, -11494, -11379, -11257, -11129, -10994, -10853, -10705, -10550, -10390,
+      -10224, -10052,  -9875,  -9692,  -9505,  -9313,  -9116,  -8916,  -8711,  -8503,  -8292,  -8078,
+       -7861,  -7642,  -7421,  -7199,  -6975,  -6751,  -6526,  -6301,  -6077,  -5853,  -5629,  -5407,
+       -5187,  -4968,  -4752,  -4539,  -4328,  -4120,  -3916,  -3715,  -3519,  -3326,  -3138,  -2955,
+       -2777,  -2604,  -2436,  -2273,  -2116,  -1965,  -1819,  -1680,  -1546,  -1418,  -1297,  -1182,
+       -1072,   -969,   -872,   -781,   -696,   -617,   -543,   -475,   -413,   -356,   -304,   -258,
+        -216,   -179,   -146,   -117,    -93,    -72,    -54,    -39,    -28,    -19,    -12,     -7,
+          -3,     -1,      0,      0,      0,      0,      0,      1,      3,      7,     12,     19,
+          28,     39,     54,     72,     93,    117,    146,    179,    216,    258,    304,    356,
+         413,    475,    543,    617,    696,    781,    872,    969,   1072,   1182,   1297,   1418,
+        1546,   1680,   1819,   1965,   2116,   2273,   2436,   2604,   2777,   2955,   3138,   3326,
+        3519,   3715,   3916,   4120,   4328,   4539,   4752,   4968,   5187,   5407,   5629,   5853,
+        6077,   6301,   6526,   6751,   6975,   7199,   7421,   7642,   7861,   8078,   8292,   8503,
+        8711,   8916,   9116,   9313,   9505,   9692,   9875,  10052,  10224,  10390,  10550,  10705,
+       10853,  10994,  11129,  11257,  11379,  11494,  11601,  11702,  11796,  11883,  11963,  12036,
+       12101,  12161,  12213,  12259,  12298,  12331,  12358,  12379,  12394,  12404,  12408,  12408,
+       12403,  12393,  12380,  12362,  12342,  12318,  12292,  12263,  12232,  12200,  12167,  12134,
+       12100,  12066,  12033,  12001,  11971,  11942,  11916,  11893,  11873,  11857,  11845,  11837,
+       11835,  11838,  11846,  11861,  11882,  11910,  11945,  11987,  12037,  12096,  12162,  12238,
+       12322,  12415,  12517,  12629,  12750,  12880,  13020,  13170,  13330,  13499,  13678,  13867,
+       14065,  14273,  14489,  14716,  14951,  15194,  15446,  15707,  15975,  16250,  16533,  16823,
+       17119,  17420,  17727,  18040,  18356,  18676,  19000,  19326,  19655,  19985,  20316,  20647,
+       20977,  21306,  21634,  21959,  22280,  22598,  22911,  23218,  23519,  23813,  24100,  24377,
+       24646,  24905,  25152,  25389,  25613,  25824,  26022,  26205,  26374,  26527,  26663,  26782,
+       26885,  26968,  27034,  27080,  27106,  27112,  27098,  27062,  27005,  26926,  26825,  26701,
+       26555,  26386,  26193,  25977,  25738,  25475,  25188,  24878,  24544,  24187,  23806,  23402,
+       22975,  22525,  22052,  21557,  21040,  20501,  19941,  19360,  18759,  18138,  17498,  16839,
+       16162,  15467,  14756,  14028,  13286,  12528,  11757,  10973,  10177,   9370,   8552,   7724,
+        6888,   6044,   5193,   4337,   3475,   2610,   1742,    871,
+    },
+    { // level 3, 8 harmonics
+           0,  -1742,  -3477,  -5198,  -6900,  -8576, -10219, -11823, -13383, -14893, -16348, -17743,
+      -19074, -20336, -21526, -22641, -23678, -24634, -25509, -26300, -27008, -27631, -28170, -28626,
+      -29000, -29293, -29508, -29647, -29713, -29710, -29640, -29508, -29318, -29074, -28781, -28443,
+      -28066, -27654, -27213, -26747, -26262, -25762, -25252, -24737, -24222, -23710, -23207, -22714,
+      -22238, -21780, -21343, -20931, -20545, -20187, -19860, -19564, -19301, -19070, -18873, -18708,
+      -18575, -18475, -18405, -18364, -18351, -18363, -18399, -18457, -18534, -18628, -18736, -18855,
+      -18982, -19116, -19252, -19389, -19524, -19654, -19776, -19889, -19991, -20078, -20151, -20206,
+      -20242, -20259, -20256, -20231, -20185, -20116, -20026, -19914, -19780, -19627, -19453, -19261,
+      -19051, -18826, -18585, -18333, -18069, -17796, -17516, -17230, -16941, -16651, -16362, -16075,
+      -15792, -15516, -15248, -14989, -14742, -14506, -14285, -14078, -13886, -13710, -13551, -13408,
+      -13283, -13174, -13083, -13007, -12948, -12903, -12872, -12855, -12849, -12854, -12869, -12891,
+      -12920, -12953, -12990, -13029, -13067, -13104, -13138, -13167, -13190, -13205, -13212, -13209,
+      -13196, -13170, -13132, -13081, -13016, -12936, -12843, -12735, -12613, -12478, -12329, -12166,
+      -11992, -11806, -11610, -11404, -11190, -10969, -10742, -10510, -10276, -10039,  -9802,  -9566,
+       -9332,  -9102,  -8877,  -8658,  -8446,  -8243,  -8049,  -7865,  -7693,  -7531,  -7382,  -7245,
+       -7121,  -7009,  -6910,  -6824,  -6750,  -6687,  -6636,  -6595,  -6563,  -6541,  -6526,  -6518,
+       -6516,  -6518,  -6523,  -6530,  -6538,  -6545,  -6551,  -6553,  -6551,  -6544,  -6530,  -6509,
+       -6480,  -6441,  -6392,  -6333,  -6263,  -6181,  -6088,  -5983,  -5866,  -5737,  -5597,  -5446,
+       -5285,  -5113,  -4933,  -4743,  -4547,  -4343,  -4134,  -3921,  -3705,  -3486,  -3266,  -3047,
+       -2829,  -2614,  -2402,  -2196,  -1995,  -1801,  -1615,  -1438,  -1270,  -1112,   -965,   -828,
+        -703,   -589,   -486,   -395,   -315,   -246,   -187,   -137,    -97,    -66,    -42,    -24,
+         -12,     -5,     -2,      0,      0,      0,      2,      5,     12,     24,     42,     66,
+          97,    137,    187,    246,    315,    395,    486,    589,    703,    828,    965,   1112,
+        1270,   1438,   1615,   1801,   1995,   2196,   2402,   2614,   2829,   3047,   3266,   3486,
+        3705,   3921,   4134,   4343,   4547,   4743,   4933,   5113,   5285,   5446,   5597,   5737,
+        5866,   5983,   6088,   6181,   6263,   6333,   6392,   6441,   6480,   6509,   6530,   6544,
+        6551,   6553,   6551,   6545,   6538,   6530,   6523,   6518,   6516,   6518,   6526,   6541,
+        6563,   6595,   6636,   6687,   6750,   6824,   6910,   7009,   7121,   7245,   7382,   7531,
+        7693,   7865,   8049,   8243,   8446,   8658,   8877,   9102,   9332,   9566,   9802,  10039,
+       10276,  10510,  10742,  10969,  11190,  11404,  11610,  11806,  11992,  12166,  12329,  12478,
+       12613,  12735,  12843,  12936,  13016,  13081,  13132,  13170,  13196,  13209,  13212,  13205,
+       13190,  13167,  13138,  13104,  13067,  13029,  12990,  12953,  12920,  12891,  12869,  12854,
+       12849,  12855,  12872,  12903,  12948,  13007,  13083,  13174,  13283,  13408,  13551,  13710,
+       13886,  14078,  14285,  14506,  14742,  14989,  15248,  15516,  15792,  16075,  16362,  16651,
+       16941,  17230,  17516,  17796,  18069,  18333,  18585,  18826,  19051,  19261,  19453,  19627,
+       19780,  19914,  20026,  20116,  20185,  20231,  20256,  20259,  20242,  20206,  20151,  20078,
+       19991,  19889,  19776,  19654,  19524,  19389,  19252,  19116,  18982,  18855,  18736,  18628,
+       18534,  18457,  18399,  18363,  18351,  18364,  18405,  18475,  18575,  18708,  18873,  19070,
+       19301,  19564,  19860,  20187,  20545,  20931,  21343,  21780,  22238,  22714,  23207,  23710,
+       24222,  24737,  25252,  25762,  26262,  26747,  27213,  27654,  28066,  28443,  28781,  29074,
+       29318,  29508,  29640,  29710,  29713,  29647,  29508,  29293,  29000,  28626,  28170,  27631,
+       27008,  26300,  25509,  24634,  23678,  22641,  21526,  20336,  19074,  17743,  16348,  14893,
+       13383,  11823,  10219,   8576,   6900,   5198,   3477,   1742,
+    },
+    { // level 4, 16 harmonics
+           0,  -3477,  -6906, -10238, -13429, -16437, -19223, -21757, -24012, -25968, -27613, -28942,
+      -29956, -30663, -31077, -31219, -31115, -30794, -30289, -29635, -28869, -28026, -27143, -26254,
+      -25389, -24576, -23839, -23196, -22663, -22247, -21953, -21782, -21726, -21778, -21924, -22149,
+      -22436, -22765, -23117, -23472, -23811, -24118, -24378, -24577, -24707, -24760, -24734, -24629,
+      -24448, -24196, -23882, -23517, -23113, -22684, -22242, -21802, -21377, -20979, -20619, -20306,
+      -20046, -19844, -19701, -19618, -19591, -19616, -19685, -19791, -19923, -20071, -20224, -20372,
+      -20505, -20612, -20687, -20721, -20712, -20655, -20550, -20397, -20200, -19963, -19693, -19395,
+      -19080, -18754, -18429, -18111, -17809, -17532, -17284, -17072, -16898, -16765, -16673, -16620,
+      -16603, -16618, -16660, -16721, -16794, -16873, -16949, -17015, -17063, -17089, -17086, -17051,
+      -16981, -16876, -16736, -16562, -16358, -16128, -15877, -15612, -15339, -15064, -14795, -14537,
+      -14297, -14080, -13890, -13730, -13601, -13504, -13438, -13401, -13390, -13400, -13426, -13463,
+      -13504, -13543, -13575, -13594, -13595, -13572, -13525, -13449, -13344, -13210, -13048, -12862,
+      -12654, -12428, -12189, -11944, -11697, -11453, -11220, -11001, -10800, -10622, -10469, -10343,
+      -10243, -10170, -10122, -10095, -10087, -10094, -10109, -10130, -10149, -10162, -10163, -10150,
+      -10117, -10062,  -9982,  -9878,  -9748,  -9593,  -9417,  -9221,  -9010,  -8787,  -8558,  -8326,
+       -8098,  -7879,  -7671,  -7480,  -7309,  -7160,  -7035,  -6933,  -6856,  -6801,  -6765,  -6747,
+       -6742,  -6746,  -6754,  -6761,  -6763,  -6755,  -6733,  -6694,  -6635,  -6554,  -6450,  -6322,
+       -6172,  -6002,  -5813,  -5610,  -5396,  -5176,  -4954,  -4734,  -4522,  -4321,  -4135,  -3968,
+       -3821,  -3696,  -3593,  -3513,  -3454,  -3414,  -3390,  -3378,  -3376,  -3377,  -3378,  -3374,
+       -3362,  -3336,  -3294,  -3233,  -3151,  -3047,  -2921,  -2774,  -2607,  -2422,  -2223,  -2013,
+       -1797,  -1579,  -1363,  -1154,   -956,   -772,   -606,   -459,   -334,   -231,   -149,    -88,
+         -46,    -20,     -6,     -1,      0,      1,      6,     20,     46,     88,    149,    231,
+         334,    459,    606,    772,    956,   1154,   1363,   1579,   1797,   2013,   2223,   2422,
+        2607,   2774,   2921,   3047,   3151,   3233,   3294,   3336,   3362,   3374,   3378,   3377,
+        3376,   3378,   3390,   3414,   3454,   3513,   3593,   3696,   3821,   3968,   4135,   4321,
+        4522,   4734,   4954,   5176,   5396,   5610,   5813,   6002,   6172,   6322,   6450,   6554,
+        6635,   6694,   6733,   6755,   6763,   6761,   6754,   6746,   6742,   6747,   6765,   6801,
+        6856,   6933,   7035,   7160,   7309,   7480,   7671,   7879,   8098,   8326,   8558,   8787,
+        9010,   9221,   9417,   9593,   9748,   9878,   9982,  10062,  10117,  10150,  10163,  10162,
+       10149,  10130,  10109,  10094,  10087,  10095,  10122,  10170,  10243,  10343,  10469,  10622,
+       10800,  11001,  11220,  11453,  11697,  11944,  12189,  12428,  12654,  12862,  13048,  13210,
+       13344,  13449,  13525,  13572,  13595,  13594,  13575,  13543,  13504,  13463,  13426,  13400,
+       13390,  13401,  13438,  13504,  13601,  13730,  13890,  14080,  14297,  14537,  14795,  15064,
+       15339,  15612,  15877,  16128,  16358,  16562,  16736,  16876,  16981,  17051,  17086,  17089,
+       17063,  17015,  16949,  16873,  16794,  16721,  16660,  16618,  16603,  16620,  16673,  16765,
+       16898,  17072,  17284,  17532,  17809,  18111,  18429,  18754,  19080,  19395,  19693,  19963,
+       20200,  20397,  20550,  20655,  20712,  20721,  20687,  20612,  20505,  20372,  20224,  20071,
+       19923,  19791,  19685,  19616,  19591,  19618,  19701,  19844,  20046,  20306,  20619,  20979,
+       21377,  21802,  22242,  22684,  23113,  23517,  23882,  24196,  24448,  24629,  24734,  24760,
+       24707,  24577,  24378,  24118,  23811,  23472,  23117,  22765,  22436,  22149,  21924,  21778,
+       21726,  21782,  21953,  22247,  22663,  23196,  23839,  24576,  25389,  26254,  27143,  28026,
+       28869,  29635,  30289,  30794,  31115,  31219,  31077,  30663,  29956,  28942,  27613,  25968,
+       24012,  21757,  19223,  16437,  13429,  10238,   6906,   3477,
+    },
+    { // level 5, 32 harmonics
+           0,  -6909, -13452, -19296, -24174, -27909, -30424, -31746, -32000, -31388, -30163, -28601,
+      -26969, -25499, -24364, -23668, -23442, -23645, -24182, -24922, -25717, -26427, -26937, -27171,
+      -27103, -26749, -26170, -25453, -24700, -24011, -23470, -23133, -23022, -23123, -23392, -23762,
+      -24153, -24489, -24705, -24756, -24627, -24329, -23899, -23393, -22875, -22408, -22045, -21821,
+      -21747, -21813, -21986, -22218, -22455, -22643, -22738, -22713, -22557, -22284, -21922, -21513,
+      -21105, -20745, -20469, -20301, -20246, -20294, -20416, -20576, -20729, -20837, -20866, -20797,
+      -20627, -20368, -20045, -19693, -19351, -19054, -18830, -18696, -18653, -18690, -18781, -18894,
+      -18995, -19051, -19037, -18941, -18762, -18512, -18214, -17900, -17602, -17347, -17159, -17048,
+      -17014, -17042, -17111, -17193, -17257, -17277, -17233, -17117, -16930, -16687, -16409, -16122,
+      -15855, -15632, -15470, -15377, -15348, -15371, -15423, -15481, -15517, -15509, -15443, -15311,
+      -15120, -14882, -14618, -14352, -14110, -13911, -13770, -13690, -13665, -13684, -13724, -13762,
+      -13776, -13746, -13661, -13518, -13322, -13088, -12836, -12588, -12366, -12187, -12062, -11993,
+      -11972, -11987, -12016, -12039, -12034, -11987, -11887, -11733, -11534, -11303, -11061, -10827,
+      -10622, -10460, -10349, -10289, -10272, -10283, -10303, -10313, -10293, -10229, -10116,  -9954,
+       -9752,  -9524,  -9290,  -9069,  -8878,  -8731,  -8632,  -8580,  -8566,  -8574,  -8587,  -8584,
+       -8550,  -8473,  -8349,  -8179,  -7974,  -7749,  -7522,  -7312,  -7135,  -7000,  -6913,  -6868,
+       -6856,  -6862,  -6868,  -6854,  -6808,  -6719,  -6583,  -6406,  -6199,  -5977,  -5757,  -5557,
+       -5392,  -5269,  -5191,  -5154,  -5144,  -5148,  -5147,  -5124,  -5065,  -4964,  -4819,  -4636,
+       -4426,  -4206,  -3993,  -3803,  -3649,  -3537,  -3469,  -3438,  -3430,  -3432,  -3424,  -3392,
+       -3323,  -3211,  -3057,  -2867,  -2655,  -2437,  -2230,  -2049,  -1906,  -1805,  -1746,  -1720,
+       -1716,  -1715,  -1701,  -1660,  -1580,  -1458,  -1294,  -1099,   -885,   -669,   -468,   -296,
+        -163,    -73,    -22,     -3,      0,      3,     22,     73,    163,    296,    468,    669,
+         885,   1099,   1294,   1458,   1580,   1660,   1701,   1715,   1716,   1720,   1746,   1805,
+        1906,   2049,   2230,   2437,   2655,   2867,   3057,   3211,   3323,   3392,   3424,   3432,
+        3430,   3438,   3469,   3537,   3649,   3803,   3993,   4206,   4426,   4636,   4819,   4964,
+        5065,   5124,   5147,   5148,   5144,   5154,   5191,   5269,   5392,   5557,   5757,   5977,
+        6199,   6406,   6583,   6719,   6808,   6854,   6868,   6862,   6856,   6868,   6913,   7000,
+        7135,   7312,   7522,   7749,   7974,   8179,   8349,   8473,   8550,   8584,   8587,   8574,
+        8566,   8580,   8632,   8731,   8878,   9069,   9290,   9524,   9752,   9954,  10116,  10229,
+       10293,  10313,  10303,  10283,  10272,  10289,  10349,  10460,  10622,  10827,  11061,  11303,
+       11534,  11733,  11887,  11987,  12034,  12039,  12016,  11987,  11972,  11993,  12062,  12187,
+       12366,  12588,  12836,  13088,  13322,  13518,  13661,  13746,  13776,  13762,  13724,  13684,
+       13665,  13690,  13770,  13911,  14110,  14352,  14618,  14882,  15120,  15311,  15443,  15509,
+       15517,  15481,  15423,  15371,  15348,  15377,  15470,  15632,  15855,  16122,  16409,  16687,
+       16930,  17117,  17233,  17277,  17257,  17193,  17111,  17042,  17014,  17048,  17159,  17347,
+       17602,  17900,  18214,  18512,  18762,  18941,  19037,  19051,  18995,  18894,  18781,  18690,
+       18653,  18696,  18830,  19054,  19351,  19693,  20045,  20368,  20627,  20797,  20866,  20837,
+       20729,  20576,  20416,  20294,  20246,  20301,  20469,  20745,  21105,  21513,  21922,  22284,
+       22557,  22713,  22738,  22643,  22455,  22218,  21986,  21813,  21747,  21821,  22045,  22408,
+       22875,  23393,  23899,  24329,  24627,  24756,  24705,  24489,  24153,  23762,  23392,  23123,
+       23022,  23133,  23470,  24011,  24700,  25453,  26170,  26749,  27103,  27171,  26937,  26427,
+       25717,  24922,  24182,  23645,  23442,  23668,  24364,  25499,  26969,  28601,  30163,  31388,
+       32000,  31746,  30424,  27909,  24174,  19296,  13452,   6909,
+    },
+    { // level 6, 64 harmonics
+           0, -13463, -24255, -30655, -32439, -30808, -27760, -25219, -24306, -25060, -26669, -28044,
+      -28420, -27691, -26362, -25192, -24751, -25136, -25976, -26689, -26822, -26297, -25409, -24634,
+      -24341, -24597, -25149, -25598, -25631, -25196, -24511, -23924, -23704, -23894, -24295, -24602,
+      -24580, -24195, -23627, -23151, -22976, -23124, -23432, -23651, -23593, -23241, -22750, -22347,
+      -22200, -22321, -22566, -22723, -22640, -22312, -21875, -21524, -21398, -21499, -21697, -21809,
+      -21709, -21398, -21001, -20689, -20579, -20665, -20828, -20905, -20791, -20493, -20128, -19847,
+      -19749, -19824, -19958, -20008, -19882, -19595, -19255, -18999, -18912, -18976, -19087, -19115,
+      -18980, -18702, -18383, -18148, -18068, -18125, -18217, -18225, -18083, -17812, -17511, -17293,
+      -17221, -17270, -17346, -17338, -17189, -16925, -16639, -16436, -16370, -16413, -16475, -16453,
+      -16299, -16040, -15767, -15577, -15516, -15555, -15604, -15570, -15410, -15157, -14896, -14717,
+      -14661, -14695, -14732, -14688, -14524, -14275, -14024, -13856, -13804, -13833, -13861, -13807,
+      -13639, -13394, -13152, -12993, -12945, -12971, -12990, -12927, -12755, -12513, -12281, -12130,
+      -12086, -12108, -12119, -12047, -11872, -11634, -11409, -11267, -11225, -11245, -11248, -11168,
+      -10990, -10755, -10538, -10403, -10364, -10380, -10376, -10290, -10109,  -9877,  -9666,  -9538,
+       -9502,  -9516,  -9505,  -9412,  -9228,  -8999,  -8795,  -8673,  -8640,  -8651,  -8634,  -8535,
+       -8348,  -8121,  -7923,  -7807,  -7777,  -7785,  -7762,  -7657,  -7468,  -7244,  -7052,  -6942,
+       -6914,  -6920,  -6891,  -6780,  -6589,  -6367,  -6180,  -6076,  -6050,  -6054,  -6019,  -5903,
+       -5710,  -5490,  -5309,  -5210,  -5186,  -5188,  -5148,  -5027,  -4831,  -4613,  -4437,  -4344,
+       -4322,  -4321,  -4277,  -4150,  -3952,  -3737,  -3566,  -3477,  -3458,  -3455,  -3405,  -3274,
+       -3074,  -2860,  -2695,  -2611,  -2594,  -2589,  -2534,  -2397,  -2196,  -1984,  -1823,  -1744,
+       -1729,  -1722,  -1663,  -1521,  -1317,  -1108,   -952,   -878,   -865,   -856,   -791,   -645,
+        -439,   -231,    -80,    -11,      0,     11,     80,    231,    439,    645,    791,    856,
+         865,    878,    952,   1108,   1317,   1521,   1663,   1722,   1729,   1744,   1823,   1984,
+        2196,   2397,   2534,   2589,   2594,   2611,   2695,   2860,   3074,   3274,   3405,   3455,
+        3458,   3477,   3566,   3737,   3952,   4150,   4277,   4321,   4322,   4344,   4437,   4613,
+        4831,   5027,   5148,   5188,   5186,   5210,   5309,   5490,   5710,   5903,   6019,   6054,
+        6050,   6076,   6180,   6367,   6589,   6780,   6891,   6920,   6914,   6942,   7052,   7244,
+        7468,   7657,   7762,   7785,   7777,   7807,   7923,   8121,   8348,   8535,   8634,   8651,
+        8640,   8673,   8795,   8999,   9228,   9412,   9505,   9516,   9502,   9538,   9666,   9877,
+       10109,  10290,  10376,  10380,  10364,  10403,  10538,  10755,  10990,  11168,  11248,  11245,
+       11225,  11267,  11409,  11634,  11872,  12047,  12119,  12108,  12086,  12130,  12281,  12513,
+       12755,  12927,  12990,  12971,  12945,  12993,  13152,  13394,  13639,  13807,  13861,  13833,
+       13804,  13856,  14024,  14275,  14524,  14688,  14732,  14695,  14661,  14717,  14896,  15157,
+       15410,  15570,  15604,  15555,  15516,  15577,  15767,  16040,  16299,  16453,  16475,  16413,
+       16370,  16436,  16639,  16925,  17189,  17338,  17346,  17270,  17221,  17293,  17511,  17812,
+       18083,  18225,  18217,  18125,  18068,  18148,  18383,  18702,  18980,  19115,  19087,  18976,
+       18912,  18999,  19255,  19595,  19882,  20008,  19958,  19824,  19749,  19847,  20128,  20493,
+       20791,  20905,  20828,  20665,  20579,  20689,  21001,  21398,  21709,  21809,  21697,  21499,
+       21398,  21524,  21875,  22312,  22640,  22723,  22566,  22321,  22200,  22347,  22750,  23241,
+       23593,  23651,  23432,  23124,  22976,  23151,  23627,  24195,  24580,  24602,  24295,  23894,
+       23704,  23924,  24511,  25196,  25631,  25598,  25149,  24597,  24341,  24634,  25409,  26297,
+       26822,  26689,  25976,  25136,  24751,  25192,  26362,  27691,  28420,  28044,  26669,  25060,
+       24306,  25219,  27760,  30808,  32439,  30655,  24255,  13463,
+    },
+    { // level 7, 128 harmonics
+           0, -24294, -32658, -28156, -24740, -27144, -29076, -27194, -25619, -26888, -27916, -26676,
+      -25643, -26496, -27162, -26214, -25440, -26078, -26548, -25766, -25145, -25651, -25998, -25324,
+      -24804, -25220, -25484, -24885, -24436, -24787, -24989, -24447, -24051, -24353, -24509, -24009,
+      -23655, -23919, -24038, -23572, -23251, -23484, -23573, -23136, -22842, -23049, -23114, -22700,
+      -22428, -22614, -22658, -22263, -22011, -22179, -22205, -21827, -21592, -21743, -21754, -21391,
+      -21170, -21308, -21305, -20955, -20746, -20872, -20858, -20519, -20322, -20437, -20412, -20084,
+      -19896, -20001, -19967, -19648, -19469, -19566, -19523, -19212, -19041, -19130, -19079, -18776,
+      -18613, -18695, -18636, -18340, -18184, -18259, -18194, -17904, -17754, -17823, -17753, -17469,
+      -17324, -17388, -17311, -17033, -16894, -16952, -16871, -16597, -16463, -16516, -16430, -16161,
+      -16032, -16081, -15990, -15726, -15601, -15645, -15550, -15290, -15169, -15209, -15110, -14854,
+      -14737, -14774, -14671, -14418, -14305, -14338, -14231, -13983, -13873, -13902, -13792, -13547,
+      -13441, -13467, -13353, -13111, -13008, -13031, -12915, -12676, -12576, -12595, -12476, -12240,
+      -12143, -12160, -12037, -11804, -11710, -11724, -11599, -11368, -11277, -11288, -11161, -10933,
+      -10844, -10853, -10722, -10497, -10411, -10417, -10284, -10061,  -9977,  -9981,  -9846,  -9625,
+       -9544,  -9546,  -9408,  -9190,  -9111,  -9110,  -8970,  -8754,  -8677,  -8674,  -8532,  -8318,
+       -8243,  -8238,  -8094,  -7883,  -7810,  -7803,  -7657,  -7447,  -7376,  -7367,  -7219,  -7011,
+       -6943,  -6931,  -6781,  -6575,  -6509,  -6496,  -6343,  -6140,  -6075,  -6060,  -5906,  -5704,
+       -5641,  -5624,  -5468,  -5268,  -5207,  -5189,  -5031,  -4833,  -4774,  -4753,  -4593,  -4397,
+       -4340,  -4317,  -4156,  -3961,  -3906,  -3881,  -3718,  -3526,  -3472,  -3446,  -3281,  -3090,
+       -3038,  -3010,  -2843,  -2654,  -2604,  -2574,  -2406,  -2218,  -2170,  -2139,  -1968,  -1783,
+       -1736,  -1703,  -1531,  -1347,  -1302,  -1267,  -1094,   -911,   -868,   -832,   -656,   -476,
+        -434,   -396,   -219,    -40,      0,     40,    219,    396,    434,    476,    656,    832,
+         868,    911,   1094,   1267,   1302,   1347,   1531,   1703,   1736,   1783,   1968,   2139,
+        2170,   2218,   2406,   2574,   2604,   2654,   2843,   3010,   3038,   3090,   3281,   3446,
+        3472,   3526,   3718,   3881,   3906,   3961,   4156,   4317,   4340,   4397,   4593,   4753,
+        4774,   4833,   5031,   5189,   5207,   5268,   5468,   5624,   5641,   5704,   5906,   6060,
+        6075,   6140,   6343,   6496,   6509,   6575,   6781,   6931,   6943,   7011,   7219,   7367,
+        7376,   7447,   7657,   7803,   7810,   7883,   8094,   8238,   8243,   8318,   8532,   8674,
+        8677,   8754,   8970,   9110,   9111,   9190,   9408,   9546,   9544,   9625,   9846,   9981,
+        9977,  10061,  10284,  10417,  10411,  10497,  10722,  10853,  10844,  10933,  11161,  11288,
+       11277,  11368,  11599,  11724,  11710,  11804,  12037,  12160,  12143,  12240,  12476,  12595,
+       12576,  12676,  12915,  13031,  13008,  13111,  13353,  13467,  13441,  13547,  13792,  13902,
+       13873,  13983,  14231,  14338,  14305,  14418,  14671,  14774,  14737,  14854,  15110,  15209,
+       15169,  15290,  15550,  15645,  15601,  15726,  15990,  16081,  16032,  16161,  16430,  16516,
+       16463,  16597,  16871,  16952,  16894,  17033,  17311,  17388,  17324,  17469,  17753,  17823,
+       17754,  17904,  18194,  18259,  18184,  18340,  18636,  18695,  18613,  18776,  19079,  19130,
+       19041,  19212,  19523,  19566,  19469,  19648,  19967,  20001,  19896,  20084,  20412,  20437,
+       20322,  20519,  20858,  20872,  20746,  20955,  21305,  21308,  21170,  21391,  21754,  21743,
+       21592,  21827,  22205,  22179,  22011,  22263,  22658,  22614,  22428,  22700,  23114,  23049,
+       22842,  23136,  23573,  23484,  23251,  23572,  24038,  23919,  23655,  24009,  24509,  24353,
+       24051,  24447,  24989,  24787,  24436,  24885,  25484,  25220,  24804,  25324,  25998,  25651,
+       25145,  25766,  26548,  26078,  25440,  26214,  27162,  26496,  25643,  26676,  27916,  26888,
+       25619,  27194,  29076,  27144,  24740,  28156,  32658,  24294,
+    },
+    { // level 8, 255 harmonics
+           0, -32767, -24958, -29404, -26054, -28462, -26295, -27926, -26310, -27530, -26233, -27199,
+      -26109, -26902, -25958, -26627, -25791, -26364, -25612, -26111, -25426, -25865, -25234, -25624,
+      -25037, -25386, -24838, -25151, -24635, -24919, -24431, -24688, -24225, -24459, -24018, -24232,
+      -23809, -24005, -23600, -23779, -23390, -23554, -23179, -23330, -22967, -23106, -22755, -22882,
+      -22542, -22660, -22329, -22437, -22116, -22215, -21902, -21993, -21688, -21771, -21474, -21550,
+      -21260, -21329, -21045, -21108, -20830, -20887, -20615, -20667, -20400, -20446, -20185, -20226,
+      -19969, -20006, -19754, -19786, -19538, -19566, -19322, -19346, -19106, -19126, -18890, -18906,
+      -18674, -18687, -18458, -18467, -18242, -18248, -18025, -18028, -17809, -17809, -17593, -17590,
+      -17376, -17370, -17160, -17151, -16943, -16932, -16727, -16713, -16510, -16494, -16293, -16275,
+      -16077, -16056, -15860, -15837, -15643, -15618, -15426, -15399, -15209, -15180, -14993, -14962,
+      -14776, -14743, -14559, -14524, -14342, -14305, -14125, -14087, -13908, -13868, -13691, -13649,
+      -13474, -13431, -13257, -13212, -13040, -12993, -12823, -12775, -12606, -12556, -12388, -12337,
+      -12171, -12119, -11954, -11900, -11737, -11682, -11520, -11463, -11303, -11245, -11085, -11026,
+      -10868, -10808, -10651, -10589, -10434, -10371, -10217, -10152,  -9999,  -9934,  -9782,  -9716,
+       -9565,  -9497,  -9347,  -9279,  -9130,  -9060,  -8913,  -8842,  -8696,  -8623,  -8478,  -8405,
+       -8261,  -8187,  -8044,  -7968,  -7826,  -7750,  -7609,  -7532,  -7392,  -7313,  -7174,  -7095,
+       -6957,  -6876,  -6740,  -6658,  -6522,  -6440,  -6305,  -6221,  -6087,  -6003,  -5870,  -5785,
+       -5653,  -5566,  -5435,  -5348,  -5218,  -5130,  -5001,  -4912,  -4783,  -4693,  -4566,  -4475,
+       -4348,  -4257,  -4131,  -4038,  -3914,  -3820,  -3696,  -3602,  -3479,  -3383,  -3261,  -3165,
+       -3044,  -2947,  -2827,  -2729,  -2609,  -2510,  -2392,  -2292,  -2174,  -2074,  -1957,  -1855,
+       -1739,  -1637,  -1522,  -1419,  -1305,  -1201,  -1087,   -982,   -870,   -764,   -652,   -546,
+        -435,   -327,   -217,   -109,      0,    109,    217,    327,    435,    546,    652,    764,
+         870,    982,   1087,   1201,   1305,   1419,   1522,   1637,   1739,   1855,   1957,   2074,
+        2174,   2292,   2392,   2510,   2609,   2729,   2827,   2947,   3044,   3165,   3261,   3383,
+        3479,   3602,   3696,   3820,   3914,   4038,   4131,   4257,   4348,   4475,   4566,   4693,
+        4783,   4912,   5001,   5130,   5218,   5348,   5435,   5566,   5653,   5785,   5870,   6003,
+        6087,   6221,   6305,   6440,   6522,   6658,   6740,   6876,   6957,   7095,   7174,   7313,
+        7392,   7532,   7609,   7750,   7826,   7968,   8044,   8187,   8261,   8405,   8478,   8623,
+        8696,   8842,   8913,   9060,   9130,   9279,   9347,   9497,   9565,   9716,   9782,   9934,
+        9999,  10152,  10217,  10371,  10434,  10589,  10651,  10808,  10868,  11026,  11085,  11245,
+       11303,  11463,  11520,  11682,  11737,  11900,  11954,  12119,  12171,  12337,  12388,  12556,
+       12606,  12775,  12823,  12993,  13040,  13212,  13257,  13431,  13474,  13649,  13691,  13868,
+       13908,  14087,  14125,  14305,  14342,  14524,  14559,  14743,  14776,  14962,  14993,  15180,
+       15209,  15399,  15426,  15618,  15643,  15837,  15860,  16056,  16077,  16275,  16293,  16494,
+       16510,  16713,  16727,  16932,  16943,  17151,  17160,  17370,  17376,  17590,  17593,  17809,
+       17809,  18028,  18025,  18248,  18242,  18467,  18458,  18687,  18674,  18906,  18890,  19126,
+       19106,  19346,  19322,  19566,  19538,  19786,  19754,  20006,  19969,  20226,  20185,  20446,
+       20400,  20667,  20615,  20887,  20830,  21108,  21045,  21329,  21260,  21550,  21474,  21771,
+       21688,  21993,  21902,  22215,  22116,  22437,  22329,  22660,  22542,  22882,  22755,  23106,
+       22967,  23330,  23179,  23554,  23390,  23779,  23600,  24005,  23809,  24232,  24018,  24459,
+       24225,  24688,  24431,  24919,  24635,  25151,  24838,  25386,  25037,  25624,  25234,  25865,
+       25426,  26111,  25612,  26364,  25791,  26627,  25958,  26902,  26109,  27199,  26233,  27530,
+       26310,  27926,  26295,  28462,  26054,  29404,  24958,  32767,
+    },
+  },
+  { // square
+    { // level 0, 1 harmonic
+           0,    402,    804,   1206,   1608,   2009,   2410,   2811,   3212,   3612,   4011,   4410,
+        4808,   5205,   5602,   5998,   6393,   6786,   7179,   7571,   7962,   8351,   8739,   9126,
+        9512,   9896,  10278,  10659,  11039,  11417,  11793,  12167,  12539,  12910,  13279,  13645,
+       14010,  14372,  14732,  15090,  15446,  15800,  16151,  16499,  16846,  17189,  17530,  17869,
+       18204,  18537,  18868,  19195,  19519,  19841,  20159,  20475,  20787,  21096,  21403,  21705,
+       22005,  22301,  22594,  22884,  23170,  23452,  23731,  24007,  24279,  24547,  24811,  25072,
+       25329,  25582,  25832,  26077,  26319,  26556,  26790,  27019,  27245,  27466,  27683,  27896,
+       28105,  28310,  28510,  28706,  28898,  29085,  29268,  29447,  29621,  29791,  29956,  30117,
+       30273,  30424,  30571,  30714,  30852,  30985,  31113,  31237,  31356,  31470,  31580,  31685,
+       31785,  31880,  31971,  32057,  32137,  32213,  32285,  32351,  32412,  32469,  32521,  32567,
+       32609,  32646,  32678,  32705,  32728,  32745,  32757,  32765,  32767,  32765,  32757,  32745,
+       32728,  32705,  32678,  32646,  32609,  32567,  32521,  32469,  32412,  32351,  32285,  32213,
+       32137,  32057,  31971,  31880,  31785,  31685,  31580,  31470,  31356,  31237,  31113,  30985,
+       30852,  30714,  30571,  30424,  30273,  30117,  29956,  29791,  29621,  29447,  29268,  29085,
+       28898,  28706,  28510,  28310,  28105,  27896,  27683,  27466,  27245,  27019,  26790,  26556,
+       26319,  26077,  25832,  25582,  25329,  25072,  24811,  24547,  24279,  24007,  23731,  23452,
+       23170,  22884,  22594,  22301,  22005,  21705,  21403,  21096,  20787,  20475,  20159,  19841,
+       19519,  19195,  18868,  18537,  18204,  17869,  17530,  17189,  16846,  16499,  16151,  15800,
+       15446,  15090,  14732,  14372,  14010,  13645,  13279,  12910,  12539,  12167,  11793,  11417,
+       11039,  10659,  10278,   9896,   9512,   9126,   8739,   8351,   7962,   7571,   7179,   6786,
+        6393,   5998,   5602,   5205,   4808,   4410,   4011,   3612,   3212,   2811,   2410,   2009,
+        1608,   1206,    804,    402,      0,   -402,   -804,  -1206,  -1608,  -2009,  -2410,  -2811,
+       -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,  -6393,  -6786,  -7179,  -7571,
+       -7962,  -8351,  -8739,  -9126,  -9512,  -9896, -10278, -10659, -11039, -11417, -11793, -12167,
+      -12539, -12910, -13279, -13645, -14010, -14372, -14732, -15090, -15446, -15800, -16151, -16499,
+      -16846, -17189, -17530, -17869, -18204, -18537, -18868, -19195, -19519, -19841, -20159, -20475,
+      -20787, -21096, -21403, -21705, -22005, -22301, -22594, -22884, -23170, -23452, -23731, -24007,
+      -24279, -24547, -24811, -25072, -25329, -25582, -25832, -26077, -26319, -26556, -26790, -27019,
+      -27245, -27466, -27683, -27896, -28105, -28310, -28510, -28706, -28898, -29085, -29268, -29447,
+      -29621, -29791, -29956, -30117, -30273, -30424, -30571, -30714, -30852, -30985, -31113, -31237,
+      -31356, -31470, -31580, -31685, -31785, -31880, -31971, -32057, -32137, -32213, -32285, -32351,
+      -32412, -32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728, -32745, -32757, -32765,
+      -32767, -32765, -32757, -32745, -32728, -32705, -32678, -32646, -32609, -32567, -32521, -32469,
+      -32412, -32351, -32285, -32213, -32137, -32057, -31971, -31880, -31785, -31685, -31580, -31470,
+      -31356, -31237, -31113, -30985, -30852, -30714, -30571, -30424, -30273, -30117, -29956, -29791,
+      -29621, -29447, -29268, -29085, -28898, -28706, -28510, -28310, -28105, -27896, -27683, -27466,
+      -27245, -27019, -26790, -26556, -26319, -26077, -25832, -25582, -25329, -25072, -24811, -24547,
+      -24279, -24007, -23731, -23452, -23170, -22884, -22594, -22301, -22005, -21705, -21403, -21096,
+      -20787, -20475, -20159, -19841, -19519, -19195, -18868, -18537, -18204, -17869, -17530, -17189,
+      -16846, -16499, -16151, -15800, -15446, -15090, -14732, -14372, -14010, -13645, -13279, -12910,
+      -12539, -12167, -11793, -11417, -11039, -10659, -10278,  -9896,  -9512,  -9126,  -8739,  -8351,
+       -7962,  -7571,  -7179,  -6786,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
+       -3212,  -2811,  -2410,  -2009,  -1608,  -1206,   -804,   -402,
+    },
+    { // level 1, 2 harmonics
+           0,    402,    804,   1206,   1608,   2009,   2410,   2811,   3212,   3612,   4011,   4410,
+        4808,   5205,   5602,   5998,   6393,   6786,   7179,   7571,   7962,   8351,   8739,   9126,
+        9512,   9896,  10278,  10659,  11039,  11417,  11793,  12167,  12539,  12910,  13279,  13645,
+       14010,  14372,  14732,  15090,  15446,  15800,  16151,  16499,  16846,  17189,  17530,  17869,
+       18204,  18537,  18868,  19195,  19519,  19841,  20159,  20475,  20787,  21096,  21403,  21705,
+       22005,  22301,  22594,  22884,  23170,  23452,  23731,  24007,  24279,  24547,  24811,  25072,
+       25329,  25582,  25832,  26077,  26319,  26556,  26790,  27019,  27245,  27466,  27683,  27896,
+       28105,  28310,  28510,  28706,  28898,  29085,  29268,  29447,  29621,  29791,  29956,  30117,
+       30273,  30424,  30571,  30714,  30852,  30985,  31113,  31237,  31356,  31470,  31580,  31685,
+       31785,  31880,  31971,  32057,  32137,  32213,  32285,  32351,  32412,  32469,  32521,  32567,
+       32609,  32646,  32678,  32705,  32728,  32745,  32757,  32765,  32767,  32765,  32757,  32745,
+       32728,  32705,  32678,  32646,  32609,  32567,  32521,  32469,  32412,  32351,  32285,  32213,
+       32137,  32057,  31971,  31880,  31785,  31685,  31580,  31470,  31356,  31237,  31113,  30985,
+       30852,  30714,  30571,  30424,  30273,  30117,  29956,  29791,  29621,  29447,  29268,  29085,
+       28898,  28706,  28510,  28310,  28105,  27896,  27683,  27466,  27245,  27019,  26790,  26556,
+       26319,  26077,  25832,  25582,  25329,  25072,  24811,  24547,  24279,  24007,  23731,  23452,
+       23170,  22884,  22594,  22301,  22005,  21705,  21403,  21096,  20787,  20475,  20159,  19841,
+       19519,  19195,  18868,  18537,  18204,  17869,  17530,  17189,  16846,  16499,  16151,  15800,
+       15446,  15090,  14732,  14372,  14010,  13645,  13279,  12910,  12539,  12167,  11793,  11417,
+       11039,  10659,  10278,   9896,   9512,   9126,   8739,   8351,   7962,   7571,   7179,   6786,
+        6393,   5998,   5602,   5205,   4808,   4410,   4011,   3612,   3212,   2811,   2410,   2009,
+        1608,   1206,    804,    402,      0,   -402,   -804,  -1206,  -1608,  -2009,  -2410,  -2811,
+       -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,  -6393,  -6786,  -7179,  -7571,
+       -7962,  -8351,  -8739,  -9126,  -9512,  -9896, -10278, -10659, -11039, -11417, -11793, -12167,
+      -12539, -12910, -13279, -13645, -14010, -14372, -14732, -15090, -15446, -15800, -16151, -16499,
+      -16846, -17189, -17530, -17869, -18204, -18537, -18868, -19195, -19519, -19841, -20159, -20475,
+      -20787, -21096, -21403, -21705, -22005, -22301, -22594, -22884, -23170, -23452, -23731, -24007,
+      -24279, -24547, -24811, -25072, -25329, -25582, -25832, -26077, -26319, -26556, -26790, -27019,
+      -27245, -27466, -27683, -27896, -28105, -28310, -28510, -28706, -28898, -29085, -29268, -29447,
+      -29621, -29791, -29956, -30117, -30273, -30424, -30571, -30714, -30852, -30985, -31113, -31237,
+      -31356, -31470, -31580, -31685, -31785, -31880, -31971, -32057, -32137, -32213, -32285, -32351,
+      -32412, -32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728, -32745, -32757, -32765,
+      -32767, -32765, -32757, -32745, -32728, -32705, -32678, -32646, -32609, -32567, -32521, -32469,
+      -32412, -32351, -32285, -32213, -32137, -32057, -31971, -31880, -31785, -31685, -31580, -31470,
+      -31356, -31237, -31113, -30985, -30852, -30714, -30571, -30424, -30273, -30117, -29956, -29791,
+      -29621, -29447, -29268, -29085, -28898, -28706, -28510, -28310, -28105, -27896, -27683, -27466,
+      -27245, -27019, -26790, -26556, -26319, -26077, -25832, -25582, -25329, -25072, -24811, -24547,
+      -24279, -24007, -23731, -23452, -23170, -22884, -22594, -22301, -22005, -21705, -21403, -21096,
+      -20787, -20475, -20159, -19841, -19519, -19195, -18868, -18537, -18204, -17869, -17530, -17189,
+      -16846, -16499, -16151, -15800, -15446, -15090, -14732, -14372, -14010, -13645, -13279, -12910,
+      -12539, -12167, -11793, -11417, -11039, -10659, -10278,  -9896,  -9512,  -9126,  -8739,  -8351,
+       -7962,  -7571,  -7179,  -6786,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
+       -3212,  -2811,  -2410,  -2009,  -1608,  -1206,   -804,   -402,
+    },
+    { // level 2, 4 harmonics
+           0,    804,   1608,   2410,   3210,   4009,   4804,   5595,   6382,   7165,   7942,   8713,
+        9478,  10235,  10986,  11727,  12461,  13185,  13899,  14603,  15297,  15979,  16650,  17309,
+       17955,  18588,  19208,  19815,  20407,  20985,  21549,  22097,  22630,  23148,  23650,  24135,
+       24605,  25058,  25494,  25913,  26316,  26701,  27070,  27421,  27755,  28071,  28370,  28652,
+       28917,  29164,  29394,  29607,  29803,  29982,  30145,  30290,  30420,  30533,  30630,  30712,
+       30778,  30829,  30865,  30886,  30893,  30886,  30866,  30832,  30785,  30726,  30655,  30572,
+       30478,  30373,  30258,  30133,  29998,  29855,  29703,  29543,  29376,  29201,  29020,  28833,
+       28641,  28444,  28242,  28036,  27827,  27615,  27401,  27185,  26967,  26749,  26530,  26311,
+       26093,  25876,  25661,  25447,  25236,  25028,  24824,  24623,  24427,  24235,  24049,  23867,
+       23692,  23523,  23360,  23204,  23056,  22915,  22781,  22656,  22539,  22430,  22330,  22239,
+       22157,  22085,  22021,  21968,  21923,  21889,  21864,  21850,  21845,  21850,  21864,  21889,
+       21923,  21968,  22021,  22085,  22157,  22239,  22330,  22430,  22539,  22656,  22781,  22915,
+       23056,  23204,  23360,  23523,  23692,  23867,  24049,  24235,  24427,  24623,  24824,  25028,
+       25236,  25447,  25661,  25876,  26093,  26311,  26530,  26749,  26967,  27185,  27401,  27615,
+       27827,  28036,  28242,  28444,  28641,  28833,  29020,  29201,  29376,  29543,  29703,  29855,
+       29998,  30133,  30258,  30373,  30478,  30572,  30655,  30726,  30785,  30832,  30866,  30886,
+       30893,  30886,  30865,  30829,  30778,  30712,  30630,  30533,  30420,  30290,  30145,  29982,
+       29803,  29607,  29394,  29164,  28917,  28652,  28370,  28071,  27755,  27421,  27070,  26701,
+       26316,  25913,  25494,  25058,  24605,  24135,  23650,  23148,  22630,  22097,  21549,  20985,
+       20407,  19815,  19208,  18588,  17955,  17309,  16650,  15979,  15297,  14603,  13899,  13185,
+       12461,  11727,  10986,  10235,   9478,   8713,   7942,   7165,   6382,   5595,   4804,   4009,
+        3210,   2410,   1608,    804,      0,   -804,  -1608,  -2410,  -3210,  -4009,  -4804,  -5595,
+       -6382,  -7165,  -7942,  -8713,  -9478, -10235, -10986, -11727, -12461, -13185, -13899, -14603,
+      -15297, -15979, -16650, -17309, -17955, -18588, -19208, -19815, -20407, -20985, -21549, -22097,
+      -22630, -23148, -23650, -24135, -24605, -25058, -25494, -25913, -26316, -26701, -27070, -27421,
+      -27755, -28071, -28370, -28652, -28917, -29164, -29394, -29607, -29803, -29982, -30145, -30290,
+      -30420, -30533, -30630, -30712, -30778, -30829, -30865, -30886, -30893, -30886, -30866, -30832,
+      -30785, -30726, -30655, -30572, -30478, -30373, -30258, -30133, -29998, -29855, -29703, -29543,
+      -29376, -29201, -29020, -28833, -28641, -28444, -28242, -28036, -27827, -27615, -27401, -27185,
+      -26967, -26749, -26530, -26311, -26093, -25876, -25661, -25447, -25236, -25028, -24824, -24623,
+      -24427, -24235, -24049, -23867, -23692, -23523, -23360, -23204, -23056, -22915, -22781, -22656,
+      -22539, -22430, -22330, -22239, -22157, -22085, -22021, -21968, -21923, -21889, -21864, -21850,
+      -21845, -21850, -21864, -21889, -21923, -21968, -22021, -22085, -22157, -22239, -22330, -22430,
+      -22539, -22656, -22781, -22915, -23056, -23204, -23360, -23523, -23692, -23867, -24049, -24235,
+      -24427, -24623, -24824, -25028, -25236, -25447, -25661, -25876, -26093, -26311, -26530, -26749,
+      -26967, -27185, -27401, -27615, -27827, -28036, -28242, -28444, -28641, -28833, -29020, -29201,
+      -29376, -29543, -29703, -29855, -29998, -30133, -30258, -30373, -30478, -30572, -30655, -30726,
+      -30785, -30832, -30866, -30886, -30893, -30886, -30865, -30829, -30778, -30712, -30630, -30533,
+      -30420, -30290, -30145, -29982, -29803, -29607, -29394, -29164, -28917, -28652, -28370, -28071,
+      -27755, -27421, -27070, -26701, -26316, -25913, -25494, -25058, -24605, -24135, -23650, -23148,
+      -22630, -22097, -21549, -20985, -20407, -19815, -19208, -18588, -17955, -17309, -16650, -15979,
+      -15297, -14603, -13899, -13185, -12461, -11727, -10986, -10235,  -9478,  -8713,  -7942,  -7165,
+       -6382,  -5595,  -4804,  -4009,  -3210,  -2410,  -1608,   -804,
+    },
+    { // level 3, 8 harmonics
+           0,   1608,   3210,   4803,   6380,   7937,   9469,  10972,  12441,  13872,  15260,  16602,
+       17894,  19133,  20315,  21439,  22501,  23499,  24432,  25299,  26097,  26827,  27489,  28081,
+       28605,  29061,  29450,  29774,  30033,  30231,  30369,  30450,  30476,  30451,  30377,  30258,
+       30098,  29900,  29667,  29404,  29115,  28802,  28471,  28125,  27768,  27404,  27036,  26668,
+       26303,  25945,  25597,  25261,  24941,  24638,  24356,  24096,  23859,  23648,  23463,  23306,
+       23177,  23077,  23006,  22963,  22949,  22963,  23004,  23071,  23163,  23278,  23415,  23572,
+       23748,  23940,  24145,  24363,  24590,  24825,  25064,  25306,  25549,  25789,  26025,  26255,
+       26477,  26688,  26887,  27072,  27241,  27393,  27528,  27643,  27739,  27813,  27867,  27899,
+       27910,  27899,  27867,  27815,  27743,  27652,  27543,  27417,  27276,  27121,  26953,  26774,
+       26587,  26392,  26192,  25988,  25783,  25579,  25377,  25179,  24988,  24804,  24631,  24468,
+       24318,  24183,  24063,  23959,  23873,  23805,  23756,  23727,  23717,  23727,  23756,  23805,
+       23873,  23959,  24063,  24183,  24318,  24468,  24631,  24804,  24988,  25179,  25377,  25579,
+       25783,  25988,  26192,  26392,  26587,  26774,  26953,  27121,  27276,  27417,  27543,  27652,
+       27743,  27815,  27867,  27899,  27910,  27899,  27867,  27813,  27739,  27643,  27528,  27393,
+       27241,  27072,  26887,  26688,  26477,  26255,  26025,  25789,  25549,  25306,  25064,  24825,
+       24590,  24363,  24145,  23940,  23748,  23572,  23415,  23278,  23163,  23071,  23004,  22963,
+       22949,  22963,  23006,  23077,  23177,  23306,  23463,  23648,  23859,  24096,  24356,  24638,
+       24941,  25261,  25597,  25945,  26303,  26668,  27036,  27404,  27768,  28125,  28471,  28802,
+       29115,  29404,  29667,  29900,  30098,  30258,  30377,  30451,  30476,  30450,  30369,  30231,
+       30033,  29774,  29450,  29061,  28605,  28081,  27489,  26827,  26097,  25299,  24432,  23499,
+       22501,  21439,  20315,  19133,  17894,  16602,  15260,  13872,  12441,  10972,   9469,   7937,
+        6380,   4803,   3210,   1608,      0,  -1608,  -3210,  -4803,  -6380,  -7937,  -9469, -10972,
+      -12441, -13872, -15260, -16602, -17894, -19133, -20315, -21439, -22501, -23499, -24432, -25299,
+      -26097, -26827, -27489, -28081, -28605, -29061, -29450, -29774, -30033, -30231, -30369, -30450,
+      -30476, -30451, -30377, -30258, -30098, -29900, -29667, -29404, -29115, -28802, -28471, -28125,
+      -27768, -27404, -27036, -26668, -26303, -25945, -25597, -25261, -24941, -24638, -24356, -24096,
+      -23859, -23648, -23463, -23306, -23177, -23077, -23006, -22963, -22949, -22963, -23004, -23071,
+      -23163, -23278, -23415, -23572, -23748, -23940, -24145, -24363, -24590, -24825, -25064, -25306,
+      -25549, -25789, -26025, -26255, -26477, -26688, -26887, -27072, -27241, -27393, -27528, -27643,
+      -27739, -27813, -27867, -27899, -27910, -27899, -27867, -27815, -27743, -27652, -27543, -27417,
+      -27276, -27121, -26953, -26774, -26587, -26392, -26192, -25988, -25783, -25579, -25377, -25179,
+      -24988, -24804, -24631, -24468, -24318, -24183, -24063, -23959, -23873, -23805, -23756, -23727,
+      -23717, -23727, -23756, -23805, -23873, -23959, -24063, -24183, -24318, -24468, -24631, -24804,
+      -24988, -25179, -25377, -25579, -25783, -25988, -26192, -26392, -26587, -26774, -26953, -27121,
+      -27276, -27417, -27543, -27652, -27743, -27815, -27867, -27899, -27910, -27899, -27867, -27813,
+      -27739, -27643, -27528, -27393, -27241, -27072, -26887, -26688, -26477, -26255, -26025, -25789,
+      -25549, -25306, -25064, -24825, -24590, -24363, -24145, -23940, -23748, -23572, -23415, -23278,
+      -23163, -23071, -23004, -22963, -22949, -22963, -23006, -23077, -23177, -23306, -23463, -23648,
+      -23859, -24096, -24356, -24638, -24941, -25261, -25597, -25945, -26303, -26668, -27036, -27404,
+      -27768, -28125, -28471, -28802, -29115, -29404, -29667, -29900, -30098, -30258, -30377, -30451,
+      -30476, -30450, -30369, -30231, -30033, -29774, -29450, -29061, -28605, -28081, -27489, -26827,
+      -26097, -25299, -24432, -23499, -22501, -21439, -20315, -19133, -17894, -16602, -15260, -13872,
+      -12441, -10972,  -9469,  -7937,  -6380,  -4803,  -3210,  -1608,
+    },
+    { // level 4, 16 harmonics
+           0,   3210,   6379,   9467,  12436,  15251,  17879,  20292,  22469,  24390,  26044,  27423,
+       28529,  29364,  29939,  30270,  30375,  30278,  30005,  29585,  29049,  28425,  27747,  27042,
+       26340,  25665,  25041,  24487,  24018,  23646,  23378,  23219,  23166,  23217,  23362,  23592,
+       23894,  24252,  24651,  25073,  25502,  25921,  26315,  26670,  26975,  27220,  27399,  27507,
+       27543,  27508,  27406,  27243,  27028,  26769,  26479,  26170,  25852,  25540,  25243,  24974,
+       24742,  24553,  24415,  24331,  24303,  24331,  24411,  24541,  24714,  24922,  25157,  25410,
+       25669,  25927,  26171,  26395,  26589,  26747,  26863,  26934,  26958,  26934,  26865,  26754,
+       26605,  26424,  26220,  26000,  25773,  25547,  25331,  25134,  24962,  24821,  24717,  24654,
+       24632,  24654,  24716,  24817,  24953,  25117,  25304,  25506,  25715,  25924,  26123,  26307,
+       26467,  26598,  26695,  26755,  26775,  26755,  26696,  26600,  26471,  26314,  26136,  25942,
+       25741,  25541,  25348,  25171,  25015,  24888,  24793,  24735,  24715,  24735,  24793,  24888,
+       25015,  25171,  25348,  25541,  25741,  25942,  26136,  26314,  26471,  26600,  26696,  26755,
+       26775,  26755,  26695,  26598,  26467,  26307,  26123,  25924,  25715,  25506,  25304,  25117,
+       24953,  24817,  24716,  24654,  24632,  24654,  24717,  24821,  24962,  25134,  25331,  25547,
+       25773,  26000,  26220,  26424,  26605,  26754,  26865,  26934,  26958,  26934,  26863,  26747,
+       26589,  26395,  26171,  25927,  25669,  25410,  25157,  24922,  24714,  24541,  24411,  24331,
+       24303,  24331,  24415,  24553,  24742,  24974,  25243,  25540,  25852,  26170,  26479,  26769,
+       27028,  27243,  27406,  27508,  27543,  27507,  27399,  27220,  26975,  26670,  26315,  25921,
+       25502,  25073,  24651,  24252,  23894,  23592,  23362,  23217,  23166,  23219,  23378,  23646,
+       24018,  24487,  25041,  25665,  26340,  27042,  27747,  28425,  29049,  29585,  30005,  30278,
+       30375,  30270,  29939,  29364,  28529,  27423,  26044,  24390,  22469,  20292,  17879,  15251,
+       12436,   9467,   6379,   3210,      0,  -3210,  -6379,  -9467, -12436, -15251, -17879, -20292,
+      -22469, -24390, -26044, -27423, -28529, -29364, -29939, -30270, -30375, -30278, -30005, -29585,
+      -29049, -28425, -27747, -27042, -26340, -25665, -25041, -24487, -24018, -23646, -23378, -23219,
+      -23166, -23217, -23362, -23592, -23894, -24252, -24651, -25073, -25502, -25921, -26315, -26670,
+      -26975, -27220, -27399, -27507, -27543, -27508, -27406, -27243, -27028, -26769, -26479, -26170,
+      -25852, -25540, -25243, -24974, -24742, -24553, -24415, -24331, -24303, -24331, -24411, -24541,
+      -24714, -24922, -25157, -25410, -25669, -25927, -26171, -26395, -26589, -26747, -26863, -26934,
+      -26958, -26934, -26865, -26754, -26605, -26424, -26220, -26000, -25773, -25547, -25331, -25134,
+      -24962, -24821, -24717, -24654, -24632, -24654, -24716, -24817, -24953, -25117, -25304, -25506,
+      -25715, -25924, -26123, -26307, -26467, -26598, -26695, -26755, -26775, -26755, -26696, -26600,
+      -26471, -26314, -26136, -25942, -25741, -25541, -25348, -25171, -25015, -24888, -24793, -24735,
+      -24715, -24735, -24793, -24888, -25015, -25171, -25348, -25541, -25741, -25942, -26136, -26314,
+      -26471, -26600, -26696, -26755, -26775, -26755, -26695, -26598, -26467, -26307, -26123, -25924,
+      -25715, -25506, -25304, -25117, -24953, -24817, -24716, -24654, -24632, -24654, -24717, -24821,
+      -24962, -25134, -25331, -25547, -25773, -26000, -26220, -26424, -26605, -26754, -26865, -26934,
+      -26958, -26934, -26863, -26747, -26589, -26395, -26171, -25927, -25669, -25410, -25157, -24922,
+      -24714, -24541, -24411, -24331, -24303, -24331, -24415, -24553, -24742, -24974, -25243, -25540,
+      -25852, -26170, -26479, -26769, -27028, -27243, -27406, -27508, -27543, -27507, -27399, -27220,
+      -26975, -26670, -26315, -25921, -25502, -25073, -24651, -24252, -23894, -23592, -23362, -23217,
+      -23166, -23219, -23378, -23646, -24018, -24487, -25041, -25665, -26340, -27042, -27747, -28425,
+      -29049, -29585, -30005, -30278, -30375, -30270, -29939, -29364, -28529, -27423, -26044, -24390,
+      -22469, -20292, -17879, -15251, -12436,  -9467,  -6379,  -3210,
+    },
+    { // level 5, 32 harmonics
+           0,   6379,  12435,  17875,  22461,  26030,  28509,  29916,  30350,  29982,  29032,  27741,
+       26348,  25064,  24055,  23426,  23217,  23409,  23929,  24666,  25493,  26280,  26918,  27326,
+       27464,  27333,  26973,  26454,  25862,  25290,  24821,  24517,  24413,  24513,  24790,  25194,
+       25658,  26111,  26485,  26729,  26813,  26732,  26504,  26171,  25786,  25409,  25095,  24889,
+       24818,  24888,  25082,  25368,  25699,  26026,  26298,  26477,  26539,  26478,  26307,  26055,
+       25761,  25471,  25229,  25069,  25013,  25068,  25222,  25450,  25716,  25979,  26199,  26345,
+       26396,  26346,  26204,  25995,  25750,  25507,  25303,  25168,  25121,  25167,  25299,  25495,
+       25724,  25952,  26143,  26270,  26315,  26271,  26146,  25961,  25743,  25527,  25345,  25224,
+       25182,  25224,  25343,  25521,  25729,  25937,  26112,  26229,  26270,  26229,  26114,  25942,
+       25739,  25538,  25367,  25253,  25214,  25253,  25366,  25534,  25733,  25931,  26098,  26210,
+       26249,  26210,  26099,  25932,  25736,  25540,  25374,  25263,  25224,  25263,  25374,  25540,
+       25736,  25932,  26099,  26210,  26249,  26210,  26098,  25931,  25733,  25534,  25366,  25253,
+       25214,  25253,  25367,  25538,  25739,  25942,  26114,  26229,  26270,  26229,  26112,  25937,
+       25729,  25521,  25343,  25224,  25182,  25224,  25345,  25527,  25743,  25961,  26146,  26271,
+       26315,  26270,  26143,  25952,  25724,  25495,  25299,  25167,  25121,  25168,  25303,  25507,
+       25750,  25995,  26204,  26346,  26396,  26345,  26199,  25979,  25716,  25450,  25222,  25068,
+       25013,  25069,  25229,  25471,  25761,  26055,  26307,  26478,  26539,  26477,  26298,  26026,
+       25699,  25368,  25082,  24888,  24818,  24889,  25095,  25409,  25786,  26171,  26504,  26732,
+       26813,  26729,  26485,  26111,  25658,  25194,  24790,  24513,  24413,  24517,  24821,  25290,
+       25862,  26454,  26973,  27333,  27464,  27326,  26918,  26280,  25493,  24666,  23929,  23409,
+       23217,  23426,  24055,  25064,  26348,  27741,  29032,  29982,  30350,  29916,  28509,  26030,
+       22461,  17875,  12435,   6379,      0,  -6379, -12435, -17875, -22461, -26030, -28509, -29916,
+      -30350, -29982, -29032, -27741, -26348, -25064, -24055, -23426, -23217, -23409, -23929, -24666,
+      -25493, -26280, -26918, -27326, -27464, -27333, -26973, -26454, -25862, -25290, -24821, -24517,
+      -24413, -24513, -24790, -25194, -25658, -26111, -26485, -26729, -26813, -26732, -26504, -26171,
+      -25786, -25409, -25095, -24889, -24818, -24888, -25082, -25368, -25699, -26026, -26298, -26477,
+      -26539, -26478, -26307, -26055, -25761, -25471, -25229, -25069, -25013, -25068, -25222, -25450,
+      -25716, -25979, -26199, -26345, -26396, -26346, -26204, -25995, -25750, -25507, -25303, -25168,
+      -25121, -25167, -25299, -25495, -25724, -25952, -26143, -26270, -26315, -26271, -26146, -25961,
+      -25743, -25527, -25345, -25224, -25182, -25224, -25343, -25521, -25729, -25937, -26112, -26229,
+      -26270, -26229, -26114, -25942, -25739, -25538, -25367, -25253, -25214, -25253, -25366, -25534,
+      -25733, -25931, -26098, -26210, -26249, -26210, -26099, -25932, -25736, -25540, -25374, -25263,
+      -25224, -25263, -25374, -25540, -25736, -25932, -26099, -26210, -26249, -26210, -26098, -25931,
+      -25733, -25534, -25366, -25253, -25214, -25253, -25367, -25538, -25739, -25942, -26114, -26229,
+      -26270, -26229, -26112, -25937, -25729, -25521, -25343, -25224, -25182, -25224, -25345, -25527,
+      -25743, -25961, -26146, -26271, -26315, -26270, -26143, -25952, -25724, -25495, -25299, -25167,
+      -25121, -25168, -25303, -25507, -25750, -25995, -26204, -26346, -26396, -26345, -26199, -25979,
+      -25716, -25450, -25222, -25068, -25013, -25069, -25229, -25471, -25761, -26055, -26307, -26478,
+      -26539, -26477, -26298, -26026, -25699, -25368, -25082, -24888, -24818, -24889, -25095, -25409,
+      -25786, -26171, -26504, -26732, -26813, -26729, -26485, -26111, -25658, -25194, -24790, -24513,
+      -24413, -24517, -24821, -25290, -25862, -26454, -26973, -27333, -27464, -27326, -26918, -26280,
+      -25493, -24666, -23929, -23409, -23217, -23426, -24055, -25064, -26348, -27741, -29032, -29982,
+      -30350, -29916, -28509, -26030, -22461, -17875, -12435,  -6379,
+    },
+    { // level 6, 64 harmonics
+           0,  12435,  22459,  28505,  30343,  29028,  26350,  24064,  23230,  23938,  25491,  26904,
+       27445,  26960,  25864,  24839,  24438,  24808,  25656,  26462,  26781,  26482,  25788,  25123,
+       24858,  25110,  25697,  26264,  26492,  26274,  25764,  25268,  25068,  25260,  25713,  26154,
+       26332,  26160,  25753,  25355,  25193,  25350,  25721,  26084,  26232,  26088,  25747,  25412,
+       25275,  25408,  25725,  26037,  26164,  26040,  25743,  25451,  25332,  25449,  25728,  26003,
+       26116,  26005,  25741,  25480,  25373,  25479,  25730,  25978,  26080,  25980,  25740,  25502,
+       25404,  25501,  25731,  25960,  26054,  25961,  25739,  25518,  25427,  25517,  25732,  25946,
+       26033,  25946,  25738,  25530,  25445,  25530,  25733,  25935,  26018,  25936,  25737,  25540,
+       25458,  25539,  25733,  25927,  26007,  25928,  25737,  25546,  25468,  25546,  25734,  25922,
+       25999,  25922,  25736,  25551,  25474,  25551,  25734,  25918,  25994,  25918,  25736,  25553,
+       25478,  25553,  25735,  25916,  25991,  25916,  25735,  25554,  25479,  25554,  25735,  25916,
+       25991,  25916,  25735,  25553,  25478,  25553,  25736,  25918,  25994,  25918,  25734,  25551,
+       25474,  25551,  25736,  25922,  25999,  25922,  25734,  25546,  25468,  25546,  25737,  25928,
+       26007,  25927,  25733,  25539,  25458,  25540,  25737,  25936,  26018,  25935,  25733,  25530,
+       25445,  25530,  25738,  25946,  26033,  25946,  25732,  25517,  25427,  25518,  25739,  25961,
+       26054,  25960,  25731,  25501,  25404,  25502,  25740,  25980,  26080,  25978,  25730,  25479,
+       25373,  25480,  25741,  26005,  26116,  26003,  25728,  25449,  25332,  25451,  25743,  26040,
+       26164,  26037,  25725,  25408,  25275,  25412,  25747,  26088,  26232,  26084,  25721,  25350,
+       25193,  25355,  25753,  26160,  26332,  26154,  25713,  25260,  25068,  25268,  25764,  26274,
+       26492,  26264,  25697,  25110,  24858,  25123,  25788,  26482,  26781,  26462,  25656,  24808,
+       24438,  24839,  25864,  26960,  27445,  26904,  25491,  23938,  23230,  24064,  26350,  29028,
+       30343,  28505,  22459,  12435,      0, -12435, -22459, -28505, -30343, -29028, -26350, -24064,
+      -23230, -23938, -25491, -26904, -27445, -26960, -25864, -24839, -24438, -24808, -25656, -26462,
+      -26781, -26482, -25788, -25123, -24858, -25110, -25697, -26264, -26492, -26274, -25764, -25268,
+      -25068, -25260, -25713, -26154, -26332, -26160, -25753, -25355, -25193, -25350, -25721, -26084,
+      -26232, -26088, -25747, -25412, -25275, -25408, -25725, -26037, -26164, -26040, -25743, -25451,
+      -25332, -25449, -25728, -26003, -26116, -26005, -25741, -25480, -25373, -25479, -25730, -25978,
+      -26080, -25980, -25740, -25502, -25404, -25501, -25731, -25960, -26054, -25961, -25739, -25518,
+      -25427, -25517, -25732, -25946, -26033, -25946, -25738, -25530, -25445, -25530, -25733, -25935,
+      -26018, -25936, -25737, -25540, -25458, -25539, -25733, -25927, -26007, -25928, -25737, -25546,
+      -25468, -25546, -25734, -25922, -25999, -25922, -25736, -25551, -25474, -25551, -25734, -25918,
+      -25994, -25918, -25736, -25553, -25478, -25553, -25735, -25916, -25991, -25916, -25735, -25554,
+      -25479, -25554, -25735, -25916, -25991, -25916, -25735, -25553, -25478, -25553, -25736, -25918,
+      -25994, -25918, -25734, -25551, -25474, -25551, -25736, -25922, -25999, -25922, -25734, -25546,
+      -25468, -25546, -25737, -25928, -26007, -25927, -25733, -25539, -25458, -25540, -25737, -25936,
+      -26018, -25935, -25733, -25530, -25445, -25530, -25738, -25946, -26033, -25946, -25732, -25517,
+      -25427, -25518, -25739, -25961, -26054, -25960, -25731, -25501, -25404, -25502, -25740, -25980,
+      -26080, -25978, -25730, -25479, -25373, -25480, -25741, -26005, -26116, -26003, -25728, -25449,
+      -25332, -25451, -25743, -26040, -26164, -26037, -25725, -25408, -25275, -25412, -25747, -26088,
+      -26232, -26084, -25721, -25350, -25193, -25355, -25753, -26160, -26332, -26154, -25713, -25260,
+      -25068, -25268, -25764, -26274, -26492, -26264, -25697, -25110, -24858, -25123, -25788, -26482,
+      -26781, -26462, -25656, -24808, -24438, -24839, -25864, -26960, -27445, -26904, -25491, -23938,
+      -23230, -24064, -26350, -29028, -30343, -28505, -22459, -12435,
+    },
+    { // level 7, 128 harmonics
+           0,  22458,  30342,  26351,  23233,  25490,  27440,  25865,  24445,  25656,  26773,  25789,
+       24868,  25697,  26481,  25764,  25081,  25713,  26318,  25753,  25209,  25720,  26214,  25747,
+       25295,  25725,  26143,  25744,  25356,  25727,  26090,  25742,  25401,  25729,  26051,  25740,
+       25436,  25730,  26020,  25739,  25464,  25731,  25995,  25739,  25486,  25732,  25974,  25738,
+       25505,  25733,  25957,  25738,  25520,  25733,  25943,  25737,  25533,  25733,  25931,  25737,
+       25545,  25734,  25921,  25737,  25554,  25734,  25912,  25736,  25562,  25734,  25904,  25736,
+       25570,  25734,  25897,  25736,  25576,  25734,  25892,  25736,  25581,  25734,  25887,  25736,
+       25586,  25734,  25882,  25736,  25590,  25735,  25878,  25736,  25594,  25735,  25875,  25736,
+       25597,  25735,  25872,  25736,  25599,  25735,  25870,  25735,  25601,  25735,  25868,  25735,
+       25603,  25735,  25866,  25735,  25605,  25735,  25865,  25735,  25606,  25735,  25864,  25735,
+       25607,  25735,  25863,  25735,  25607,  25735,  25863,  25735,  25607,  25735,  25863,  25735,
+       25607,  25735,  25863,  25735,  25607,  25735,  25864,  25735,  25606,  25735,  25865,  25735,
+       25605,  25735,  25866,  25735,  25603,  25735,  25868,  25735,  25601,  25735,  25870,  25735,
+       25599,  25736,  25872,  25735,  25597,  25736,  25875,  25735,  25594,  25736,  25878,  25735,
+       25590,  25736,  25882,  25734,  25586,  25736,  25887,  25734,  25581,  25736,  25892,  25734,
+       25576,  25736,  25897,  25734,  25570,  25736,  25904,  25734,  25562,  25736,  25912,  25734,
+       25554,  25737,  25921,  25734,  25545,  25737,  25931,  25733,  25533,  25737,  25943,  25733,
+       25520,  25738,  25957,  25733,  25505,  25738,  25974,  25732,  25486,  25739,  25995,  25731,
+       25464,  25739,  26020,  25730,  25436,  25740,  26051,  25729,  25401,  25742,  26090,  25727,
+       25356,  25744,  26143,  25725,  25295,  25747,  26214,  25720,  25209,  25753,  26318,  25713,
+       25081,  25764,  26481,  25697,  24868,  25789,  26773,  25656,  24445,  25865,  27440,  25490,
+       23233,  26351,  30342,  22458,      0, -22458, -30342, -26351, -23233, -25490, -27440, -25865,
+      -24445, -25656, -26773, -25789, -24868, -25697, -26481, -25764, -25081, -25713, -26318, -25753,
+      -25209, -25720, -26214, -25747, -25295, -25725, -26143, -25744, -25356, -25727, -26090, -25742,
+      -25401, -25729, -26051, -25740, -25436, -25730, -26020, -25739, -25464, -25731, -25995, -25739,
+      -25486, -25732, -25974, -25738, -25505, -25733, -25957, -25738, -25520, -25733, -25943, -25737,
+      -25533, -25733, -25931, -25737, -25545, -25734, -25921, -25737, -25554, -25734, -25912, -25736,
+      -25562, -25734, -25904, -25736, -25570, -25734, -25897, -25736, -25576, -25734, -25892, -25736,
+      -25581, -25734, -25887, -25736, -25586, -25734, -25882, -25736, -25590, -25735, -25878, -25736,
+      -25594, -25735, -25875, -25736, -25597, -25735, -25872, -25736, -25599, -25735, -25870, -25735,
+      -25601, -25735, -25868, -25735, -25603, -25735, -25866, -25735, -25605, -25735, -25865, -25735,
+      -25606, -25735, -25864, -25735, -25607, -25735, -25863, -25735, -25607, -25735, -25863, -25735,
+      -25607, -25735, -25863, -25735, -25607, -25735, -25863, -25735, -25607, -25735, -25864, -25735,
+      -25606, -25735, -25865, -25735, -25605, -25735, -25866, -25735, -25603, -25735, -25868, -25735,
+      -25601, -25735, -25870, -25735, -25599, -25736, -25872, -25735, -25597, -25736, -25875, -25735,
+      -25594, -25736, -25878, -25735, -25590, -25736, -25882, -25734, -25586, -25736, -25887, -25734,
+      -25581, -25736, -25892, -25734, -25576, -25736, -25897, -25734, -25570, -25736, -25904, -25734,
+      -25562, -25736, -25912, -25734, -25554, -25737, -25921, -25734, -25545, -25737, -25931, -25733,
+      -25533, -25737, -25943, -25733, -25520, -25738, -25957, -25733, -25505, -25738, -25974, -25732,
+      -25486, -25739, -25995, -25731, -25464, -25739, -26020, -25730, -25436, -25740, -26051, -25729,
+      -25401, -25742, -26090, -25727, -25356, -25744, -26143, -25725, -25295, -25747, -26214, -25720,
+      -25209, -25753, -26318, -25713, -25081, -25764, -26481, -25697, -24868, -25789, -26773, -25656,
+      -24445, -25865, -27440, -25490, -23233, -26351, -30342, -22458,
+    },
+    { // level 8, 255 harmonics
+           0,  30341,  23234,  27439,  24446,  26771,  24870,  26478,  25084,  26314,  25213,  26210,
+       25300,  26138,  25361,  26084,  25407,  26044,  25443,  26012,  25472,  25986,  25495,  25965,
+       25515,  25947,  25531,  25932,  25545,  25919,  25557,  25907,  25568,  25898,  25577,  25889,
+       25585,  25881,  25593,  25874,  25599,  25868,  25605,  25862,  25611,  25857,  25616,  25852,
+       25620,  25848,  25624,  25844,  25628,  25841,  25631,  25838,  25634,  25835,  25637,  25832,
+       25640,  25829,  25642,  25827,  25645,  25825,  25647,  25822,  25649,  25821,  25651,  25819,
+       25652,  25817,  25654,  25816,  25655,  25814,  25657,  25813,  25658,  25811,  25659,  25810,
+       25661,  25809,  25662,  25808,  25663,  25807,  25663,  25806,  25664,  25806,  25665,  25805,
+       25666,  25804,  25667,  25803,  25667,  25803,  25668,  25802,  25668,  25802,  25669,  25801,
+       25669,  25801,  25670,  25801,  25670,  25800,  25670,  25800,  25670,  25800,  25671,  25800,
+       25671,  25799,  25671,  25799,  25671,  25799,  25671,  25799,  25671,  25799,  25671,  25799,
+       25671,  25799,  25671,  25799,  25671,  25800,  25671,  25800,  25670,  25800,  25670,  25800,
+       25670,  25801,  25670,  25801,  25669,  25801,  25669,  25802,  25668,  25802,  25668,  25803,
+       25667,  25803,  25667,  25804,  25666,  25805,  25665,  25806,  25664,  25806,  25663,  25807,
+       25663,  25808,  25662,  25809,  25661,  25810,  25659,  25811,  25658,  25813,  25657,  25814,
+       25655,  25816,  25654,  25817,  25652,  25819,  25651,  25821,  25649,  25822,  25647,  25825,
+       25645,  25827,  25642,  25829,  25640,  25832,  25637,  25835,  25634,  25838,  25631,  25841,
+       25628,  25844,  25624,  25848,  25620,  25852,  25616,  25857,  25611,  25862,  25605,  25868,
+       25599,  25874,  25593,  25881,  25585,  25889,  25577,  25898,  25568,  25907,  25557,  25919,
+       25545,  25932,  25531,  25947,  25515,  25965,  25495,  25986,  25472,  26012,  25443,  26044,
+       25407,  26084,  25361,  26138,  25300,  26210,  25213,  26314,  25084,  26478,  24870,  26771,
+       24446,  27439,  23234,  30341,      0, -30341, -23234, -27439, -24446, -26771, -24870, -26478,
+      -25084, -26314, -25213, -26210, -25300, -26138, -25361, -26084, -25407, -26044, -25443, -26012,
+      -25472, -25986, -25495, -25965, -25515, -25947, -25531, -25932, -25545, -25919, -25557, -25907,
+      -25568, -25898, -25577, -25889, -25585, -25881, -25593, -25874, -25599, -25868, -25605, -25862,
+      -25611, -25857, -25616, -25852, -25620, -25848, -25624, -25844, -25628, -25841, -25631, -25838,
+      -25634, -25835, -25637, -25832, -25640, -25829, -25642, -25827, -25645, -25825, -25647, -25822,
+      -25649, -25821, -25651, -25819, -25652, -25817, -25654, -25816, -25655, -25814, -25657, -25813,
+      -25658, -25811, -25659, -25810, -25661, -25809, -25662, -25808, -25663, -25807, -25663, -25806,
+      -25664, -25806, -25665, -25805, -25666, -25804, -25667, -25803, -25667, -25803, -25668, -25802,
+      -25668, -25802, -25669, -25801, -25669, -25801, -25670, -25801, -25670, -25800, -25670, -25800,
+      -25670, -25800, -25671, -25800, -25671, -25799, -25671, -25799, -25671, -25799, -25671, -25799,
+      -25671, -25799, -25671, -25799, -25671, -25799, -25671, -25799, -25671, -25800, -25671, -25800,
+      -25670, -25800, -25670, -25800, -25670, -25801, -25670, -25801, -25669, -25801, -25669, -25802,
+      -25668, -25802, -25668, -25803, -25667, -25803, -25667, -25804, -25666, -25805, -25665, -25806,
+      -25664, -25806, -25663, -25807, -25663, -25808, -25662, -25809, -25661, -25810, -25659, -25811,
+      -25658, -25813, -25657, -25814, -25655, -25816, -25654, -25817, -25652, -25819, -25651, -25821,
+      -25649, -25822, -25647, -25825, -25645, -25827, -25642, -25829, -25640, -25832, -25637, -25835,
+      -25634, -25838, -25631, -25841, -25628, -25844, -25624, -25848, -25620, -25852, -25616, -25857,
+      -25611, -25862, -25605, -25868, -25599, -25874, -25593, -25881, -25585, -25889, -25577, -25898,
+      -25568, -25907, -25557, -25919, -25545, -25932, -25531, -25947, -25515, -25965, -25495, -25986,
+      -25472, -26012, -25443, -26044, -25407, -26084, -25361, -26138, -25300, -26210, -25213, -26314,
+      -25084, -26478, -24870, -26771, -24446, -27439, -23234, -30341,
+    },
+  },
+  { // triangle
+    { // level 0, 1 harmonic
+      -26602, -26600, -26594, -26584, -26570, -26552, -26530, -26504, -26474, -26440, -26402, -26360,
+      -26314, -26264, -26210, -26153, -26091, -26025, -25956, -25882, -25805, -25724, -25638, -25549,
+      -25457, -25360, -25259, -25155, -25047, -24935, -24820, -24700, -24577, -24450, -24320, -24186,
+      -24048, -23907, -23762, -23613, -23461, -23305, -23146, -22983, -22817, -22648, -22475, -22298,
+      -22119, -21936, -21749, -21560, -21367, -21171, -20972, -20769, -20564, -20355, -20143, -19929,
+      -19711, -19490, -19266, -19040, -18810, -18578, -18343, -18105, -17865, -17622, -17376, -17127,
+      -16876, -16623, -16366, -16108, -15847, -15583, -15318, -15050, -14779, -14507, -14232, -13955,
+      -13676, -13395, -13112, -12827, -12540, -12251, -11961, -11668, -11374, -11078, -10780, -10481,
+      -10180,  -9878,  -9574,  -9269,  -8962,  -8654,  -8345,  -8034,  -7722,  -7409,  -7095,  -6780,
+       -6464,  -6147,  -5829,  -5510,  -5190,  -4869,  -4548,  -4226,  -3903,  -3580,  -3256,  -2932,
+       -2607,  -2282,  -1957,  -1631,  -1305,   -979,   -653,   -326,      0,    326,    653,    979,
+        1305,   1631,   1957,   2282,   2607,   2932,   3256,   3580,   3903,   4226,   4548,   4869,
+        5190,   5510,   5829,   6147,   6464,   6780,   7095,   7409,   7722,   8034,   8345,   8654,
+        8962,   9269,   9574,   9878,  10180,  10481,  10780,  11078,  11374,  11668,  11961,  12251,
+       12540,  12827,  13112,  13395,  13676,  13955,  14232,  14507,  14779,  15050,  15318,  15583,
+       15847,  16108,  16366,  16623,  16876,  17127,  17376,  17622,  17865,  18105,  18343,  18578,
+       18810,  19040,  19266,  19490,  19711,  19929,  20143,  20355,  20564,  20769,  20972,  21171,
+       21367,  21560,  21749,  21936,  22119,  22298,  22475,  22648,  22817,  22983,  23146,  23305,
+       23461,  23613,  23762,  23907,  24048,  24186,  24320,  24450,  24577,  24700,  24820,  24935,
+       25047,  25155,  25259,  25360,  25457,  25549,  25638,  25724,  25805,  25882,  25956,  26025,
+       26091,  26153,  26210,  26264,  26314,  26360,  26402,  26440,  26474,  26504,  26530,  26552,
+       26570,  26584,  26594,  26600,  26602,  26600,  26594,  26584,  26570,  26552,  26530,  26504,
+       26474,  26440,  26402,  26360,  26314,  26264,  26210,  26153,  26091,  26025,  25956,  25882,
+       25805,  25724,  25638,  25549,  25457,  25360,  25259,  25155,  25047,  24935,  24820,  24700,
+       24577,  24450,  24320,  24186,  24048,  23907,  23762,  23613,  23461,  23305,  23146,  22983,
+       22817,  22648,  22475,  22298,  22119,  21936,  21749,  21560,  21367,  21171,  20972,  20769,
+       20564,  20355,  20143,  19929,  19711,  19490,  19266,  19040,  18810,  18578,  18343,  18105,
+       17865,  17622,  17376,  17127,  16876,  16623,  16366,  16108,  15847,  15583,  15318,  15050,
+       14779,  14507,  14232,  13955,  13676,  13395,  13112,  12827,  12540,  12251,  11961,  11668,
+       11374,  11078,  10780,  10481,  10180,   9878,   9574,   9269,   8962,   8654,   8345,   8034,
+        7722,   7409,   7095,   6780,   6464,   6147,   5829,   5510,   5190,   4869,   4548,   4226,
+        3903,   3580,   3256,   2932,   2607,   2282,   1957,   1631,   1305,    979,    653,    326,
+           0,   -326,   -653,   -979,  -1305,  -1631,  -1957,  -2282,  -2607,  -2932,  -3256,  -3580,
+       -3903,  -4226,  -4548,  -4869,  -5190,  -5510,  -5829,  -6147,  -6464,  -6780,  -7095,  -7409,
+       -7722,  -8034,  -8345,  -8654,  -8962,  -9269,  -9574,  -9878, -10180, -10481, -10780, -11078,
+      -11374, -11668, -11961, -12251, -12540, -12827, -13112, -13395, -13676, -13955, -14232, -14507,
+      -14779, -15050, -15318, -15583, -15847, -16108, -16366, -16623, -16876, -17127, -17376, -17622,
+      -17865, -18105, -18343, -18578, -18810, -19040, -19266, -19490, -19711, -19929, -20143, -20355,
+      -20564, -20769, -20972, -21171, -21367, -21560, -21749, -21936, -22119, -22298, -22475, -22648,
+      -22817, -22983, -23146, -23305, -23461, -23613, -23762, -23907, -24048, -24186, -24320, -24450,
+      -24577, -24700, -24820, -24935, -25047, -25155, -25259, -25360, -25457, -25549, -25638, -25724,
+      -25805, -25882, -25956, -26025, -26091, -26153, -26210, -26264, -26314, -26360, -26402, -26440,
+      -26474, -26504, -26530, -26552, -26570, -26584, -26594, -26600,
+    },
+    { // level 1, 2 harmonics
+      -26602, -26600, -26594, -26584, -26570, -26552, -26530, -26504, -26474, -26440, -26402, -26360,
+      -26314, -26264, -26210, -26153, -26091, -26025, -25956, -25882, -25805, -25724, -25638, -25549,
+      -25457, -25360, -25259, -25155, -25047, -24935, -24820, -24700, -24577, -24450, -24320, -24186,
+      -24048, -23907, -23762, -23613, -23461, -23305, -23146, -22983, -22817, -22648, -22475, -22298,
+      -22119, -21936, -21749, -21560, -21367, -21171, -20972, -20769, -20564, -20355, -20143, -19929,
+      -19711, -19490, -19266, -19040, -18810, -18578, -18343, -18105, -17865, -17622, -17376, -17127,
+      -16876, -16623, -16366, -16108, -15847, -15583, -15318, -15050, -14779, -14507, -14232, -13955,
+      -13676, -13395, -13112, -12827, -12540, -12251, -11961, -11668, -11374, -11078, -10780, -10481,
+      -10180,  -9878,  -9574,  -9269,  -8962,  -8654,  -8345,  -8034,  -7722,  -7409,  -7095,  -6780,
+       -6464,  -6147,  -5829,  -5510,  -5190,  -4869,  -4548,  -4226,  -3903,  -3580,  -3256,  -2932,
+       -2607,  -2282,  -1957,  -1631,  -1305,   -979,   -653,   -326,      0,    326,    653,    979,
+        1305,   1631,   1957,   2282,   2607,   2932,   3256,   3580,   3903,   4226,   4548,   4869,
+        5190,   5510,   5829,   6147,   6464,   6780,   7095,   7409,   7722,   8034,   8345,   8654,
+        8962,   9269,   9574,   9878,  10180,  10481,  10780,  11078,  11374,  11668,  11961,  12251,
+       12540,  12827,  13112,  13395,  13676,  13955,  14232,  14507,  14779,  15050,  15318,  15583,
+       15847,  16108,  16366,  16623,  16876,  17127,  17376,  17622,  17865,  18105,  18343,  18578,
+       18810,  19040,  19266,  19490,  19711,  19929,  20143,  20355,  20564,  20769,  20972,  21171,
+       21367,  21560,  21749,  21936,  22119,  22298,  22475,  22648,  22817,  22983,  23146,  23305,
+       23461,  23613,  23762,  23907,  24048,  24186,  24320,  24450,  24577,  24700,  24820,  24935,
+       25047,  25155,  25259,  25360,  25457,  25549,  25638,  25724,  25805,  25882,  25956,  26025,
+       26091,  26153,  26210,  26264,  26314,  26360,  26402,  26440,  26474,  26504,  26530,  26552,
+       26570,  26584,  26594,  26600,  26602,  26600,  26594,  26584,  26570,  26552,  26530,  26504,
+       26474,  26440,  26402,  26360,  26314,  26264,  26210,  26153,  26091,  26025,  25956,  25882,
+       25805,  25724,  25638,  25549,  25457,  25360,  25259,  25155,  25047,  24935,  24820,  24700,
+       24577,  24450,  24320,  24186,  24048,  23907,  23762,  23613,  23461,  23305,  23146,  22983,
+       22817,  22648,  22475,  22298,  22119,  21936,  21749,  21560,  21367,  21171,  20972,  20769,
+       20564,  20355,  20143,  19929,  19711,  19490,  19266,  19040,  18810,  18578,  18343,  18105,
+       17865,  17622,  17376,  17127,  16876,  16623,  16366,  16108,  15847,  15583,  15318,  15050,
+       14779,  14507,  14232,  13955,  13676,  13395,  13112,  12827,  12540,  12251,  11961,  11668,
+       11374,  11078,  10780,  10481,  10180,   9878,   9574,   9269,   8962,   8654,   8345,   8034,
+        7722,   7409,   7095,   6780,   6464,   6147,   5829,   5510,   5190,   4869,   4548,   4226,
+        3903,   3580,   3256,   2932,   2607,   2282,   1957,   1631,   1305,    979,    653,    326,
+           0,   -326,   -653,   -979,  -1305,  -1631,  -1957,  -2282,  -2607,  -2932,  -3256,  -3580,
+       -3903,  -4226,  -4548,  -4869,  -5190,  -5510,  -5829,  -6147,  -6464,  -6780,  -7095,  -7409,
+       -7722,  -8034,  -8345,  -8654,  -8962,  -9269,  -9574,  -9878, -10180, -10481, -10780, -11078,
+      -11374, -11668, -11961, -12251, -12540, -12827, -13112, -13395, -13676, -13955, -14232, -14507,
+      -14779, -15050, -15318, -15583, -15847, -16108, -16366, -16623, -16876, -17127, -17376, -17622,
+      -17865, -18105, -18343, -18578, -18810, -19040, -19266, -19490, -19711, -19929, -20143, -20355,
+      -20564, -20769, -20972, -21171, -21367, -21560, -21749, -21936, -22119, -22298, -22475, -22648,
+      -22817, -22983, -23146, -23305, -23461, -23613, -23762, -23907, -24048, -24186, -24320, -24450,
+      -24577, -24700, -24820, -24935, -25047, -25155, -25259, -25360, -25457, -25549, -25638, -25724,
+      -25805, -25882, -25956, -26025, -26091, -26153, -26210, -26264, -26314, -26360, -26402, -26440,
+      -26474, -26504, -26530, -26552, -26570, -26584, -26594, -26600,
+    },
+    { // level 2, 4 harmonics
+      -29558, -29554, -29542, -29522, -29494, -29458, -29414, -29362, -29302, -29235, -29160, -29077,
+      -28986, -28888, -28782, -28669, -28549, -28421, -28286, -28144, -27995, -27839, -27677, -27507,
+      -27332, -27150, -26961, -26767, -26567, -26360, -26148, -25931, -25708, -25480, -25247, -25009,
+      -24766, -24519, -24267, -24011, -23751, -23487, -23219, -22947, -22672, -22394, -22113, -21829,
+      -21542, -21253, -20961, -20667, -20371, -20073, -19774, -19473, -19170, -18867, -18562, -18256,
+      -17950, -17643, -17336, -17028, -16720, -16413, -16105, -15798, -15491, -15184, -14879, -14574,
+      -14269, -13966, -13664, -13363, -13064, -12766, -12469, -12174, -11880, -11589, -11298, -11010,
+      -10724, -10440, -10157,  -9877,  -9599,  -9322,  -9048,  -8776,  -8507,  -8239,  -7974,  -7710,
+       -7449,  -7190,  -6934,  -6679,  -6427,  -6176,  -5928,  -5682,  -5437,  -5195,  -4954,  -4716,
+       -4479,  -4244,  -4010,  -3778,  -3548,  -3319,  -3091,  -2865,  -2640,  -2416,  -2193,  -1971,
+       -1749,  -1529,  -1309,  -1090,   -872,   -653,   -435,   -218,      0,    218,    435,    653,
+         872,   1090,   1309,   1529,   1749,   1971,   2193,   2416,   2640,   2865,   3091,   3319,
+        3548,   3778,   4010,   4244,   4479,   4716,   4954,   5195,   5437,   5682,   5928,   6176,
+        6427,   6679,   6934,   7190,   7449,   7710,   7974,   8239,   8507,   8776,   9048,   9322,
+        9599,   9877,  10157,  10440,  10724,  11010,  11298,  11589,  11880,  12174,  12469,  12766,
+       13064,  13363,  13664,  13966,  14269,  14574,  14879,  15184,  15491,  15798,  16105,  16413,
+       16720,  17028,  17336,  17643,  17950,  18256,  18562,  18867,  19170,  19473,  19774,  20073,
+       20371,  20667,  20961,  21253,  21542,  21829,  22113,  22394,  22672,  22947,  23219,  23487,
+       23751,  24011,  24267,  24519,  24766,  25009,  25247,  25480,  25708,  25931,  26148,  26360,
+       26567,  26767,  26961,  27150,  27332,  27507,  27677,  27839,  27995,  28144,  28286,  28421,
+       28549,  28669,  28782,  28888,  28986,  29077,  29160,  29235,  29302,  29362,  29414,  29458,
+       29494,  29522,  29542,  29554,  29558,  29554,  29542,  29522,  29494,  29458,  29414,  29362,
+       29302,  29235,  29160,  29077,  28986,  28888,  28782,  28669,  28549,  28421,  28286,  28144,
+       27995,  27839,  27677,  27507,  27332,  27150,  26961,  26767,  26567,  26360,  26148,  25931,
+       25708,  25480,  25247,  25009,  24766,  24519,  24267,  24011,  23751,  23487,  23219,  22947,
+       22672,  22394,  22113,  21829,  21542,  21253,  20961,  20667,  20371,  20073,  19774,  19473,
+       19170,  18867,  18562,  18256,  17950,  17643,  17336,  17028,  16720,  16413,  16105,  15798,
+       15491,  15184,  14879,  14574,  14269,  13966,  13664,  13363,  13064,  12766,  12469,  12174,
+       11880,  11589,  11298,  11010,  10724,  10440,  10157,   9877,   9599,   9322,   9048,   8776,
+        8507,   8239,   7974,   7710,   7449,   7190,   6934,   6679,   6427,   6176,   5928,   5682,
+        5437,   5195,   4954,   4716,   4479,   4244,   4010,   3778,   3548,   3319,   3091,   2865,
+        2640,   2416,   2193,   1971,   1749,   1529,   1309,   1090,    872,    653,    435,    218,
+           0,   -218,   -435,   -653,   -872,  -1090,  -1309,  -1529,  -1749,  -1971,  -2193,  -2416,
+       -2640,  -2865,  -3091,  -3319,  -3548,  -3778,  -4010,  -4244,  -4479,  -4716,  -4954,  -5195,
+       -5437,  -5682,  -5928,  -6176,  -6427,  -6679,  -6934,  -7190,  -7449,  -7710,  -7974,  -8239,
+       -8507,  -8776,  -9048,  -9322,  -9599,  -9877, -10157, -10440, -10724, -11010, -11298, -11589,
+      -11880, -12174, -12469, -12766, -13064, -13363, -13664, -13966, -14269, -14574, -14879, -15184,
+      -15491, -15798, -16105, -16413, -16720, -17028, -17336, -17643, -17950, -18256, -18562, -18867,
+      -19170, -19473, -19774, -20073, -20371, -20667, -20961, -21253, -21542, -21829, -22113, -22394,
+      -22672, -22947, -23219, -23487, -23751, -24011, -24267, -24519, -24766, -25009, -25247, -25480,
+      -25708, -25931, -26148, -26360, -26567, -26767, -26961, -27150, -27332, -27507, -27677, -27839,
+      -27995, -28144, -28286, -28421, -28549, -28669, -28782, -28888, -28986, -29077, -29160, -29235,
+      -29302, -29362, -29414, -29458, -29494, -29522, -29542, -29554,
+    },
+    { // level 3, 8 harmonics
+      -31165, -31157, -31133, -31093, -31037, -30966, -30879, -30777, -30661, -30529, -30384, -30226,
+      -30054, -29869, -29673, -29465, -29246, -29016, -28778, -28530, -28274, -28010, -27739, -27463,
+      -27180, -26893, -26601, -26306, -26008, -25708, -25406, -25103, -24799, -24496, -24193, -23891,
+      -23590, -23291, -22994, -22700, -22409, -22120, -21835, -21553, -21274, -20999, -20728, -20461,
+      -20197, -19937, -19680, -19427, -19176, -18930, -18685, -18444, -18205, -17969, -17734, -17501,
+      -17269, -17039, -16810, -16581, -16352, -16123, -15894, -15665, -15434, -15203, -14971, -14737,
+      -14501, -14263, -14024, -13782, -13538, -13292, -13044, -12793, -12539, -12284, -12025, -11765,
+      -11502, -11237, -10971, -10702, -10431, -10159,  -9885,  -9611,  -9335,  -9058,  -8781,  -8503,
+       -8225,  -7947,  -7669,  -7391,  -7115,  -6839,  -6564,  -6290,  -6017,  -5746,  -5477,  -5209,
+       -4944,  -4680,  -4418,  -4158,  -3900,  -3644,  -3390,  -3138,  -2889,  -2640,  -2394,  -2150,
+       -1907,  -1665,  -1425,  -1186,   -947,   -710,   -473,   -236,      0,    236,    473,    710,
+         947,   1186,   1425,   1665,   1907,   2150,   2394,   2640,   2889,   3138,   3390,   3644,
+        3900,   4158,   4418,   4680,   4944,   5209,   5477,   5746,   6017,   6290,   6564,   6839,
+        7115,   7391,   7669,   7947,   8225,   8503,   8781,   9058,   9335,   9611,   9885,  10159,
+       10431,  10702,  10971,  11237,  11502,  11765,  12025,  12284,  12539,  12793,  13044,  13292,
+       13538,  13782,  14024,  14263,  14501,  14737,  14971,  15203,  15434,  15665,  15894,  16123,
+       16352,  16581,  16810,  17039,  17269,  17501,  17734,  17969,  18205,  18444,  18685,  18930,
+       19176,  19427,  19680,  19937,  20197,  20461,  20728,  20999,  21274,  21553,  21835,  22120,
+       22409,  22700,  22994,  23291,  23590,  23891,  24193,  24496,  24799,  25103,  25406,  25708,
+       26008,  26306,  26601,  26893,  27180,  27463,  27739,  28010,  28274,  28530,  28778,  29016,
+       29246,  29465,  29673,  29869,  30054,  30226,  30384,  30529,  30661,  30777,  30879,  30966,
+       31037,  31093,  31133,  31157,  31165,  31157,  31133,  31093,  31037,  30966,  30879,  30777,
+       30661,  30529,  30384,  30226,  30054,  29869,  29673,  29465,  29246,  29016,  28778,  28530,
+       28274,  28010,  27739,  27463,  27180,  26893,  26601,  26306,  26008,  25708,  25406,  25103,
+       24799,  24496,  24193,  23891,  23590,  23291,  22994,  22700,  22409,  22120,  21835,  21553,
+       21274,  20999,  20728,  20461,  20197,  19937,  19680,  19427,  19176,  18930,  18685,  18444,
+       18205,  17969,  17734,  17501,  17269,  17039,  16810,  16581,  16352,  16123,  15894,  15665,
+       15434,  15203,  14971,  14737,  14501,  14263,  14024,  13782,  13538,  13292,  13044,  12793,
+       12539,  12284,  12025,  11765,  11502,  11237,  10971,  10702,  10431,  10159,   9885,   9611,
+        9335,   9058,   8781,   8503,   8225,   7947,   7669,   7391,   7115,   6839,   6564,   6290,
+        6017,   5746,   5477,   5209,   4944,   4680,   4418,   4158,   3900,   3644,   3390,   3138,
+        2889,   2640,   2394,   2150,   1907,   1665,   1425,   1186,    947,    710,    473,    236,
+           0,   -236,   -473,   -710,   -947,  -1186,  -1425,  -1665,  -1907,  -2150,  -2394,  -2640,
+       -2889,  -3138,  -3390,  -3644,  -3900,  -4158,  -4418,  -4680,  -4944,  -5209,  -5477,  -5746,
+       -6017,  -6290,  -6564,  -6839,  -7115,  -7391,  -7669,  -7947,  -8225,  -8503,  -8781,  -9058,
+       -9335,  -9611,  -9885, -10159, -10431, -10702, -10971, -11237, -11502, -11765, -12025, -12284,
+      -12539, -12793, -13044, -13292, -13538, -13782, -14024, -14263, -14501, -14737, -14971, -15203,
+      -15434, -15665, -15894, -16123, -16352, -16581, -16810, -17039, -17269, -17501, -17734, -17969,
+      -18205, -18444, -18685, -18930, -19176, -19427, -19680, -19937, -20197, -20461, -20728, -20999,
+      -21274, -21553, -21835, -22120, -22409, -22700, -22994, -23291, -23590, -23891, -24193, -24496,
+      -24799, -25103, -25406, -25708, -26008, -26306, -26601, -26893, -27180, -27463, -27739, -28010,
+      -28274, -28530, -28778, -29016, -29246, -29465, -29673, -29869, -30054, -30226, -30384, -30529,
+      -30661, -30777, -30879, -30966, -31037, -31093, -31133, -31157,
+    },
+    { // level 4, 16 harmonics
+      -31989, -31973, -31925, -31846, -31737, -31599, -31433, -31243, -31030, -30796, -30545, -30278,
+      -29999, -29711, -29415, -29115, -28813, -28510, -28210, -27913, -27621, -27334, -27054, -26782,
+      -26516, -26257, -26004, -25757, -25516, -25279, -25044, -24812, -24581, -24350, -24118, -23885,
+      -23648, -23408, -23165, -22917, -22665, -22409, -22149, -21885, -21617, -21347, -21075, -20802,
+      -20527, -20253, -19979, -19707, -19437, -19169, -18904, -18641, -18382, -18126, -17873, -17623,
+      -17375, -17130, -16886, -16643, -16401, -16159, -15916, -15672, -15427, -15180, -14930, -14678,
+      -14424, -14167, -13907, -13645, -13381, -13116, -12849, -12581, -12312, -12044, -11776, -11508,
+      -11243, -10978, -10716, -10456, -10198,  -9942,  -9689,  -9438,  -9188,  -8940,  -8693,  -8447,
+       -8202,  -7956,  -7711,  -7464,  -7216,  -6967,  -6715,  -6462,  -6207,  -5950,  -5691,  -5429,
+       -5166,  -4902,  -4637,  -4370,  -4104,  -3837,  -3571,  -3305,  -3041,  -2778,  -2516,  -2257,
+       -2000,  -1744,  -1491,  -1239,   -989,   -740,   -493,   -246,      0,    246,    493,    740,
+         989,   1239,   1491,   1744,   2000,   2257,   2516,   2778,   3041,   3305,   3571,   3837,
+        4104,   4370,   4637,   4902,   5166,   5429,   5691,   5950,   6207,   6462,   6715,   6967,
+        7216,   7464,   7711,   7956,   8202,   8447,   8693,   8940,   9188,   9438,   9689,   9942,
+       10198,  10456,  10716,  10978,  11243,  11508,  11776,  12044,  12312,  12581,  12849,  13116,
+       13381,  13645,  13907,  14167,  14424,  14678,  14930,  15180,  15427,  15672,  15916,  16159,
+       16401,  16643,  16886,  17130,  17375,  17623,  17873,  18126,  18382,  18641,  18904,  19169,
+       19437,  19707,  19979,  20253,  20527,  20802,  21075,  21347,  21617,  21885,  22149,  22409,
+       22665,  22917,  23165,  23408,  23648,  23885,  24118,  24350,  24581,  24812,  25044,  25279,
+       25516,  25757,  26004,  26257,  26516,  26782,  27054,  27334,  27621,  27913,  28210,  28510,
+       28813,  29115,  29415,  29711,  29999,  30278,  30545,  30796,  31030,  31243,  31433,  31599,
+       31737,  31846,  31925,  31973,  31989,  31973,  31925,  31846,  31737,  31599,  31433,  31243,
+       31030,  30796,  30545,  30278,  29999,  29711,  29415,  29115,  28813,  28510,  28210,  27913,
+       27621,  27334,  27054,  26782,  26516,  26257,  26004,  25757,  25516,  25279,  25044,  24812,
+       24581,  24350,  24118,  23885,  23648,  23408,  23165,  22917,  22665,  22409,  22149,  21885,
+       21617,  21347,  21075,  20802,  20527,  20253,  19979,  19707,  19437,  19169,  18904,  18641,
+       18382,  18126,  17873,  17623,  17375,  17130,  16886,  16643,  16401,  16159,  15916,  15672,
+       15427,  15180,  14930,  14678,  14424,  14167,  13907,  13645,  13381,  13116,  12849,  12581,
+       12312,  12044,  11776,  11508,  11243,  10978,  10716,  10456,  10198,   9942,   9689,   9438,
+        9188,   8940,   8693,   8447,   8202,   7956,   7711,   7464,   7216,   6967,   6715,   6462,
+        6207,   5950,   5691,   5429,   5166,   4902,   4637,   4370,   4104,   3837,   3571,   3305,
+        3041,   2778,   2516,   2257,   2000,   1744,   1491,   1239,    989,    740,    493,    246,
+           0,   -246,   -493,   -740,   -989,  -1239,  -1491,  -1744,  -2000,  -2257,  -2516,  -2778,
+       -3041,  -3305,  -3571,  -3837,  -4104,  -4370,  -4637,  -4902,  -5166,  -5429,  -5691,  -5950,
+       -6207,  -6462,  -6715,  -6967,  -7216,  -7464,  -7711,  -7956,  -8202,  -8447,  -8693,  -8940,
+       -9188,  -9438,  -9689,  -9942, -10198, -10456, -10716, -10978, -11243, -11508, -11776, -12044,
+      -12312, -12581, -12849, -13116, -13381, -13645, -13907, -14167, -14424, -14678, -14930, -15180,
+      -15427, -15672, -15916, -16159, -16401, -16643, -16886, -17130, -17375, -17623, -17873, -18126,
+      -18382, -18641, -18904, -19169, -19437, -19707, -19979, -20253, -20527, -20802, -21075, -21347,
+      -21617, -21885, -22149, -22409, -22665, -22917, -23165, -23408, -23648, -23885, -24118, -24350,
+      -24581, -24812, -25044, -25279, -25516, -25757, -26004, -26257, -26516, -26782, -27054, -27334,
+      -27621, -27913, -28210, -28510, -28813, -29115, -29415, -29711, -29999, -30278, -30545, -30796,
+      -31030, -31243, -31433, -31599, -31737, -31846, -31925, -31973,
+    },
+    { // level 5, 32 harmonics
+      -32403, -32372, -32277, -32126, -31924, -31682, -31409, -31117, -30816, -30515, -30221, -29938,
+      -29668, -29412, -29168, -28932, -28700, -28468, -28232, -27990, -27740, -27482, -27217, -26947,
+      -26674, -26400, -26130, -25864, -25603, -25348, -25099, -24853, -24609, -24366, -24120, -23871,
+      -23618, -23360, -23098, -22833, -22566, -22299, -22034, -21771, -21513, -21258, -21006, -20757,
+      -20510, -20262, -20013, -19762, -19508, -19250, -18989, -18726, -18462, -18198, -17935, -17674,
+      -17416, -17161, -16908, -16658, -16408, -16159, -15909, -15656, -15401, -15144, -14884, -14622,
+      -14359, -14096, -13834, -13574, -13317, -13061, -12808, -12557, -12306, -12056, -11805, -11552,
+      -11297, -11039, -10780, -10518, -10256,  -9994,  -9733,  -9474,  -9216,  -8961,  -8707,  -8455,
+       -8204,  -7953,  -7702,  -7448,  -7193,  -6936,  -6676,  -6415,  -6154,  -5892,  -5631,  -5372,
+       -5115,  -4859,  -4606,  -4354,  -4102,  -3851,  -3599,  -3345,  -3090,  -2832,  -2573,  -2313,
+       -2051,  -1790,  -1529,  -1270,  -1013,   -757,   -504,   -251,      0,    251,    504,    757,
+        1013,   1270,   1529,   1790,   2051,   2313,   2573,   2832,   3090,   3345,   3599,   3851,
+        4102,   4354,   4606,   4859,   5115,   5372,   5631,   5892,   6154,   6415,   6676,   6936,
+        7193,   7448,   7702,   7953,   8204,   8455,   8707,   8961,   9216,   9474,   9733,   9994,
+       10256,  10518,  10780,  11039,  11297,  11552,  11805,  12056,  12306,  12557,  12808,  13061,
+       13317,  13574,  13834,  14096,  14359,  14622,  14884,  15144,  15401,  15656,  15909,  16159,
+       16408,  16658,  16908,  17161,  17416,  17674,  17935,  18198,  18462,  18726,  18989,  19250,
+       19508,  19762,  20013,  20262,  20510,  20757,  21006,  21258,  21513,  21771,  22034,  22299,
+       22566,  22833,  23098,  23360,  23618,  23871,  24120,  24366,  24609,  24853,  25099,  25348,
+       25603,  25864,  26130,  26400,  26674,  26947,  27217,  27482,  27740,  27990,  28232,  28468,
+       28700,  28932,  29168,  29412,  29668,  29938,  30221,  30515,  30816,  31117,  31409,  31682,
+       31924,  32126,  32277,  32372,  32403,  32372,  32277,  32126,  31924,  31682,  31409,  31117,
+       30816,  30515,  30221,  29938,  29668,  29412,  29168,  28932,  28700,  28468,  28232,  27990,
+       27740,  27482,  27217,  26947,  26674,  26400,  26130,  25864,  25603,  25348,  25099,  24853,
+       24609,  24366,  24120,  23871,  23618,  23360,  23098,  22833,  22566,  22299,  22034,  21771,
+       21513,  21258,  21006,  20757,  20510,  20262,  20013,  19762,  19508,  19250,  18989,  18726,
+       18462,  18198,  17935,  17674,  17416,  17161,  16908,  16658,  16408,  16159,  15909,  15656,
+       15401,  15144,  14884,  14622,  14359,  14096,  13834,  13574,  13317,  13061,  12808,  12557,
+       12306,  12056,  11805,  11552,  11297,  11039,  10780,  10518,  10256,   9994,   9733,   9474,
+        9216,   8961,   8707,   8455,   8204,   7953,   7702,   7448,   7193,   6936,   6676,   6415,
+        6154,   5892,   5631,   5372,   5115,   4859,   4606,   4354,   4102,   3851,   3599,   3345,
+        3090,   2832,   2573,   2313,   2051,   1790,   1529,   1270,   1013,    757,    504,    251,
+           0,   -251,   -504,   -757,  -1013,  -1270,  -1529,  -1790,  -2051,  -2313,  -2573,  -2832,
+       -3090,  -3345,  -3599,  -3851,  -4102,  -4354,  -4606,  -4859,  -5115,  -5372,  -5631,  -5892,
+       -6154,  -6415,  -6676,  -6936,  -7193,  -7448,  -7702,  -7953,  -8204,  -8455,  -8707,  -8961,
+       -9216,  -9474,  -9733,  -9994, -10256, -10518, -10780, -11039, -11297, -11552, -11805, -12056,
+      -12306, -12557, -12808, -13061, -13317, -13574, -13834, -14096, -14359, -14622, -14884, -15144,
+      -15401, -15656, -15909, -16159, -16408, -16658, -16908, -17161, -17416, -17674, -17935, -18198,
+      -18462, -18726, -18989, -19250, -19508, -19762, -20013, -20262, -20510, -20757, -21006, -21258,
+      -21513, -21771, -22034, -22299, -22566, -22833, -23098, -23360, -23618, -23871, -24120, -24366,
+      -24609, -24853, -25099, -25348, -25603, -25864, -26130, -26400, -26674, -26947, -27217, -27482,
+      -27740, -27990, -28232, -28468, -28700, -28932, -29168, -29412, -29668, -29938, -30221, -30515,
+      -30816, -31117, -31409, -31682, -31924, -32126, -32277, -32372,
+    },
+    { // level 6, 64 harmonics
+      -32611, -32548, -32371, -32114, -31818, -31520, -31244, -30993, -30759, -30525, -30279, -30018,
+      -29746, -29475, -29211, -28959, -28714, -28469, -28218, -27958, -27693, -27427, -27166, -26913,
+      -26664, -26416, -26163, -25904, -25641, -25377, -25118, -24864, -24614, -24363, -24109, -23851,
+      -23589, -23327, -23069, -22814, -22563, -22311, -22057, -21799, -21538, -21277, -21019, -20764,
+      -20512, -20259, -20005, -19747, -19486, -19226, -18968, -18713, -18460, -18208, -17953, -17695,
+      -17435, -17175, -16918, -16662, -16409, -16156, -15901, -15644, -15384, -15125, -14867, -14612,
+      -14358, -14105, -13850, -13592, -13333, -13074, -12816, -12561, -12307, -12053, -11798, -11541,
+      -11282, -11023, -10765, -10510, -10256, -10002,  -9747,  -9489,  -9230,  -8971,  -8714,  -8459,
+       -8205,  -7951,  -7695,  -7438,  -7179,  -6920,  -6663,  -6408,  -6154,  -5900,  -5644,  -5387,
+       -5128,  -4869,  -4612,  -4356,  -4102,  -3848,  -3593,  -3336,  -3077,  -2818,  -2561,  -2305,
+       -2051,  -1797,  -1542,  -1284,  -1026,   -767,   -510,   -254,      0,    254,    510,    767,
+        1026,   1284,   1542,   1797,   2051,   2305,   2561,   2818,   3077,   3336,   3593,   3848,
+        4102,   4356,   4612,   4869,   5128,   5387,   5644,   5900,   6154,   6408,   6663,   6920,
+        7179,   7438,   7695,   7951,   8205,   8459,   8714,   8971,   9230,   9489,   9747,  10002,
+       10256,  10510,  10765,  11023,  11282,  11541,  11798,  12053,  12307,  12561,  12816,  13074,
+       13333,  13592,  13850,  14105,  14358,  14612,  14867,  15125,  15384,  15644,  15901,  16156,
+       16409,  16662,  16918,  17175,  17435,  17695,  17953,  18208,  18460,  18713,  18968,  19226,
+       19486,  19747,  20005,  20259,  20512,  20764,  21019,  21277,  21538,  21799,  22057,  22311,
+       22563,  22814,  23069,  23327,  23589,  23851,  24109,  24363,  24614,  24864,  25118,  25377,
+       25641,  25904,  26163,  26416,  26664,  26913,  27166,  27427,  27693,  27958,  28218,  28469,
+       28714,  28959,  29211,  29475,  29746,  30018,  30279,  30525,  30759,  30993,  31244,  31520,
+       31818,  32114,  32371,  32548,  32611,  32548,  32371,  32114,  31818,  31520,  31244,  30993,
+       30759,  30525,  30279,  30018,  29746,  29475,  29211,  28959,  28714,  28469,  28218,  27958,
+       27693,  27427,  27166,  26913,  26664,  26416,  26163,  25904,  25641,  25377,  25118,  24864,
+       24614,  24363,  24109,  23851,  23589,  23327,  23069,  22814,  22563,  22311,  22057,  21799,
+       21538,  21277,  21019,  20764,  20512,  20259,  20005,  19747,  19486,  19226,  18968,  18713,
+       18460,  18208,  17953,  17695,  17435,  17175,  16918,  16662,  16409,  16156,  15901,  15644,
+       15384,  15125,  14867,  14612,  14358,  14105,  13850,  13592,  13333,  13074,  12816,  12561,
+       12307,  12053,  11798,  11541,  11282,  11023,  10765,  10510,  10256,  10002,   9747,   9489,
+        9230,   8971,   8714,   8459,   8205,   7951,   7695,   7438,   7179,   6920,   6663,   6408,
+        6154,   5900,   5644,   5387,   5128,   4869,   4612,   4356,   4102,   3848,   3593,   3336,
+        3077,   2818,   2561,   2305,   2051,   1797,   1542,   1284,   1026,    767,    510,    254,
+           0,   -254,   -510,   -767,  -1026,  -1284,  -1542,  -1797,  -2051,  -2305,  -2561,  -2818,
+       -3077,  -3336,  -3593,  -3848,  -4102,  -4356,  -4612,  -4869,  -5128,  -5387,  -5644,  -5900,
+       -6154,  -6408,  -6663,  -6920,  -7179,  -7438,  -7695,  -7951,  -8205,  -8459,  -8714,  -8971,
+       -9230,  -9489,  -9747, -10002, -10256, -10510, -10765, -11023, -11282, -11541, -11798, -12053,
+      -12307, -12561, -12816, -13074, -13333, -13592, -13850, -14105, -14358, -14612, -14867, -15125,
+      -15384, -15644, -15901, -16156, -16409, -16662, -16918, -17175, -17435, -17695, -17953, -18208,
+      -18460, -18713, -18968, -19226, -19486, -19747, -20005, -20259, -20512, -20764, -21019, -21277,
+      -21538, -21799, -22057, -22311, -22563, -22814, -23069, -23327, -23589, -23851, -24109, -24363,
+      -24614, -24864, -25118, -25377, -25641, -25904, -26163, -26416, -26664, -26913, -27166, -27427,
+      -27693, -27958, -28218, -28469, -28714, -28959, -29211, -29475, -29746, -30018, -30279, -30525,
+      -30759, -30993, -31244, -31520, -31818, -32114, -32371, -32548,
+    },
+    { // level 7, 128 harmonics
+      -32715, -32595, -32318, -32031, -31789, -31549, -31283, -31015, -30767, -30519, -30256, -29993,
+      -29742, -29491, -29230, -28969, -28716, -28464, -28204, -27944, -27691, -27438, -27178, -26919,
+      -26665, -26412, -26153, -25894, -25640, -25386, -25127, -24868, -24614, -24360, -24101, -23843,
+      -23589, -23334, -23076, -22818, -22563, -22308, -22050, -21792, -21537, -21283, -21025, -20767,
+      -20512, -20257, -19999, -19741, -19486, -19231, -18973, -18716, -18461, -18206, -17948, -17690,
+      -17435, -17180, -16922, -16665, -16409, -16154, -15897, -15639, -15384, -15129, -14871, -14614,
+      -14358, -14103, -13846, -13588, -13333, -13077, -12820, -12563, -12307, -12052, -11794, -11537,
+      -11282, -11026, -10769, -10511, -10256, -10000,  -9743,  -9486,  -9230,  -8975,  -8718,  -8460,
+       -8205,  -7949,  -7692,  -7435,  -7179,  -6924,  -6666,  -6409,  -6154,  -5898,  -5641,  -5384,
+       -5128,  -4872,  -4615,  -4358,  -4102,  -3847,  -3590,  -3332,  -3077,  -2821,  -2564,  -2307,
+       -2051,  -1796,  -1538,  -1281,  -1026,   -770,   -513,   -256,      0,    256,    513,    770,
+        1026,   1281,   1538,   1796,   2051,   2307,   2564,   2821,   3077,   3332,   3590,   3847,
+        4102,   4358,   4615,   4872,   5128,   5384,   5641,   5898,   6154,   6409,   6666,   6924,
+        7179,   7435,   7692,   7949,   8205,   8460,   8718,   8975,   9230,   9486,   9743,  10000,
+       10256,  10511,  10769,  11026,  11282,  11537,  11794,  12052,  12307,  12563,  12820,  13077,
+       13333,  13588,  13846,  14103,  14358,  14614,  14871,  15129,  15384,  15639,  15897,  16154,
+       16409,  16665,  16922,  17180,  17435,  17690,  17948,  18206,  18461,  18716,  18973,  19231,
+       19486,  19741,  19999,  20257,  20512,  20767,  21025,  21283,  21537,  21792,  22050,  22308,
+       22563,  22818,  23076,  23334,  23589,  23843,  24101,  24360,  24614,  24868,  25127,  25386,
+       25640,  25894,  26153,  26412,  26665,  26919,  27178,  27438,  27691,  27944,  28204,  28464,
+       28716,  28969,  29230,  29491,  29742,  29993,  30256,  30519,  30767,  31015,  31283,  31549,
+       31789,  32031,  32318,  32595,  32715,  32595,  32318,  32031,  31789,  31549,  31283,  31015,
+       30767,  30519,  30256,  29993,  29742,  29491,  29230,  28969,  28716,  28464,  28204,  27944,
+       27691,  27438,  27178,  26919,  26665,  26412,  26153,  25894,  25640,  25386,  25127,  24868,
+       24614,  24360,  24101,  23843,  23589,  23334,  23076,  22818,  22563,  22308,  22050,  21792,
+       21537,  21283,  21025,  20767,  20512,  20257,  19999,  19741,  19486,  19231,  18973,  18716,
+       18461,  18206,  17948,  17690,  17435,  17180,  16922,  16665,  16409,  16154,  15897,  15639,
+       15384,  15129,  14871,  14614,  14358,  14103,  13846,  13588,  13333,  13077,  12820,  12563,
+       12307,  12052,  11794,  11537,  11282,  11026,  10769,  10511,  10256,  10000,   9743,   9486,
+        9230,   8975,   8718,   8460,   8205,   7949,   7692,   7435,   7179,   6924,   6666,   6409,
+        6154,   5898,   5641,   5384,   5128,   4872,   4615,   4358,   4102,   3847,   3590,   3332,
+        3077,   2821,   2564,   2307,   2051,   1796,   1538,   1281,   1026,    770,    513,    256,
+           0,   -256,   -513,   -770,  -1026,  -1281,  -1538,  -1796,  -2051,  -2307,  -2564,  -2821,
+       -3077,  -3332,  -3590,  -3847,  -4102,  -4358,  -4615,  -4872,  -5128,  -5384,  -5641,  -5898,
+       -6154,  -6409,  -6666,  -6924,  -7179,  -7435,  -7692,  -7949,  -8205,  -8460,  -8718,  -8975,
+       -9230,  -9486,  -9743, -10000, -10256, -10511, -10769, -11026, -11282, -11537, -11794, -12052,
+      -12307, -12563, -12820, -13077, -13333, -13588, -13846, -14103, -14358, -14614, -14871, -15129,
+      -15384, -15639, -15897, -16154, -16409, -16665, -16922, -17180, -17435, -17690, -17948, -18206,
+      -18461, -18716, -18973, -19231, -19486, -19741, -19999, -20257, -20512, -20767, -21025, -21283,
+      -21537, -21792, -22050, -22308, -22563, -22818, -23076, -23334, -23589, -23843, -24101, -24360,
+      -24614, -24868, -25127, -25386, -25640, -25894, -26153, -26412, -26665, -26919, -27178, -27438,
+      -27691, -27944, -28204, -28464, -28716, -28969, -29230, -29491, -29742, -29993, -30256, -30519,
+      -30767, -31015, -31283, -31549, -31789, -32031, -32318, -32595,
+    },
+    { // level 8, 255 harmonics
+      -32767, -32569, -32304, -32051, -31793, -31537, -31280, -31024, -30768, -30512, -30255, -29999,
+      -29742, -29486, -29229, -28973, -28717, -28460, -28204, -27947, -27691, -27435, -27178, -26922,
+      -26665, -26409, -26153, -25896, -25640, -25383, -25127, -24871, -24614, -24358, -24101, -23845,
+      -23589, -23332, -23076, -22819, -22563, -22307, -22050, -21794, -21537, -21281, -21025, -20768,
+      -20512, -20255, -19999, -19743, -19486, -19230, -18973, -18717, -18461, -18204, -17948, -17691,
+      -17435, -17179, -16922, -16666, -16409, -16153, -15897, -15640, -15384, -15127, -14871, -14615,
+      -14358, -14102, -13845, -13589, -13333, -13076, -12820, -12564, -12307, -12051, -11794, -11538,
+      -11282, -11025, -10769, -10512, -10256, -10000,  -9743,  -9487,  -9230,  -8974,  -8718,  -8461,
+       -8205,  -7948,  -7692,  -7436,  -7179,  -6923,  -6666,  -6410,  -6154,  -5897,  -5641,  -5384,
+       -5128,  -4872,  -4615,  -4359,  -4102,  -3846,  -3590,  -3333,  -3077,  -2820,  -2564,  -2308,
+       -2051,  -1795,  -1538,  -1282,  -1026,   -769,   -513,   -256,      0,    256,    513,    769,
+        1026,   1282,   1538,   1795,   2051,   2308,   2564,   2820,   3077,   3333,   3590,   3846,
+        4102,   4359,   4615,   4872,   5128,   5384,   5641,   5897,   6154,   6410,   6666,   6923,
+        7179,   7436,   7692,   7948,   8205,   8461,   8718,   8974,   9230,   9487,   9743,  10000,
+       10256,  10512,  10769,  11025,  11282,  11538,  11794,  12051,  12307,  12564,  12820,  13076,
+       13333,  13589,  13845,  14102,  14358,  14615,  14871,  15127,  15384,  15640,  15897,  16153,
+       16409,  16666,  16922,  17179,  17435,  17691,  17948,  18204,  18461,  18717,  18973,  19230,
+       19486,  19743,  19999,  20255,  20512,  20768,  21025,  21281,  21537,  21794,  22050,  22307,
+       22563,  22819,  23076,  23332,  23589,  23845,  24101,  24358,  24614,  24871,  25127,  25383,
+       25640,  25896,  26153,  26409,  26665,  26922,  27178,  27435,  27691,  27947,  28204,  28460,
+       28717,  28973,  29229,  29486,  29742,  29999,  30255,  30512,  30768,  31024,  31280,  31537,
+       31793,  32051,  32304,  32569,  32767,  32569,  32304,  32051,  31793,  31537,  31280,  31024,
+       30768,  30512,  30255,  29999,  29742,  29486,  29229,  28973,  28717,  28460,  28204,  27947,
+       27691,  27435,  27178,  26922,  26665,  26409,  26153,  25896,  25640,  25383,  25127,  24871,
+       24614,  24358,  24101,  23845,  23589,  23332,  23076,  22819,  22563,  22307,  22050,  21794,
+       21537,  21281,  21025,  20768,  20512,  20255,  19999,  19743,  19486,  19230,  18973,  18717,
+       18461,  18204,  17948,  17691,  17435,  17179,  16922,  16666,  16409,  16153,  15897,  15640,
+       15384,  15127,  14871,  14615,  14358,  14102,  13845,  13589,  13333,  13076,  12820,  12564,
+       12307,  12051,  11794,  11538,  11282,  11025,  10769,  10512,  10256,  10000,   9743,   9487,
+        9230,   8974,   8718,   8461,   8205,   7948,   7692,   7436,   7179,   6923,   6666,   6410,
+        6154,   5897,   5641,   5384,   5128,   4872,   4615,   4359,   4102,   3846,   3590,   3333,
+        3077,   2820,   2564,   2308,   2051,   1795,   1538,   1282,   1026,    769,    513,    256,
+           0,   -256,   -513,   -769,  -1026,  -1282,  -1538,  -1795,  -2051,  -2308,  -2564,  -2820,
+       -3077,  -3333,  -3590,  -3846,  -4102,  -4359,  -4615,  -4872,  -5128,  -5384,  -5641,  -5897,
+       -6154,  -6410,  -6666,  -6923,  -7179,  -7436,  -7692,  -7948,  -8205,  -8461,  -8718,  -8974,
+       -9230,  -9487,  -9743, -10000, -10256, -10512, -10769, -11025, -11282, -11538, -11794, -12051,
+      -12307, -12564, -12820, -13076, -13333, -13589, -13845, -14102, -14358, -14615, -14871, -15127,
+      -15384, -15640, -15897, -16153, -16409, -16666, -16922, -17179, -17435, -17691, -17948, -18204,
+      -18461, -18717, -18973, -19230, -19486, -19743, -19999, -20255, -20512, -20768, -21025, -21281,
+      -21537, -21794, -22050, -22307, -22563, -22819, -23076, -23332, -23589, -23845, -24101, -24358,
+      -24614, -24871, -25127, -25383, -25640, -25896, -26153, -26409, -26665, -26922, -27178, -27435,
+      -27691, -27947, -28204, -28460, -28717, -28973, -29229, -29486, -29742, -29999, -30255, -30512,
+      -30768, -31024, -31280, -31537, -31793, -32051, -32304, -32569,
+    },
+  },
+};
+
+#endif // USE_BANDLIMITED_TABLES
@@ -0,0 +1,43 @@
+// AudioWavetables.h - ESP32 Audio OS v2.0
+// Band-limited mip-mapped wavetables (sawtooth, square, triangle)
+//
+// One table per octave of phase increment. Level 0 serves the highest notes
+// (increment of 1/4..1/2 cycle per sample, fundamental only) and every level
+// below doubles the harmonic count, up to what the table can hold. Level L
+// carries 2^L harmonics, so nothing lands above Nyquist and the selection does
+// not depend on the sample rate.
+//
+// The tables are const (flash on ESP32) and only compiled in with
+// USE_BANDLIMITED_TABLES. AudioWavetables.cpp is generated by
+// host/gen_wavetables: run 'make -C host wavetables' after changing the sizes.
+
+#ifndef AUDIO_WAVETABLES_H
+#define AUDIO_WAVETABLES_H
+
+#include "AudioPlatform.h"
+#include "AudioConfig.h"
+
+#define BL_TABLE_BITS           9
+#define BL_TABLE_SIZE           (1 << BL_TABLE_BITS)
+#define BL_TABLE_LEVELS         9
+
+enum BLWave {
+  BL_SAWTOOTH,
+  BL_SQUARE,
+  BL_TRIANGLE,
+  BL_WAVE_COUNT
+};
+
+extern const int16_t blWavetables[BL_WAVE_COUNT][BL_TABLE_LEVELS][BL_TABLE_SIZE];
+
+// Table level for a phase increment with 'phaseBits' bits per cycle
+static inline uint8_t blTableLevel(uint32_t phaseInc, uint8_t phaseBits) {
+  if (phaseInc == 0) return BL_TABLE_LEVELS - 1;
+  int32_t top = 31 - __builtin_clz(phaseInc);
+  int32_t level = (int32_t)phaseBits - 2 - top;
+  if (level < 0) return 0;
+  if (level >= BL_TABLE_LEVELS) return BL_TABLE_LEVELS - 1;
+  return (uint8_t)level;
+}
+
+#endif // AUDIO_WAVETABLES_H
@@ -61,6 +61,12 @@ void setup() {
   // 7. Initialize Console
   console.init(&audioEngine, &profileManager, &filesystem, &codecManager);
   
+  // 8. Impulse response named by the profile
+  const char* irFile = profileManager.getCurrentSettings()->convolver.file;
+  if (irFile[0] && !console.loadImpulseResponse(irFile)) {
+    Serial.println(F("[WARN] Convolver impulse response not loaded"));
+  }
+  
   printReadyMessage();
 }
 
@@ -114,13 +120,17 @@ void printSystemInfo() {
   Serial.println(F("├──────────────────────────────────────────────────────────────────┤"));
   Serial.println(F("│ ✓ I2S & PWM Audio Modes                                          │"));
   Serial.println(F("│ ✓ 5 Waveforms (Sine/Square/Saw/Triangle/Noise)                   │"));
-  Serial.println(F("│ ✓ Polyphonic Synthesis (up to 8 voices)                          │"));
+  Serial.println(F("│ ✓ Polyphonic Synthesis (up to 32 voices)                         │"));
   Serial.println(F("│ ✓ ADSR Envelope Generator                                        │"));
-  Serial.println(F("│ ✓ State-Variable Filter (LP/HP/BP)                               │"));
-  Serial.println(F("│ ✓ Biquad 3-Band Parametric EQ                                    │"));
-  Serial.println(F("│ ✓ Schroeder Reverb (Comb + Allpass)                              │"));
+  Serial.println(F("│ ✓ ZDF State-Variable Filter (LP/HP/BP, bus or per voice)         │"));
+  Serial.println(F("│ ✓ Biquad 8-Band Cascaded EQ (fixed point)                        │"));
+  Serial.println(F("│ ✓ FDN Reverb (4-line, fixed point)                               │"));
   Serial.println(F("│ ✓ LFO Modulation (Vibrato/Tremolo)                               │"));
   Serial.println(F("│ ✓ Delay/Echo Effect                                              │"));
+  Serial.println(F("│ ✓ Chorus & Flanger (shared modulated delay)                      │"));
+  Serial.println(F("│ ✓ Feed-Forward Compressor (log-domain detector)                  │"));
+  Serial.println(F("│ ✓ Partitioned FFT Convolver (impulse responses)                  │"));
+  Serial.println(F("│ ✓ Lookahead Output Limiter                                       │"));
   Serial.println(F("│ ✓ Smart Resampling (Linear/Cubic/Sinc)                           │"));
   Serial.println(F("│ ✓ Profile System (Load/Save/Export)                              │"));
   Serial.println(F("│ ✓ Dynamic Codec Plugin Architecture                              │"));
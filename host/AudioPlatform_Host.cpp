@@ -0,0 +1,97 @@
+// AudioPlatform_Host.cpp - ESP32 Audio OS v2.0
+// Linux backend for the platform abstraction layer (offline rendering)
+
+#include "AudioPlatform.h"
+#include <malloc.h>
+#include <time.h>
+
+HostSerial Serial;
+
+static uint64_t clockMicros = 0;
+
+// ============================================================================
+// VIRTUAL CLOCK
+// ============================================================================
+
+uint32_t millis() {
+  return (uint32_t)(clockMicros / 1000);
+}
+
+uint32_t micros() {
+  return (uint32_t)clockMicros;
+}
+
+void delay(uint32_t ms) {
+  clockMicros += (uint64_t)ms * 1000;
+}
+
+void hostClockAdvance(uint64_t us) {
+  clockMicros += us;
+}
+
+void hostClockReset() {
+  clockMicros = 0;
+}
+
+// ============================================================================
+// HEAP
+// ============================================================================
+
+uint32_t platformFreeHeap() {
+  struct mallinfo2 info = mallinfo2();
+  return (uint32_t)info.fordblks;
+}
+
+// ============================================================================
+// CYCLE COUNTER (nanoseconds of CPU time, not virtual time)
+// ============================================================================
+
+uint32_t platformCycleCount() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+uint32_t platformCycleFrequency() {
+  return 1000000000UL;
+}
+
+// ============================================================================
+// I2S OUTPUT (no device - blocks are pulled by OfflineRenderer)
+// ============================================================================
+
+bool platformI2SBegin(uint32_t, uint8_t, uint32_t, uint32_t) {
+  return true;
+}
+
+void platformI2SEnd() {}
+
+size_t platformI2SWrite(const int16_t*, size_t bytes) {
+  return bytes;
+}
+
+uint32_t platformI2SUnderruns() {
+  return 0;
+}
+
+// ============================================================================
+// LEDC PWM OUTPUT
+// ============================================================================
+
+void platformPWMAttach(uint8_t, uint32_t, uint8_t) {}
+void platformPWMWrite(uint8_t, uint32_t) {}
+void platformPWMDetach(uint8_t) {}
+
+// ============================================================================
+// AUDIO TASK
+// ============================================================================
+
+bool platformStartAudioTask(void (*)(void*), void*, uint8_t) {
+  return false;
+}
+
+void platformStopAudioTask() {}
+
+bool platformHasAudioTask() {
+  return false;
+}
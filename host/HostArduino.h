@@ -0,0 +1,81 @@
+// HostArduino.h - ESP32 Audio OS v2.0
+// Linux backend: the subset of the Arduino API used by the DSP core
+//
+// Time is virtual. millis()/micros() return the position of the offline
+// renderer (advanced by hostClockAdvance), so melodies and timed events
+// play back sample-accurately no matter how fast the host renders.
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+#ifndef PI
+  #define PI 3.1415926535897932384626433832795f
+#endif
+
+#define F(string_literal) (string_literal)
+
+#define OUTPUT 0x03
+#define LOW    0x0
+#define HIGH   0x1
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+template <typename T, typename U>
+static inline typename std::common_type<T, U>::type min(T a, U b) { return (a < b) ? a : b; }
+
+template <typename T, typename U>
+static inline typename std::common_type<T, U>::type max(T a, U b) { return (a > b) ? a : b; }
+
+// ============================================================================
+// VIRTUAL CLOCK
+// ============================================================================
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void hostClockAdvance(uint64_t us);
+void hostClockReset();
+
+// ============================================================================
+// SERIAL (stdout)
+// ============================================================================
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  
+  size_t print(const char* s) { return fputs(s, stdout) < 0 ? 0 : strlen(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned int v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  
+  template <typename T>
+  size_t println(T v) { size_t n = print(v); return n + print('\n'); }
+  size_t println() { return print('\n'); }
+  
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vprintf(fmt, args);
+    va_end(args);
+    return n < 0 ? 0 : (size_t)n;
+  }
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
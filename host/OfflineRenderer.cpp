@@ -0,0 +1,98 @@
+// OfflineRenderer.cpp - ESP32 Audio OS v2.0
+// Faster-than-real-time rendering of AudioEngine output (Linux backend)
+
+#include "OfflineRenderer.h"
+
+#define RENDER_CHUNK_FRAMES 1024
+
+OfflineRenderer::OfflineRenderer(AudioEngine* eng)
+  : engine(eng), framesRendered(0) {}
+
+void OfflineRenderer::render(int16_t* out, uint32_t frames) {
+  uint32_t sampleRate = engine->getSampleRate();
+  uint32_t block = engine->getSettings()->performance.i2sBufferSize;
+  
+  while (frames > 0) {
+    uint32_t n = (frames < block) ? frames : block;
+    
+    engine->getMelodyPlayer()->update();
+    engine->renderBlock(out, n);
+    
+    // Advance the virtual clock to the end of this block
+    uint64_t before = (framesRendered * 1000000ULL) / sampleRate;
+    framesRendered += n;
+    uint64_t after = (framesRendered * 1000000ULL) / sampleRate;
+    hostClockAdvance(after - before);
+    
+    out += n * 2;
+    frames -= n;
+  }
+}
+
+bool OfflineRenderer::renderToWAV(const char* path, uint32_t frames) {
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    Serial.printf("[ERROR] Cannot create %s\n", path);
+    return false;
+  }
+  
+  writeWAVHeader(f, frames, engine->getSampleRate(), 2);
+  
+  int16_t chunk[RENDER_CHUNK_FRAMES * 2];
+  uint32_t remaining = frames;
+  bool ok = true;
+  
+  while (remaining > 0 && ok) {
+    uint32_t n = (remaining < RENDER_CHUNK_FRAMES) ? remaining : RENDER_CHUNK_FRAMES;
+    render(chunk, n);
+    ok = fwrite(chunk, sizeof(int16_t) * 2, n, f) == n;
+    remaining -= n;
+  }
+  
+  fclose(f);
+  return ok;
+}
+
+bool OfflineRenderer::writeWAV(const char* path, const int16_t* samples,
+                               uint32_t frames, uint32_t sampleRate, uint16_t channels) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  
+  bool ok = writeWAVHeader(f, frames, sampleRate, channels) &&
+            fwrite(samples, sizeof(int16_t) * channels, frames, f) == frames;
+  fclose(f);
+  return ok;
+}
+
+static void putLE16(uint8_t* p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = (v >> 8) & 0xFF;
+}
+
+static void putLE32(uint8_t* p, uint32_t v) {
+  p[0] = v & 0xFF;
+  p[1] = (v >> 8) & 0xFF;
+  p[2] = (v >> 16) & 0xFF;
+  p[3] = (v >> 24) & 0xFF;
+}
+
+bool OfflineRenderer::writeWAVHeader(FILE* f, uint32_t frames,
+                                     uint32_t sampleRate, uint16_t channels) {
+  uint32_t dataSize = frames * channels * sizeof(int16_t);
+  uint8_t h[44];
+  
+  memcpy(h, "RIFF", 4);
+  putLE32(h + 4, 36 + dataSize);
+  memcpy(h + 8, "WAVEfmt ", 8);
+  putLE32(h + 16, 16);                                   // fmt chunk size
+  putLE16(h + 20, 1);                                    // PCM
+  putLE16(h + 22, channels);
+  putLE32(h + 24, sampleRate);
+  putLE32(h + 28, sampleRate * channels * sizeof(int16_t));
+  putLE16(h + 32, channels * sizeof(int16_t));
+  putLE16(h + 34, 16);
+  memcpy(h + 36, "data", 4);
+  putLE32(h + 40, dataSize);
+  
+  return fwrite(h, 1, sizeof(h), f) == sizeof(h);
+}
@@ -0,0 +1,33 @@
+// OfflineRenderer.h - ESP32 Audio OS v2.0
+// Faster-than-real-time rendering of AudioEngine output (Linux backend)
+
+#ifndef OFFLINE_RENDERER_H
+#define OFFLINE_RENDERER_H
+
+#include "AudioEngine.h"
+
+class OfflineRenderer {
+public:
+  OfflineRenderer(AudioEngine* engine);
+  
+  // Render interleaved stereo frames into memory. Plays both tasks on one
+  // thread: once per block it updates the melody player (AudioEngine::update()
+  // on the loop task), renders (the I2S task), and advances the virtual clock.
+  void render(int16_t* out, uint32_t frames);
+  
+  // Render straight into a 16-bit stereo WAV file
+  bool renderToWAV(const char* path, uint32_t frames);
+  
+  static bool writeWAV(const char* path, const int16_t* samples,
+                       uint32_t frames, uint32_t sampleRate, uint16_t channels);
+  
+  uint64_t getFramesRendered() { return framesRendered; }
+  
+private:
+  AudioEngine* engine;
+  uint64_t framesRendered;
+  
+  static bool writeWAVHeader(FILE* f, uint32_t frames, uint32_t sampleRate, uint16_t channels);
+};
+
+#endif // OFFLINE_RENDERER_H
@@ -0,0 +1,32 @@
+// audio_bench.cpp - ESP32 Audio OS v2.0
+// Host tool: render-loop microbenchmarks
+//
+//   audio_bench [stages|osc|resample|effects|engine|all] [-f frames]
+
+#include "AudioBenchmark.h"
+
+int main(int argc, char** argv) {
+  AudioBenchmark bench;
+  const char* section = "all";
+  
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      int frames = atoi(argv[++i]);
+      bench.setFrames(constrain(frames, 256, 1 << 22));
+    } else {
+      section = argv[i];
+    }
+  }
+  
+  if (strcmp(section, "stages") == 0)        bench.runStages();
+  else if (strcmp(section, "osc") == 0)      bench.runOscillators();
+  else if (strcmp(section, "resample") == 0) bench.runResampler();
+  else if (strcmp(section, "effects") == 0)  bench.runEffectChain();
+  else if (strcmp(section, "engine") == 0)   bench.runEngine();
+  else if (strcmp(section, "all") == 0)      bench.runAll();
+  else {
+    fprintf(stderr, "usage: audio_bench [stages|osc|resample|effects|engine|all] [-f frames]\n");
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,163 @@
+// audio_render.cpp - ESP32 Audio OS v2.0
+// Host tool: render AudioEngine output to a WAV file faster than real time
+//
+//   audio_render [options] out.wav
+//
+//   -r <Hz>        sample rate (default 22050)
+//   -s <seconds>   length (default 4)
+//   -w <wave>      sine|square|sawtooth|triangle|noise
+//   -o <osc>       naive|wavetable|polyblep
+//   -e <a,d,s,r>   envelope: attack/decay/release ms, sustain 0-255 (add ,exp
+//                  for exponential curves)
+//   -v <voices>    voice count (1-32)
+//   -b <frames>    block size (i2sBufferSize)
+//   -n <notes>     comma-separated MIDI notes played as a melody
+//   -d <ms>        note duration for -n (default 250)
+//   --eq --filter --reverb --delay --lfo   enable effects with defaults
+//   --chorus --flanger --comp
+//   --voice-filter  the filter per voice, cutoff swept by each envelope
+
+#include <chrono>
+#include "AudioEngine.h"
+#include "OfflineRenderer.h"
+
+#define MAX_CLI_NOTES 256
+
+static const Note demoMelody[] = {
+  {NOTE_C4, 250, 127}, {NOTE_E4, 250, 127}, {NOTE_G4, 250, 127}, {NOTE_C5, 250, 127},
+  {NOTE_G4, 250, 100}, {NOTE_E4, 250, 100}, {NOTE_C4, 500, 127}, {NOTE_REST, 250, 0},
+  {NOTE_A3, 250, 127}, {NOTE_C4, 250, 127}, {NOTE_E4, 250, 127}, {NOTE_A4, 750, 127},
+};
+
+static void usage() {
+  fprintf(stderr,
+    "usage: audio_render [-r Hz] [-s seconds] [-w wave] [-o osc] [-v voices]\n"
+    "                    [-b frames] [-e a,d,s,r[,exp]] [-n notes] [-d ms]\n"
+    "                    [--eq] [--filter] [--reverb] [--delay] [--lfo]\n"
+    "                    [--chorus] [--flanger] [--comp] [--voice-filter] out.wav\n");
+}
+
+int main(int argc, char** argv) {
+  AudioSettings settings;
+  float seconds = 4.0f;
+  const char* outPath = nullptr;
+  Note notes[MAX_CLI_NOTES];
+  size_t noteCount = 0;
+  uint16_t noteMs = 250;
+  
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool hasValue = (i + 1 < argc);
+    
+    if (strcmp(arg, "-r") == 0 && hasValue) {
+      int rate = atoi(argv[++i]);
+      settings.sampleRate = constrain(rate, MIN_SAMPLE_RATE, MAX_SAMPLE_RATE);
+    } else if (strcmp(arg, "-s") == 0 && hasValue) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(arg, "-w") == 0 && hasValue) {
+      settings.setWaveform(argv[++i]);
+    } else if (strcmp(arg, "-o") == 0 && hasValue) {
+      settings.setOscillator(argv[++i]);
+    } else if (strcmp(arg, "-e") == 0 && hasValue) {
+      unsigned a, d, s, r;
+      char curve[16] = "linear";
+      if (sscanf(argv[++i], "%u,%u,%u,%u,%15s", &a, &d, &s, &r, curve) < 4) {
+        usage();
+        return 2;
+      }
+      settings.envelope.attackMs = a;
+      settings.envelope.decayMs = d;
+      settings.envelope.sustain = constrain(s, 0u, 255u);
+      settings.envelope.releaseMs = r;
+      settings.envelope.setCurve(curve);
+    } else if (strcmp(arg, "-v") == 0 && hasValue) {
+      int voices = atoi(argv[++i]);
+      settings.voices = constrain(voices, 1, MAX_VOICES);
+    } else if (strcmp(arg, "-b") == 0 && hasValue) {
+      int frames = atoi(argv[++i]);
+      settings.performance.i2sBufferSize = constrain(frames, 16, 4096);
+    } else if (strcmp(arg, "-n") == 0 && hasValue) {
+      char* list = argv[++i];
+      for (char* tok = strtok(list, ","); tok && noteCount < MAX_CLI_NOTES; tok = strtok(nullptr, ",")) {
+        int pitch = atoi(tok);
+        notes[noteCount].pitch = constrain(pitch, 0, 127);
+        notes[noteCount].velocity = 127;
+        noteCount++;
+      }
+    } else if (strcmp(arg, "-d") == 0 && hasValue) {
+      int ms = atoi(argv[++i]);
+      noteMs = constrain(ms, 10, 10000);
+    } else if (strcmp(arg, "--eq") == 0) {
+      settings.eq.enabled = true;
+      settings.eq.bands[0].gain = 6;
+      settings.eq.bands[2].gain = -3;
+    } else if (strcmp(arg, "--filter") == 0) {
+      settings.filter.enabled = true;
+    } else if (strcmp(arg, "--voice-filter") == 0) {
+      settings.filter.enabled = true;
+      settings.filter.perVoice = true;
+    } else if (strcmp(arg, "--reverb") == 0) {
+      settings.reverb.enabled = true;
+    } else if (strcmp(arg, "--delay") == 0) {
+      settings.delay.enabled = true;
+    } else if (strcmp(arg, "--chorus") == 0) {
+      settings.chorus.enabled = true;
+    } else if (strcmp(arg, "--flanger") == 0) {
+      settings.flanger.enabled = true;
+    } else if (strcmp(arg, "--comp") == 0) {
+      settings.compressor.enabled = true;
+    } else if (strcmp(arg, "--lfo") == 0) {
+      settings.lfo.enabled = true;
+      settings.lfo.vibratoEnabled = true;
+    } else if (arg[0] != '-' && !outPath) {
+      outPath = arg;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  
+  if (!outPath || seconds <= 0.0f) {
+    usage();
+    return 2;
+  }
+  
+  settings.i2s.bufferSize = settings.performance.i2sBufferSize;
+  
+  AudioEngine engine;
+  if (!engine.init(&settings, false)) {
+    fprintf(stderr, "audio_render: engine init failed\n");
+    return 1;
+  }
+  
+  if (noteCount > 0) {
+    for (size_t i = 0; i < noteCount; i++) notes[i].duration = noteMs;
+    engine.playMelody(notes, noteCount);
+  } else {
+    engine.playMelody(demoMelody, sizeof(demoMelody) / sizeof(demoMelody[0]));
+  }
+  
+  OfflineRenderer renderer(&engine);
+  uint32_t frames = (uint32_t)(seconds * settings.sampleRate);
+  
+  auto start = std::chrono::steady_clock::now();
+  bool ok = renderer.renderToWAV(outPath, frames);
+  auto end = std::chrono::steady_clock::now();
+  
+  if (!ok) {
+    fprintf(stderr, "audio_render: failed to write %s\n", outPath);
+    return 1;
+  }
+  
+  double wall = std::chrono::duration<double>(end - start).count();
+  double audio = (double)frames / settings.sampleRate;
+  Serial.printf("[RENDER] ✓ %s: %.2f s audio in %.3f s (%.0fx real time)\n",
+                outPath, audio, wall, wall > 0.0 ? audio / wall : 0.0);
+  
+  const DSPLoadStats& load = engine.getDSPLoad();
+  Serial.printf("[RENDER]   DSP load %.2f%% avg, %.2f%% peak, worst block %u us, headroom %d us of %u us\n",
+                load.average, load.peak, load.worstBlockUs, load.headroomUs, load.deadlineUs);
+  
+  engine.deinit();
+  return 0;
+}
@@ -0,0 +1,101 @@
+// gen_wavetables.cpp - ESP32 Audio OS v2.0
+// Host tool: generates AudioWavetables.cpp (band-limited mip-mapped tables)
+//
+//   gen_wavetables <output.cpp>
+//
+// Plain additive synthesis per level. Each waveform is normalised once across
+// all of its levels (leaving room for the Gibbs overshoot), so the loudness of
+// a note does not jump when it crosses into another level.
+
+#include "AudioWavetables.h"
+#include <math.h>
+
+static double table[BL_WAVE_COUNT][BL_TABLE_LEVELS][BL_TABLE_SIZE];
+
+static int levelHarmonics(int level) {
+  int harmonics = 1 << level;
+  if (harmonics > BL_TABLE_SIZE / 2 - 1) harmonics = BL_TABLE_SIZE / 2 - 1;
+  return harmonics;
+}
+
+static void generate() {
+  for (int level = 0; level < BL_TABLE_LEVELS; level++) {
+    int harmonics = levelHarmonics(level);
+
+    for (int i = 0; i < BL_TABLE_SIZE; i++) {
+      double phase = 2.0 * M_PI * i / BL_TABLE_SIZE;
+      double saw = 0.0, square = 0.0, triangle = 0.0;
+
+      for (int h = 1; h <= harmonics; h++) {
+        // Rising ramp -1..1, matching the naive 2*phase - 1
+        saw -= sin(h * phase) / h;
+        if (h & 1) {
+          // +1 for the first half cycle
+          square += sin(h * phase) / h;
+          // -1 at phase 0, +1 at half cycle
+          triangle -= cos(h * phase) / ((double)h * h);
+        }
+      }
+
+      table[BL_SAWTOOTH][level][i] = saw;
+      table[BL_SQUARE][level][i] = square;
+      table[BL_TRIANGLE][level][i] = triangle;
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: gen_wavetables <output.cpp>\n");
+    return 2;
+  }
+
+  generate();
+
+  FILE* f = fopen(argv[1], "w");
+  if (!f) {
+    fprintf(stderr, "gen_wavetables: cannot create %s\n", argv[1]);
+    return 1;
+  }
+
+  static const char* waveNames[] = { "sawtooth", "square", "triangle" };
+
+  fprintf(f, "// AudioWavetables.cpp - ESP32 Audio OS v2.0\n");
+  fprintf(f, "// Band-limited mip-mapped wavetables\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// GENERATED by host/gen_wavetables - do not edit ('make -C host wavetables')\n\n");
+  fprintf(f, "#include \"AudioWavetables.h\"\n\n");
+  fprintf(f, "#if USE_BANDLIMITED_TABLES\n\n");
+  fprintf(f, "const int16_t blWavetables[BL_WAVE_COUNT][BL_TABLE_LEVELS][BL_TABLE_SIZE] = {\n");
+
+  for (int w = 0; w < BL_WAVE_COUNT; w++) {
+    double peak = 0.0;
+    for (int level = 0; level < BL_TABLE_LEVELS; level++) {
+      for (int i = 0; i < BL_TABLE_SIZE; i++) {
+        peak = fmax(peak, fabs(table[w][level][i]));
+      }
+    }
+
+    fprintf(f, "  { // %s\n", waveNames[w]);
+    for (int level = 0; level < BL_TABLE_LEVELS; level++) {
+      fprintf(f, "    { // level %d, %d harmonic%s\n", level, levelHarmonics(level),
+              levelHarmonics(level) == 1 ? "" : "s");
+      for (int i = 0; i < BL_TABLE_SIZE; i++) {
+        long v = lround(table[w][level][i] / peak * 32767.0);
+        if (i % 12 == 0) fprintf(f, "     ");
+        fprintf(f, " %6ld,", v);
+        if (i % 12 == 11 || i == BL_TABLE_SIZE - 1) fprintf(f, "\n");
+      }
+      fprintf(f, "    },\n");
+    }
+    fprintf(f, "  },\n");
+  }
+
+  fprintf(f, "};\n\n");
+  fprintf(f, "#endif // USE_BANDLIMITED_TABLES\n");
+  fclose(f);
+
+  printf("gen_wavetables: wrote %s (%u bytes of table data)\n", argv[1],
+         (unsigned)sizeof(int16_t) * BL_WAVE_COUNT * BL_TABLE_LEVELS * BL_TABLE_SIZE);
+  return 0;
+}